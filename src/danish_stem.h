@@ -27,8 +27,8 @@ namespace stemming
     \endcode
     */
     //------------------------------------------------------
-    template <typename string_typeT = std::wstring>
-    class danish_stem final : public stem<string_typeT>
+    template <typename string_typeT = std::wstring, typename policyT = default_stem_policy>
+    class danish_stem final : public stem<string_typeT, policyT>
         {
     public:
         /** @brief Stems a Danish word.
@@ -36,26 +36,29 @@ namespace stemming
         void operator()(string_typeT& text) final
             {
             // reset internal data
-            stem<string_typeT>::reset_r_values();
+            stem<string_typeT, policyT>::reset_r_values();
 
-            std::transform(text.begin(), text.end(), text.begin(), full_width_to_narrow);
-            stem<string_typeT>::remove_possessive_suffix(text);
+            stem<string_typeT, policyT>::normalize_input(text);
+            stem<string_typeT, policyT>::remove_possessive_suffix(text);
 
             if (text.length() < 3)
                 { return; }
 
             // see where the R1 section begins
             // R1 is the first consonant after the first vowel
-            stem<string_typeT>::find_r1(text, DANISH_VOWELS);
-            if (stem<string_typeT>::get_r1() == text.length() )
+            stem<string_typeT, policyT>::find_r1(text, DANISH_VOWELS);
+            if (stem<string_typeT, policyT>::get_r1() == text.length() )
                 { return; }
             // R1 must have at least 3 characters in front of it
-            if (stem<string_typeT>::get_r1() < 3)
-                { stem<string_typeT>::set_r1(3); }
+            if (stem<string_typeT, policyT>::get_r1() < 3)
+                { stem<string_typeT, policyT>::set_r1(3); }
             // Danish does not use R2
 
             step_1(text);
             step_2(text);
+            // the remaining steps remove derivational suffixes and undouble consonants
+            if constexpr (policyT::light_stemming)
+                { return; }
             step_3(text);
             step_4(text);
             }
@@ -67,277 +70,75 @@ namespace stemming
         //---------------------------------------------
         void step_1(string_typeT& text)
             {
-            if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*erendes*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*erende*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*hedens*/
-                common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ethed*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*erede*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*heden*/
-                common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*heder*/
-                common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*endes*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ernes*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*erens*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*erets*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*eres*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*enes*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*heds*/
-                common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*erer*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*eren*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*erne*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-               { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ende*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ered*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*eret*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*hed*/
-                common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ets*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ere*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ene*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ens*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ers*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*et*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*es*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*er*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*en*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                { return; }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "danish::step_1");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_1_ENDINGS))
+                { return; }
+            const auto suffix =
+                stem<string_typeT, policyT>::delete_longest_suffix_in_r1(text, STEP_1_SUFFIXES,
+                                                                         STEP_1_DELETED_SUFFIX_COUNT);
+            // "s" is only deleted if it follows a valid s-ending
+            if (suffix.m_index == STEP_1_DELETED_SUFFIX_COUNT &&
+                text.length() >= 2 &&
+                stem<string_typeT, policyT>::is_one_of(text[text.length()-2], DANISH_ALPHABET) )
                 {
-                if (text.length() >= 2 &&
-                    stem<string_typeT>::is_one_of(text[text.length()-2], DANISH_ALPHABET) )
-                    {
-                    text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
-                    }
-                return;
+                text.erase(text.length()-1);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
             }
         //---------------------------------------------
         void step_2(string_typeT& text)
             {
-            if (stem<string_typeT>::is_suffix_in_r1(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "danish::step_2");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_2_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /*gd*/
                 common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /*dt*/
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /*gt*/
                 common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /*kt*/
                 common_lang_constants::LOWER_K, common_lang_constants::UPPER_K,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
             }
         //---------------------------------------------
         void step_3(string_typeT& text)
             {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "danish::step_3");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_3_ENDINGS))
+                { return; }
             // do this check separately
-            if (stem<string_typeT>::is_suffix(text,
+            if (stem<string_typeT, policyT>::is_suffix(text,
                 /*igst*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
@@ -345,10 +146,10 @@ namespace stemming
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 text.erase(text.length()-2);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
             // now start looking for the longest suffix
-            if (stem<string_typeT>::delete_if_is_in_r1(text,
+            if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*elig*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
@@ -358,7 +159,7 @@ namespace stemming
                 step_2(text);
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /*løst*/
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                 common_lang_constants::LOWER_O_STROKE, common_lang_constants::UPPER_O_STROKE,
@@ -366,9 +167,9 @@ namespace stemming
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*lig*/
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
@@ -377,7 +178,7 @@ namespace stemming
                 step_2(text);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*els*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
@@ -386,7 +187,7 @@ namespace stemming
                 step_2(text);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*ig*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_G, common_lang_constants::UPPER_G, false) )
@@ -398,19 +199,35 @@ namespace stemming
         //---------------------------------------------
         void step_4(string_typeT& text)
             {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "danish::step_4");
             // undouble consecutive (same) consonants if either are in R1 section
             if (text.length() >= 2 &&
-                stem<string_typeT>::get_r1() <= text.length()-1 &&
-                stem<string_typeT>::tolower_western(text[text.length()-2]) ==
-                stem<string_typeT>::tolower_western(text[text.length()-1]) )
+                stem<string_typeT, policyT>::get_r1() <= text.length()-1 &&
+                stem<string_typeT, policyT>::tolower_western(text[text.length()-2]) ==
+                stem<string_typeT, policyT>::tolower_western(text[text.length()-1]) )
                 {
-                if (!stem<string_typeT>::is_one_of(text[text.length()-2], DANISH_VOWELS) )
+                if (!stem<string_typeT, policyT>::is_one_of(text[text.length()-2], DANISH_VOWELS) )
                     {
                     text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             }
+
+        // step 1's suffixes: the ones that are simply deleted, followed by "s"
+        static constexpr suffix_trie<70> STEP_1_SUFFIXES{
+            L"erendes", L"erende", L"hedens", L"ethed", L"erede", L"heden", L"heder", L"endes",
+            L"ernes", L"erens", L"erets", L"eres", L"enes", L"heds", L"erer", L"eren", L"erne",
+            L"ende", L"ered", L"eret", L"hed", L"ets", L"ere", L"ene", L"ens", L"ers", L"et",
+            L"es", L"er", L"en", L"e", L"s" };
+        static constexpr size_t STEP_1_DELETED_SUFFIX_COUNT{ 31 };
+
+        // the characters that the suffixes of each step can end with
+        // (step 4 undoubles any consonant, so it is always run)
+        static constexpr character_bitmap STEP_1_ENDINGS{ STEP_1_SUFFIXES.get_last_characters() };
+        static constexpr character_bitmap STEP_2_ENDINGS{ L"dt" };
+        static constexpr character_bitmap STEP_3_ENDINGS{ L"gst" };
         };
     }
 
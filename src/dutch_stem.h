@@ -20,143 +20,236 @@ namespace stemming
         @brief Dutch stemmer (Porter algorithm).
     */
     //------------------------------------------------------
-    template <typename string_typeT = std::wstring>
-    class dutch_porter_stem final : public stem<string_typeT>
+    template <typename string_typeT = std::wstring, typename policyT = default_stem_policy>
+    class dutch_porter_stem final : public stem<string_typeT, policyT>
         {
     public:
         /** @brief Stems a Dutch word.
             @param[in,out] text string to stem*/
         void operator()(string_typeT& text) final
             {
-            // First, remove all umlaut and acute accents
-            stem<string_typeT>::remove_dutch_umlauts(text);
-            stem<string_typeT>::remove_dutch_acutes(text);
-
             // reset internal data
             m_step_2_succeeded = false;
-            stem<string_typeT>::reset_r_values();
+            stem<string_typeT, policyT>::reset_r_values();
 
-            std::transform(text.begin(), text.end(), text.begin(), full_width_to_narrow);
-            stem<string_typeT>::remove_possessive_suffix(text);
+            // remove all umlaut and acute accents, normalize the text,
+            // and hash initial y, y after a vowel, and i between vowels
+            const uint8_t hashedLeadingLetters = prepare_word(text);
+            stem<string_typeT, policyT>::remove_possessive_suffix(text);
 
             if (text.length() < 3)
-                { return; }
-
-            // Hash initial y, y after a vowel, and i between vowels
-            stem<string_typeT>::hash_dutch_yi(text, DUTCH_VOWELS);
+                {
+                // too short to stem, so put back any y or i that was hashed
+                for (size_t i = 0; i < text.length(); ++i)
+                    {
+                    if ((hashedLeadingLetters & (1 << i)) != 0)
+                        { text[i] = unhash_letter(text[i]); }
+                    }
+                return;
+                }
 
-            stem<string_typeT>::find_r1(text, DUTCH_VOWELS);
-            stem<string_typeT>::find_r2(text, DUTCH_VOWELS);
+            stem<string_typeT, policyT>::find_r1(text, DUTCH_VOWELS);
+            stem<string_typeT, policyT>::find_r2(text, DUTCH_VOWELS);
             // R1 must have at least 3 characters in front of it
-            if (stem<string_typeT>::get_r1() < 3)
-                { stem<string_typeT>::set_r1(3); }
+            if (stem<string_typeT, policyT>::get_r1() < 3)
+                { stem<string_typeT, policyT>::set_r1(3); }
 
             step_1(text);
             step_2(text);
-            step_3a(text);
-            step_3b(text);
+            // steps 3a and 3b remove derivational suffixes
+            if constexpr (!policyT::light_stemming)
+                {
+                step_3a(text);
+                step_3b(text);
+                }
             step_4(text);
 
             // unhash I and Y back into their original form 
-            stem<string_typeT>::unhash_dutch_yi(text);
+            stem<string_typeT, policyT>::unhash_dutch_yi(text);
             }
         /// @returns The stemmer's language.
         [[nodiscard]]
         stemming_type get_language() const noexcept final
             { return stemming_type::dutch; }
     private:
+        /** @brief Removes umlauts and acutes, normalizes the text, and hashes initial y,
+                y after a vowel, and i between vowels, all in one pass.
+            @details This maps umlauts and acutes to their plain vowels and does the work of
+                normalize_input() and the y/i hashing. Each letter is mapped once,
+                one letter ahead of the hashing, so that an i can see the (unhashed)
+                vowel after it.
+            @param[in,out] text The word to prepare.
+            @returns Which of the first two letters were hashed (as bits 0 and 1),
+                in case the word is too short to stem once its possessive is removed.*/
+        [[nodiscard]]
+        static uint8_t prepare_word(string_typeT& text)
+            {
+            if (text.empty())
+                { return 0; }
+
+            uint8_t hashedLeadingLetters{ 0 };
+            bool in_vowel_block{ false };
+            wchar_t current{ normalize_letter(text[0]) };
+            for (size_t i = 0; i < text.length(); ++i)
+                {
+                const wchar_t next{ (i + 1 < text.length()) ? normalize_letter(text[i+1]) : 0 };
+                const bool hash_letter{
+                    (stem<string_typeT, policyT>::is_either(current,
+                        common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y) &&
+                     (i == 0 || in_vowel_block)) ||
+                    (stem<string_typeT, policyT>::is_either(current,
+                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
+                     in_vowel_block && VOWELS.contains(next)) };
+                if (hash_letter)
+                    {
+                    text[i] = hash_yi(current);
+                    in_vowel_block = false;
+                    if (i < 2)
+                        { hashedLeadingLetters |= static_cast<uint8_t>(1 << i); }
+                    }
+                else
+                    {
+                    text[i] = current;
+                    in_vowel_block = VOWELS.contains(current);
+                    }
+                current = next;
+                }
+            return hashedLeadingLetters;
+            }
+
+        /// @returns A letter with its full-width form narrowed, its umlaut or acute removed,
+        ///     and lowercased (each as the policy calls for).
+        /// @param ch The letter to normalize.
+        [[nodiscard]]
+        static constexpr wchar_t normalize_letter(wchar_t ch) noexcept
+            {
+            if constexpr (!policyT::assume_no_fullwidth)
+                { ch = full_width_to_narrow(ch); }
+            if (is_latin1(ch))
+                { return LATIN1_MAP[static_cast<size_t>(ch)]; }
+            if constexpr (LOWERCASE_TEXT)
+                { return tolower_latin1_cyrillic(ch); }
+            return ch;
+            }
+
+        /// @returns The hashed version of y or i.
+        /// @param ch The y or i to hash.
+        [[nodiscard]]
+        static constexpr wchar_t hash_yi(const wchar_t ch) noexcept
+            {
+            return (ch == common_lang_constants::LOWER_Y) ? LOWER_Y_HASH :
+                (ch == common_lang_constants::UPPER_Y) ? UPPER_Y_HASH :
+                (ch == common_lang_constants::LOWER_I) ? LOWER_I_HASH :
+                UPPER_I_HASH;
+            }
+
+        /// @returns The y or i that a hash character stands for.
+        /// @param ch The hash character.
+        [[nodiscard]]
+        static constexpr wchar_t unhash_letter(const wchar_t ch) noexcept
+            {
+            return (ch == LOWER_Y_HASH) ? common_lang_constants::LOWER_Y :
+                (ch == UPPER_Y_HASH) ? common_lang_constants::UPPER_Y :
+                (ch == LOWER_I_HASH) ? common_lang_constants::LOWER_I :
+                common_lang_constants::UPPER_I;
+            }
+
         //---------------------------------------------
         void step_1(string_typeT& text)
             {
-            if (stem<string_typeT>::is_suffix(text,/*heden*/common_lang_constants::LOWER_H,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "dutch::step_1");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_1_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::is_suffix(text,/*heden*/common_lang_constants::LOWER_H,
                     common_lang_constants::UPPER_H, common_lang_constants::LOWER_E,
                     common_lang_constants::UPPER_E, common_lang_constants::LOWER_D,
                     common_lang_constants::UPPER_D, common_lang_constants::LOWER_E,
                     common_lang_constants::UPPER_E, common_lang_constants::LOWER_N,
                     common_lang_constants::UPPER_N) )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-5)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-5)
                     {
                     text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     text[text.length()-2] = common_lang_constants::LOWER_I;
                     text[text.length()-1] = common_lang_constants::LOWER_D;
                     }
                 }
             // Define a valid en-ending as a non-vowel, and not gem.
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                     /*ene*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E)    )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-3 &&
-                    !stem<string_typeT>::is_one_of(text[text.length()-4], DUTCH_VOWELS) &&
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-3 &&
+                    !VOWELS.contains(text[text.length()-4]) &&
                     (text.length() < 6 ||
                     // "gem" in front of "en" ending
-                    !(stem<string_typeT>::is_either(text[text.length()-6],
+                    !(stem<string_typeT, policyT>::is_either_case(text[text.length()-6],
                         common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) &&
-                    stem<string_typeT>::is_either(text[text.length()-5],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-5],
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                    stem<string_typeT>::is_either(text[text.length()-4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4],
                         common_lang_constants::LOWER_M, common_lang_constants::UPPER_M) ) ) )
                     {
                     text.erase(text.length()-3);
                     // undouble dd, kk, tt
-                    if (stem<string_typeT>::is_one_of(text[text.length()-1], DUTCH_KDT) &&
-                        stem<string_typeT>::tolower_western(text[text.length()-2]) ==
-                            stem<string_typeT>::tolower_western(text[text.length()-1]))
+                    if (KDT.contains(text[text.length()-1]) &&
+                        stem<string_typeT, policyT>::tolower_western(text[text.length()-2]) ==
+                            stem<string_typeT, policyT>::tolower_western(text[text.length()-1]))
                         { text.erase(text.length()-1); }
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                     /*en*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-2 &&
-                    !stem<string_typeT>::is_one_of(text[text.length()-3], DUTCH_VOWELS) &&
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-2 &&
+                    !VOWELS.contains(text[text.length()-3]) &&
                     (text.length() < 5 ||
-                    !(stem<string_typeT>::is_either(text[text.length()-5],
+                    !(stem<string_typeT, policyT>::is_either_case(text[text.length()-5],
                         common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) &&
-                    stem<string_typeT>::is_either(text[text.length()-4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4],
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                    stem<string_typeT>::is_either(text[text.length()-3],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3],
                         common_lang_constants::LOWER_M, common_lang_constants::UPPER_M) ) ) )
                     {
                     text.erase(text.length()-2);
                     // undouble dd, kk, tt
-                    if (stem<string_typeT>::is_one_of(text[text.length()-1], DUTCH_KDT) &&
-                        stem<string_typeT>::tolower_western(text[text.length()-2]) ==
-                            stem<string_typeT>::tolower_western(text[text.length()-1]) )
+                    if (KDT.contains(text[text.length()-1]) &&
+                        stem<string_typeT, policyT>::tolower_western(text[text.length()-2]) ==
+                            stem<string_typeT, policyT>::tolower_western(text[text.length()-1]) )
                         { text.erase(text.length()-1); }
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
             else if (text.length() >= 3 &&
-                stem<string_typeT>::is_suffix(text,
+                stem<string_typeT, policyT>::is_suffix(text,
                     /*se*/common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                !stem<string_typeT>::is_one_of(text[text.length()-3], DUTCH_S_ENDING))
+                !S_ENDING.contains(text[text.length()-3]))
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-2)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-2)
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     return;
                     }
                 }
             // Define a valid s-ending as a non-vowel other than j
             else if (text.length() >= 2 &&
-                stem<string_typeT>::is_suffix(text, common_lang_constants::LOWER_S,
+                stem<string_typeT, policyT>::is_suffix(text, common_lang_constants::LOWER_S,
                                               common_lang_constants::UPPER_S) &&
-                !stem<string_typeT>::is_one_of(text[text.length()-2], DUTCH_S_ENDING))
+                !S_ENDING.contains(text[text.length()-2]))
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-1)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-1)
                     {
                     text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     return;
                     }
                 }
@@ -165,27 +258,31 @@ namespace stemming
         //---------------------------------------------
         void step_2(string_typeT& text)
             {
-            if (stem<string_typeT>::is_suffix(text, common_lang_constants::LOWER_E,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "dutch::step_2");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_2_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::is_suffix(text, common_lang_constants::LOWER_E,
                                               common_lang_constants::UPPER_E) )
                 {
                 if (text.length() >= 2 &&
-                    stem<string_typeT>::get_r1() <= text.length()-1 &&
-                    !stem<string_typeT>::is_one_of(text[text.length()-2], DUTCH_VOWELS) )
+                    stem<string_typeT, policyT>::get_r1() <= text.length()-1 &&
+                    !VOWELS.contains(text[text.length()-2]) )
                     {
                     // watch out for vowel I/Y vowel
                     if (text.length() >= 3 &&
-                        stem<string_typeT>::is_one_of(text[text.length()-2], L"iyIY") &&
-                        stem<string_typeT>::is_one_of(text[text.length()-3], DUTCH_VOWELS) )
+                        stem<string_typeT, policyT>::is_one_of(text[text.length()-2], L"iyIY") &&
+                        VOWELS.contains(text[text.length()-3]) )
                         { return; }
                     else
                         {
                         text.erase(text.length()-1);
                         // undouble dd, kk, tt
-                        if (stem<string_typeT>::is_one_of(text[text.length()-1], DUTCH_KDT) &&
-                            stem<string_typeT>::tolower_western(text[text.length()-2]) ==
-                                stem<string_typeT>::tolower_western(text[text.length()-1]))
+                        if (KDT.contains(text[text.length()-1]) &&
+                            stem<string_typeT, policyT>::tolower_western(text[text.length()-2]) ==
+                                stem<string_typeT, policyT>::tolower_western(text[text.length()-1]))
                             { text.erase(text.length()-1); }
-                        stem<string_typeT>::update_r_sections(text);
+                        stem<string_typeT, policyT>::update_r_sections(text);
                         m_step_2_succeeded = true;
                         }
                     }
@@ -194,42 +291,46 @@ namespace stemming
         //---------------------------------------------
         void step_3a(string_typeT& text)
             {
-            if (stem<string_typeT>::is_suffix(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "dutch::step_3a");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_3A_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::is_suffix(text,
                     /*heid*/common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) )
                 {
                 if (text.length() >= 5 &&
-                    stem<string_typeT>::get_r2() <= text.length()-4 &&
-                    stem<string_typeT>::is_neither(text[text.length()-5],
+                    stem<string_typeT, policyT>::get_r2() <= text.length()-4 &&
+                    stem<string_typeT, policyT>::is_neither(text[text.length()-5],
                         common_lang_constants::LOWER_C, common_lang_constants::UPPER_C) )
                     {
                     text.erase(text.length()-4);
-                    stem<string_typeT>::update_r_sections(text);
-                    if (stem<string_typeT>::get_r1() <= text.length()-2 &&
-                        stem<string_typeT>::is_suffix(text,
+                    stem<string_typeT, policyT>::update_r_sections(text);
+                    if (stem<string_typeT, policyT>::get_r1() <= text.length()-2 &&
+                        stem<string_typeT, policyT>::is_suffix(text,
                             common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                             common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) )
                         {
-                        if ((!stem<string_typeT>::is_one_of(text[text.length()-3], DUTCH_VOWELS) ||
-                            (stem<string_typeT>::is_one_of(text[text.length()-3], L"iyYI") &&
-                            stem<string_typeT>::is_one_of(text[text.length()-4], DUTCH_VOWELS))) &&
+                        if ((!VOWELS.contains(text[text.length()-3]) ||
+                            (stem<string_typeT, policyT>::is_one_of(text[text.length()-3], L"iyYI") &&
+                            VOWELS.contains(text[text.length()-4]))) &&
                             (text.length() < 5 ||
-                            !(stem<string_typeT>::is_either(text[text.length()-5],
+                            !(stem<string_typeT, policyT>::is_either_case(text[text.length()-5],
                                 common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) &&
-                            stem<string_typeT>::is_either(text[text.length()-4],
+                            stem<string_typeT, policyT>::is_either_case(text[text.length()-4],
                                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                            stem<string_typeT>::is_either(text[text.length()-3],
+                            stem<string_typeT, policyT>::is_either_case(text[text.length()-3],
                                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M) ) ) )
                             {
                             text.erase(text.length()-2);
                             // undouble dd, kk, tt
-                            if (stem<string_typeT>::is_one_of(text[text.length()-1], DUTCH_KDT) &&
-                                stem<string_typeT>::tolower_western(text[text.length()-2]) ==
-                                    stem<string_typeT>::tolower_western(text[text.length()-1]))
+                            if (KDT.contains(text[text.length()-1]) &&
+                                stem<string_typeT, policyT>::tolower_western(text[text.length()-2]) ==
+                                    stem<string_typeT, policyT>::tolower_western(text[text.length()-1]))
                                 { text.erase(text.length()-1); }
-                            stem<string_typeT>::update_r_sections(text);
+                            stem<string_typeT, policyT>::update_r_sections(text);
                             }
                         }
                     return;
@@ -239,35 +340,39 @@ namespace stemming
         //---------------------------------------------
         void step_3b(string_typeT& text)
             {
-            if (stem<string_typeT>::delete_if_is_in_r2(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "dutch::step_3b");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_3B_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*end*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ing*/common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) )
                 {
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 if (text.length() > 3)
                     {
-                    if (stem<string_typeT>::is_neither(text[text.length()-3],
+                    if (stem<string_typeT, policyT>::is_neither(text[text.length()-3],
                             common_lang_constants::LOWER_E , common_lang_constants::UPPER_E) &&
-                        stem<string_typeT>::delete_if_is_in_r2(text,
+                        stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                             /*ig*/common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                             common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) )
                         {
-                        stem<string_typeT>::update_r_sections(text);
+                        stem<string_typeT, policyT>::update_r_sections(text);
                         return;
                         }
                     else
                         {
-                        if (stem<string_typeT>::is_one_of(text[text.length()-1], DUTCH_KDT) &&
-                            stem<string_typeT>::tolower_western(text[text.length()-2]) ==
-                                stem<string_typeT>::tolower_western(text[text.length()-1]))
+                        if (KDT.contains(text[text.length()-1]) &&
+                            stem<string_typeT, policyT>::tolower_western(text[text.length()-2]) ==
+                                stem<string_typeT, policyT>::tolower_western(text[text.length()-1]))
                             {
                             text.erase(text.length()-1);
-                            stem<string_typeT>::update_r_sections(text);
+                            stem<string_typeT, policyT>::update_r_sections(text);
                             return;
                             }
                         }
@@ -275,16 +380,16 @@ namespace stemming
                 return;
                 }
             else if (!(text.length() >= 3 &&
-                    stem<string_typeT>::is_either(text[text.length()-3],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3],
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ) &&
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ig*/common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) )
                 {
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*baar*/common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
@@ -292,7 +397,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*lijk*/common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_J, common_lang_constants::UPPER_J,
@@ -302,7 +407,7 @@ namespace stemming
                 return;
                 }
             else if (m_step_2_succeeded &&
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*bar*/common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) )
@@ -313,22 +418,60 @@ namespace stemming
         //------------------------------------------------------
         void step_4(string_typeT& text)
             {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "dutch::step_4");
             // undouble consecutive (same) consonants
             if (text.length() >= 4 &&
-                !stem<string_typeT>::is_one_of(text[text.length()-4], DUTCH_VOWELS) &&
-                !stem<string_typeT>::is_one_of(text[text.length()-1], DUTCH_VOWELS) &&
+                !VOWELS.contains(text[text.length()-4]) &&
+                !VOWELS.contains(text[text.length()-1]) &&
                 text[text.length()-1] != LOWER_I_HASH &&
                 text[text.length()-1] != UPPER_I_HASH &&
-                stem<string_typeT>::is_one_of(text[text.length()-2], L"aeouAEOU") &&
-                stem<string_typeT>::tolower_western(text[text.length()-2]) ==
-                    stem<string_typeT>::tolower_western(text[text.length()-3]) )
+                stem<string_typeT, policyT>::is_one_of(text[text.length()-2], L"aeouAEOU") &&
+                stem<string_typeT, policyT>::tolower_western(text[text.length()-2]) ==
+                    stem<string_typeT, policyT>::tolower_western(text[text.length()-3]) )
                 {
                 text.erase(text.end()-2, text.end()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
             }
         // internal data specific to Dutch stemmer
         bool m_step_2_succeeded{ false  };
+
+        // the characters that the suffixes of each step can end with
+        // (step 4 looks at any word ending with a consonant, so it is always run)
+        static constexpr character_bitmap STEP_1_ENDINGS{ L"ens" };
+        static constexpr character_bitmap STEP_2_ENDINGS{ L"e" };
+        static constexpr character_bitmap STEP_3A_ENDINGS{ L"dn" };
+        static constexpr character_bitmap STEP_3B_ENDINGS{ L"dgkr" };
+
+        static constexpr character_bitmap VOWELS{ L"aeiouyè" };
+        // the letters that are undoubled
+        static constexpr character_bitmap KDT{ L"kdt" };
+        // the letters that can't come before a valid s-ending
+        static constexpr character_bitmap S_ENDING{ L"aeèiouyj" };
+
+        static constexpr bool LOWERCASE_TEXT{ policyT::fold_case && !policyT::assume_lowercase };
+        // Latin-1 letters with their umlauts and acutes removed (and lowercased, if the policy folds case)
+        static constexpr std::array<wchar_t, 256> LATIN1_MAP = []() constexpr
+            {
+            std::array<wchar_t, 256> table{};
+            for (size_t i = 0; i < table.size(); ++i)
+                { table[i] = static_cast<wchar_t>(i); }
+            constexpr std::wstring_view accented{ L"ÄËÏÖÜÁÉÍÓÚ" };
+            constexpr std::wstring_view plain{ L"AEIOUAEIOU" };
+            for (size_t i = 0; i < accented.length(); ++i)
+                {
+                table[static_cast<size_t>(accented[i])] = plain[i];
+                // lowercase forms
+                table[static_cast<size_t>(accented[i]) + 0x20] = plain[i] + 0x20;
+                }
+            if constexpr (LOWERCASE_TEXT)
+                {
+                for (auto& ch : table)
+                    { ch = tolower_latin1_cyrillic(ch); }
+                }
+            return table;
+            }();
         };
     }
 
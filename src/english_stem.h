@@ -16,12 +16,66 @@
 
 namespace stemming
     {
+    /// @private
+    /// @internal A word that the English stemmer handles specially,
+    ///     and what it is stemmed to (empty if the word is left as-is).
+    struct english_exception
+        {
+        std::wstring_view m_word;
+        std::wstring_view m_stem;
+        };
+
+    /// @private
+    /// @internal The words that the English stemmer handles before running the algorithm.
+    inline constexpr std::array<english_exception, 18> ENGLISH_EXCEPTIONS =
+        {{
+        // exception #0
+        { L"skis", L"ski" }, { L"skies", L"sky" }, { L"dying", L"die" },
+        { L"lying", L"lie" }, { L"tying", L"tie" }, { L"idly", L"idl" },
+        { L"gently", L"gentl" }, { L"ugly", L"ugli" }, { L"early", L"earli" },
+        { L"only", L"onli" }, { L"singly", L"singl" },
+        // exception #1
+        { L"sky", L"" }, { L"news", L"" }, { L"howe", L"" }, { L"atlas", L"" },
+        { L"cosmos", L"" }, { L"bias", L"" }, { L"andes", L"" }
+        }};
+
+    /// @private
+    /// @internal The length of the longest English exception.
+    inline constexpr size_t ENGLISH_EXCEPTION_MAX_LENGTH{ 6 };
+
+    /// @private
+    /// @internal Hashes the first two (lowercased) letters and length of a word
+    ///     into ENGLISH_EXCEPTION_TABLE. This is unique for each of the exceptions.
+    [[nodiscard]]
+    inline constexpr size_t hash_english_exception(const wchar_t first, const wchar_t second,
+                                                   const size_t length) noexcept
+        { return (static_cast<size_t>(first) * 7 + static_cast<size_t>(second) * 30 + length) % 32; }
+
+    /// @private
+    /// @internal Perfect-hash table of the English exceptions; each slot holds the index
+    ///     (plus one) of the exception which hashes to it, or zero if none do.
+    inline constexpr std::array<uint8_t, 32> ENGLISH_EXCEPTION_TABLE = []() constexpr
+        {
+        std::array<uint8_t, 32> table{};
+        for (size_t i = 0; i < ENGLISH_EXCEPTIONS.size(); ++i)
+            {
+            const auto& word = ENGLISH_EXCEPTIONS[i].m_word;
+            table[hash_english_exception(word[0], word[1], word.length())] =
+                static_cast<uint8_t>(i + 1);
+            }
+        return table;
+        }();
+
+    static_assert(std::count_if(ENGLISH_EXCEPTION_TABLE.cbegin(), ENGLISH_EXCEPTION_TABLE.cend(),
+                      [](const auto slot) { return slot != 0; }) == ENGLISH_EXCEPTIONS.size(),
+                  "English exceptions must each hash to a different slot.");
+
     /**
         @brief English stemmer.
     */
     //------------------------------------------------------
-    template <typename string_typeT = std::wstring>
-    class english_stem final : public stem<string_typeT>
+    template <typename string_typeT = std::wstring, typename policyT = default_stem_policy>
+    class english_stem final : public stem<string_typeT, policyT>
         {
     public:
         /** @brief Stems an English string.
@@ -30,10 +84,10 @@ namespace stemming
             {
             // reset internal data
             m_first_vowel = string_typeT::npos;
-            stem<string_typeT>::reset_r_values();
+            stem<string_typeT, policyT>::reset_r_values();
 
-            std::transform(text.begin(), text.end(), text.begin(), full_width_to_narrow);
-            stem<string_typeT>::remove_possessive_suffix(text);
+            stem<string_typeT, policyT>::normalize_input(text);
+            stem<string_typeT, policyT>::remove_possessive_suffix(text);
 
             if (text.length() < 3)
                 { return; }
@@ -42,141 +96,33 @@ namespace stemming
             if (is_exception(text) )
                 { return; }
 
-            stem<string_typeT>::hash_y(text, L"aeiouyAEIOUY");
+            stem<string_typeT, policyT>::hash_y(text, L"aeiouyAEIOUY");
             m_first_vowel = text.find_first_of(L"aeiouyAEIOUY");
             if (m_first_vowel == string_typeT::npos)
                 { return; }
-
-            if (text.length() >= 5 &&
-                /*gener*/
-                (stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                    stem<string_typeT>::is_either(text[4],
-                        common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) ) )
-                {
-                stem<string_typeT>::set_r1(5);
-                }
-            else if (text.length() >= 6 &&
-                /*commun*/
-                (stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_C, common_lang_constants::UPPER_C) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_M, common_lang_constants::UPPER_M) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_M, common_lang_constants::UPPER_M) &&
-                    stem<string_typeT>::is_either(text[4],
-                        common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) &&
-                    stem<string_typeT>::is_either(text[5],
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ) )
-                {
-                stem<string_typeT>::set_r1(6);
-                }
-            else if (text.length() >= 5 &&
-                /*arsen*/
-                (stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                    stem<string_typeT>::is_either(text[4],
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ) )
-                {
-                stem<string_typeT>::set_r1(5);
-                }
-            else if (text.length() >= 4 &&
-                /*past*/
-                (stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_P, common_lang_constants::UPPER_P) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) ) )
+            // the steps only replace letters with other ASCII letters, so this holds for the whole word
+            m_is_ascii = stem<string_typeT, policyT>::is_ascii(text);
+            // nothing can be removed from a word that doesn't end with a letter
+            // that one of the steps looks for (e.g., a number or code)
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, ALL_STEP_ENDINGS))
                 {
-                stem<string_typeT>::set_r1(4);
-                }
-            else if (text.length() >= 7 &&
-                /*univers*/
-                (stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_V, common_lang_constants::UPPER_V) &&
-                    stem<string_typeT>::is_either(text[4],
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                    stem<string_typeT>::is_either(text[5],
-                        common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) &&
-                    stem<string_typeT>::is_either(text[6],
-                        common_lang_constants::LOWER_S, common_lang_constants::UPPER_S)) )
-                {
-                stem<string_typeT>::set_r1(7);
-                }
-            else if (text.length() >= 5 &&
-                /*later*/
-                (stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                    stem<string_typeT>::is_either(text[4],
-                        common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) ) )
-                {
-                stem<string_typeT>::set_r1(5);
-                }
-            else if (text.length() >= 5 &&
-                /*emerg*/
-                (stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_M, common_lang_constants::UPPER_M) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) &&
-                    stem<string_typeT>::is_either(text[4],
-                        common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) ) )
-                {
-                stem<string_typeT>::set_r1(5);
+                stem<string_typeT, policyT>::unhash_y(text);
+                return;
                 }
-            else if (text.length() >= 5 &&
-                /*organ*/
-                (stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(text[4],
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ) )
+
+            // a few prefixes have their own R1 (e.g., "gener" in "generous")
+            if (const size_t prefixLength =
+                    stem<string_typeT, policyT>::find_prefix(text, R1_PREFIXES);
+                prefixLength != 0)
                 {
-                stem<string_typeT>::set_r1(5);
+                stem<string_typeT, policyT>::set_r1(prefixLength);
                 }
             else
                 {
-                stem<string_typeT>::find_r1(text, L"aeiouyAEIOUY");
+                stem<string_typeT, policyT>::find_r1(text, L"aeiouyAEIOUY");
                 }
 
-            stem<string_typeT>::find_r2(text, L"aeiouyAEIOUY");
+            stem<string_typeT, policyT>::find_r2(text, L"aeiouyAEIOUY");
 
             // step 1a:
             step_1a(text);
@@ -184,6 +130,12 @@ namespace stemming
             step_1b(text);
             // step 1c:
             step_1c(text);
+            // the remaining steps remove derivational suffixes
+            if constexpr (policyT::light_stemming)
+                {
+                stem<string_typeT, policyT>::unhash_y(text);
+                return;
+                }
             // step 2:
             step_2(text);
             // step 3:
@@ -193,7 +145,7 @@ namespace stemming
             // step 5:
             step_5(text);
 
-            stem<string_typeT>::unhash_y(text);
+            stem<string_typeT, policyT>::unhash_y(text);
             }
 
         /// @returns The stemmer's language.
@@ -204,267 +156,39 @@ namespace stemming
         //---------------------------------------------
         bool is_exception(string_typeT& text) const
             {
-            // exception #0
-            /*skis*/
-            if (text.length() == 4 &&
-                stem<string_typeT>::is_either(text[0],
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) &&
-                stem<string_typeT>::is_either(text[1],
-                    common_lang_constants::LOWER_K, common_lang_constants::UPPER_K) &&
-                stem<string_typeT>::is_either(text[2],
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                stem<string_typeT>::is_either(text[3],
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
-                {
-                text = L"ski";
-                return true;
-                }
-            /*skies*/
-            else if (text.length() == 5 &&
-                    stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_K, common_lang_constants::UPPER_K) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                    stem<string_typeT>::is_either(text[4],
-                        common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
-                {
-                text = L"sky";
-                return true;
-                }
-            /*dying*/
-            else if (text.length() == 5 &&
-                    stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                    stem<string_typeT>::is_either(text[4],
-                        common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) )
-                {
-                text = L"die";
-                return true;
-                }
-            /*lying*/
-            else if (text.length() == 5 &&
-                    stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                    stem<string_typeT>::is_either(text[4],
-                       common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) )
-                {
-                text = L"lie";
-                return true;
-                }
-            /*tying*/
-            else if (text.length() == 5 &&
-                    stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                    stem<string_typeT>::is_either(text[4],
-                        common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) )
-                {
-                text = L"tie";
-                return true;
-                }
-            /*idly*/
-            else if (text.length() == 4 &&
-                    stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y) )
-                {
-                text = L"idl";
-                return true;
-                }
-            /*gently*/
-            else if (text.length() == 6 &&
-                    stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) &&
-                    stem<string_typeT>::is_either(text[4],
-                        common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) &&
-                    stem<string_typeT>::is_either(text[5],
-                        common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y) )
-                {
-                text = L"gentl";
-                return true;
-                }
-            /*ugly*/
-            else if (text.length() == 4 &&
-                    stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y) )
-                {
-                text = L"ugli";
-                return true;
-                }
-            /*early*/
-            else if (text.length() == 5 &&
-                    stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                    stem<string_typeT>::is_either(text[1],
-                            common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) &&
-                    stem<string_typeT>::is_either(text[4],
-                        common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y) )
-                {
-                text = L"earli";
-                return true;
-                }
-            /*only*/
-            else if (text.length() == 4 &&
-                    stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y) )
-                {
-                text = L"onli";
-                return true;
-                }
-            /*singly*/
-            else if (text.length() == 6 &&
-                    stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) &&
-                    stem<string_typeT>::is_either(text[4],
-                        common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) &&
-                    stem<string_typeT>::is_either(text[5],
-                        common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y) )
-                {
-                text = L"singl";
-                return true;
-                }
-            // exception #1
-            else if (
-                /*sky*/
-                (text.length() == 3 &&
-                    stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_K, common_lang_constants::UPPER_K) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y) ) ||
-                /*news*/
-                (text.length() == 4 &&
-                    stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_W, common_lang_constants::UPPER_W) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) ) ||
-                /*howe*/
-                (text.length() == 4 &&
-                    stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_H, common_lang_constants::UPPER_H) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_W, common_lang_constants::UPPER_W) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ) ||
-                /*atlas*/
-                (text.length() == 5 &&
-                    stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(text[4],
-                        common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) ) ||
-                /*cosmos*/
-                (text.length() == 6 &&
-                    stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_C, common_lang_constants::UPPER_C) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_M, common_lang_constants::UPPER_M) &&
-                    stem<string_typeT>::is_either(text[4],
-                        common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) &&
-                    stem<string_typeT>::is_either(text[5],
-                        common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) ) ||
-                /*bias*/
-                (text.length() == 4 &&
-                    stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_B, common_lang_constants::UPPER_B) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) ) ||
-                /*andes*/
-                (text.length() == 5 &&
-                    stem<string_typeT>::is_either(text[0],
-                        common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(text[1],
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                    stem<string_typeT>::is_either(text[2],
-                        common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) &&
-                    stem<string_typeT>::is_either(text[3],
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                    stem<string_typeT>::is_either(text[4],
-                        common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) ) )
+            if (text.length() > ENGLISH_EXCEPTION_MAX_LENGTH)
+                { return false; }
+
+            const auto toLower = [](const wchar_t ch) noexcept
                 {
-                return true;
-                }
-            return false;
+                return stem<string_typeT, policyT>::is_lowercased_text() ?
+                    ch : tolower_latin1_cyrillic(ch);
+                };
+            const size_t exceptionIndex = ENGLISH_EXCEPTION_TABLE[
+                hash_english_exception(toLower(text[0]), toLower(text[1]), text.length())];
+            if (exceptionIndex == 0)
+                { return false; }
+
+            const auto& exception = ENGLISH_EXCEPTIONS[exceptionIndex - 1];
+            if (!std::equal(text.cbegin(), text.cend(),
+                    exception.m_word.cbegin(), exception.m_word.cend(),
+                    [&toLower](const wchar_t textChar, const wchar_t exceptionChar) noexcept
+                    { return toLower(textChar) == exceptionChar; }))
+                { return false; }
+            // exceptions with a special stem are replaced, the rest are left as-is
+            if (!exception.m_stem.empty())
+                { text.assign(exception.m_stem.data(), exception.m_stem.length()); }
+            return true;
             }
 
         //---------------------------------------------
         void step_1a(string_typeT& text)
             {
-            if (stem<string_typeT>::is_suffix(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "english::step_1a");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_1A_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::is_suffix(text,
                 /*sses*/
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -472,14 +196,14 @@ namespace stemming
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 text.erase(text.length()-2);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                         /*ied*/
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                         common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) ||
-                    stem<string_typeT>::is_suffix(text,
+                    stem<string_typeT, policyT>::is_suffix(text,
                         /*ies*/
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -488,33 +212,37 @@ namespace stemming
                 if (text.length() == 3 || text.length() == 4)
                     {
                     text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 else
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             else if (text.length() >= 2 &&
-                    stem<string_typeT>::is_either(text[text.length()-1],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1],
                         common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) &&
                     m_first_vowel < text.length()-2 &&
-                    !stem<string_typeT>::is_one_of(text[text.length()-2], L"suSU") )
+                    !stem<string_typeT, policyT>::is_one_of(text[text.length()-2], L"suSU") )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
             }
         //---------------------------------------------
 
         void step_1b(string_typeT& text)
             {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "english::step_1b");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_1B_ENDINGS))
+                { return; }
             // if the preceding word contains a vowel
             bool regress_trim = false;
 
             // exceptions
-            if (stem<string_typeT>::is_suffix(text,
+            if (stem<string_typeT, policyT>::is_suffix(text,
                 /*eed*/
                 common_lang_constants::LOWER_P, common_lang_constants::UPPER_P,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -526,7 +254,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*eed*/
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                 common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
@@ -538,7 +266,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*eed*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_X, common_lang_constants::UPPER_X,
@@ -549,7 +277,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*eedly*/
                 common_lang_constants::LOWER_P, common_lang_constants::UPPER_P,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -563,7 +291,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*eedly*/
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                 common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
@@ -577,7 +305,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*eedly*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_X, common_lang_constants::UPPER_X,
@@ -591,19 +319,19 @@ namespace stemming
                 return;
                 }
 
-            if (stem<string_typeT>::is_suffix(text,
+            if (stem<string_typeT, policyT>::is_suffix(text,
                 /*eed*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-3)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-3)
                     {
                     text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*eedly*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -611,23 +339,23 @@ namespace stemming
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                 common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y) )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-5)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-5)
                     {
                     text.erase(text.length()-3);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*ed*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) &&
                 m_first_vowel < text.length()-2)
                 {
                 text.erase(text.length()-2);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 regress_trim = true;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*edly*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
@@ -636,10 +364,10 @@ namespace stemming
                 m_first_vowel < text.length()-4)
                 {
                 text.erase(text.length()-4);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 regress_trim = true;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*ing*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -647,77 +375,77 @@ namespace stemming
                 m_first_vowel < text.length()-3)
                 {
                 if (text.length() == 5 &&
-                    stem<string_typeT>::is_either(text[text.length() - 4],
+                    stem<string_typeT, policyT>::is_either(text[text.length() - 4],
                         common_lang_constants::LOWER_Y, LOWER_Y_HASH) &&
                     !is_vowel(text[text.length() - 5]))
                     {
                     text.erase(text.length() - 2);
                     text[text.length() - 2] = common_lang_constants::LOWER_I;
                     text[text.length() - 1] = common_lang_constants::LOWER_E;
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     return;
                     }
                 else if (text.length() == 6 &&
-                    ((stem<string_typeT>::is_either(text[0],
+                    ((stem<string_typeT, policyT>::is_either_case(text[0],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                     stem<string_typeT>::is_either(text[1],
+                     stem<string_typeT, policyT>::is_either_case(text[1],
                         common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                     stem<string_typeT>::is_either(text[2],
+                     stem<string_typeT, policyT>::is_either_case(text[2],
                         common_lang_constants::LOWER_N, common_lang_constants::UPPER_N)) ||
 
-                    (stem<string_typeT>::is_either(text[0],
+                    (stem<string_typeT, policyT>::is_either_case(text[0],
                         common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) &&
-                     stem<string_typeT>::is_either(text[1],
+                     stem<string_typeT, policyT>::is_either_case(text[1],
                         common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) &&
-                     stem<string_typeT>::is_either(text[2],
+                     stem<string_typeT, policyT>::is_either_case(text[2],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))))
                     {
                     return;
                     }
                 else if (text.length() == 7 &&
-                    ((stem<string_typeT>::is_either(text[0],
+                    ((stem<string_typeT, policyT>::is_either_case(text[0],
                         common_lang_constants::LOWER_C, common_lang_constants::UPPER_C) &&
-                     stem<string_typeT>::is_either(text[1],
+                     stem<string_typeT, policyT>::is_either_case(text[1],
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                     stem<string_typeT>::is_either(text[2],
+                     stem<string_typeT, policyT>::is_either_case(text[2],
                         common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                     stem<string_typeT>::is_either(text[3],
+                     stem<string_typeT, policyT>::is_either_case(text[3],
                         common_lang_constants::LOWER_N, common_lang_constants::UPPER_N)) ||
 
-                    (stem<string_typeT>::is_either(text[0],
+                    (stem<string_typeT, policyT>::is_either_case(text[0],
                         common_lang_constants::LOWER_H, common_lang_constants::UPPER_H) &&
-                     stem<string_typeT>::is_either(text[1],
+                     stem<string_typeT, policyT>::is_either_case(text[1],
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                     stem<string_typeT>::is_either(text[2],
+                     stem<string_typeT, policyT>::is_either_case(text[2],
                         common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) &&
-                     stem<string_typeT>::is_either(text[3],
+                     stem<string_typeT, policyT>::is_either_case(text[3],
                         common_lang_constants::LOWER_R, common_lang_constants::UPPER_R)) ||
 
-                    (stem<string_typeT>::is_either(text[0],
+                    (stem<string_typeT, policyT>::is_either_case(text[0],
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                     stem<string_typeT>::is_either(text[1],
+                     stem<string_typeT, policyT>::is_either_case(text[1],
                         common_lang_constants::LOWER_V, common_lang_constants::UPPER_V) &&
-                     stem<string_typeT>::is_either(text[2],
+                     stem<string_typeT, policyT>::is_either_case(text[2],
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                     stem<string_typeT>::is_either(text[3],
+                     stem<string_typeT, policyT>::is_either_case(text[3],
                         common_lang_constants::LOWER_N, common_lang_constants::UPPER_N)) ||
                         
-                    (stem<string_typeT>::is_either(text[0],
+                    (stem<string_typeT, policyT>::is_either_case(text[0],
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                     stem<string_typeT>::is_either(text[1],
+                     stem<string_typeT, policyT>::is_either_case(text[1],
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                     stem<string_typeT>::is_either(text[2],
+                     stem<string_typeT, policyT>::is_either_case(text[2],
                         common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) &&
-                     stem<string_typeT>::is_either(text[3],
+                     stem<string_typeT, policyT>::is_either_case(text[3],
                         common_lang_constants::LOWER_R, common_lang_constants::UPPER_R))))
                     {
                     return;
                     }
                 text.erase(text.length() - 3);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 regress_trim = true;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*ingly*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -727,84 +455,85 @@ namespace stemming
                 m_first_vowel < text.length()-5)
                 {
                 text.erase(text.length()-5);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 regress_trim = true;
                 }
             if (regress_trim)
                 {
+                stem<string_typeT, policyT>::record_event("english::step_1b regress_trim");
                 const bool isExactly3NotAEOStart
                     {
                     text.length() == 3 &&
-                    !(stem<string_typeT>::is_either(text[0],
+                    !(stem<string_typeT, policyT>::is_either_case(text[0],
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) ||
-                      stem<string_typeT>::is_either(text[0],
+                      stem<string_typeT, policyT>::is_either_case(text[0],
                          common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                      stem<string_typeT>::is_either(text[0],
+                      stem<string_typeT, policyT>::is_either_case(text[0],
                          common_lang_constants::LOWER_O, common_lang_constants::UPPER_O))
                     };
-                if (stem<string_typeT>::is_suffix(text,
+                if (stem<string_typeT, policyT>::is_suffix(text,
                         /*at*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) ||
-                    stem<string_typeT>::is_suffix(text,
+                    stem<string_typeT, policyT>::is_suffix(text,
                         /*bl*/common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) ||
-                    stem<string_typeT>::is_suffix(text,
+                    stem<string_typeT, policyT>::is_suffix(text,
                         /*iz*/common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z) )
                     {
                     text += common_lang_constants::LOWER_E;
                     // need to search for r2 again because the 'e' added here may change that
-                    stem<string_typeT>::find_r2(text, L"aeiouyAEIOUY");
+                    stem<string_typeT, policyT>::find_r2(text, L"aeiouyAEIOUY");
                     }
                 // undouble
                 else if ((text.length() > 3 || isExactly3NotAEOStart) &&
-                        (stem<string_typeT>::is_suffix(text,
+                        (stem<string_typeT, policyT>::is_suffix(text,
                             /*bb*/
                             common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                             common_lang_constants::LOWER_B, common_lang_constants::UPPER_B) ||
-                        stem<string_typeT>::is_suffix(text,
+                        stem<string_typeT, policyT>::is_suffix(text,
                             /*dd*/
                             common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
                             common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) ||
-                        stem<string_typeT>::is_suffix(text,
+                        stem<string_typeT, policyT>::is_suffix(text,
                             /*ff*/
                             common_lang_constants::LOWER_F, common_lang_constants::UPPER_F,
                             common_lang_constants::LOWER_F, common_lang_constants::UPPER_F) ||
-                        stem<string_typeT>::is_suffix(text,
+                        stem<string_typeT, policyT>::is_suffix(text,
                             /*gg*/
                             common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
                             common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) ||
-                        stem<string_typeT>::is_suffix(text,
+                        stem<string_typeT, policyT>::is_suffix(text,
                             /*mm*/common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                             common_lang_constants::LOWER_M, common_lang_constants::UPPER_M) ||
-                        stem<string_typeT>::is_suffix(text,
+                        stem<string_typeT, policyT>::is_suffix(text,
                             /*nn*/
                             common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                             common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ||
-                        stem<string_typeT>::is_suffix(text,
+                        stem<string_typeT, policyT>::is_suffix(text,
                             /*pp*/
                             common_lang_constants::LOWER_P, common_lang_constants::UPPER_P,
                             common_lang_constants::LOWER_P, common_lang_constants::UPPER_P) ||
-                        stem<string_typeT>::is_suffix(text,
+                        stem<string_typeT, policyT>::is_suffix(text,
                             /*rr*/
                             common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                             common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) ||
-                        stem<string_typeT>::is_suffix(text,
+                        stem<string_typeT, policyT>::is_suffix(text,
                             /*tt*/
                             common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                             common_lang_constants::LOWER_T, common_lang_constants::UPPER_T)) )
                     {
                     text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 else if ((text.length() < 2 ||
-                          stem<string_typeT>::tolower_western(text[text.length() - 1]) !=
-                          stem<string_typeT>::tolower_western(text[text.length() - 2]) ) &&
+                          stem<string_typeT, policyT>::tolower_western(text[text.length() - 1]) !=
+                          stem<string_typeT, policyT>::tolower_western(text[text.length() - 2]) ) &&
                     is_short_word(text, text.length() ) )
                     {
                     text += common_lang_constants::LOWER_E;
                     // need to search for R2 again because the 'e' added here may change that
-                    stem<string_typeT>::find_r2(text, L"aeiouyAEIOUY");
+                    stem<string_typeT, policyT>::find_r2(text, L"aeiouyAEIOUY");
                     }
                 }
             }
@@ -813,16 +542,20 @@ namespace stemming
         //---------------------------------------------
         void step_1c(string_typeT& text)
             {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "english::step_1c");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_1C_ENDINGS))
+                { return; }
             // proceeding consonant cannot be first letter in word
             if (text.length() > 2 &&
                 !is_vowel(text[text.length()-2]) )
                 {
-                if (stem<string_typeT>::is_either(text[text.length()-1],
+                if (stem<string_typeT, policyT>::is_either(text[text.length()-1],
                     common_lang_constants::LOWER_Y, LOWER_Y_HASH) )
                     {
                     text[text.length()-1] = common_lang_constants::LOWER_I;
                     }
-                else if (stem<string_typeT>::is_either(text[text.length()-1],
+                else if (stem<string_typeT, policyT>::is_either(text[text.length()-1],
                     common_lang_constants::UPPER_Y, UPPER_Y_HASH) )
                     {
                     text[text.length()-1] = common_lang_constants::UPPER_I;
@@ -833,293 +566,148 @@ namespace stemming
         //---------------------------------------------
         void step_2(string_typeT& text)
             {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "english::step_2");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_2_ENDINGS))
+                { return; }
+            const packed_tail tail{ pack_tail(text) };
             if (text.length() >= 7 &&
-                (stem<string_typeT>::is_suffix(text,
-                    /*ization*/
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                    common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z,
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                    common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ||
-                stem<string_typeT>::is_suffix(text,
-                    /*ational*/
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                    common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) ) )
+                (tail.ends_with("ization") ||
+                tail.ends_with("ational") ) )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-7)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-7)
                     {
                     text.erase(text.length()-4);
                     text[static_cast<int>(text.length()-1)] = common_lang_constants::LOWER_E;
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             else if (text.length() >= 7 &&
-                (stem<string_typeT>::is_suffix(text,
-                    /*fulness*/
-                    common_lang_constants::LOWER_F, common_lang_constants::UPPER_F,
-                    common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) ||
-                stem<string_typeT>::is_suffix(text,
-                    /*ousness*/
-                    common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                    common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) ||
-                stem<string_typeT>::is_suffix(text,
-                    /*iveness*/
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                    common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) ) )
+                (tail.ends_with("fulness") ||
+                tail.ends_with("ousness") ||
+                tail.ends_with("iveness") ) )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-7)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-7)
                     {
                     text.erase(text.length()-4);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             else if (text.length() >= 6 &&
-                (stem<string_typeT>::is_suffix(text,
-                    /*tional*/
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                    common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) ||
-                stem<string_typeT>::is_suffix(text,
-                    /*lessli*/
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ) )
+                (tail.ends_with("tional") ||
+                tail.ends_with("lessli") ) )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-6)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-6)
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             else if (text.length() >= 6 &&
-                stem<string_typeT>::is_suffix(text,
-                    /*biliti*/
-                    common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
+                tail.ends_with("biliti") )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-6)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-6)
                     {
                     text.erase(text.length()-3);
                     text[text.length()-2] = common_lang_constants::LOWER_L;
                     text[text.length()-1] = common_lang_constants::LOWER_E;
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             else if (text.length() >= 5 &&
-                (stem<string_typeT>::is_suffix(text,
-                    /*iviti*/
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                    common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                stem<string_typeT>::is_suffix(text,
-                    /*ation*/
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                    common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ) )
+                (tail.ends_with("iviti") ||
+                tail.ends_with("ation") ) )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-5)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-5)
                     {
                     text.erase(text.length()-2);
                     text[text.length()-1] = common_lang_constants::LOWER_E;
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             else if (text.length() >= 5 &&
-                (stem<string_typeT>::is_suffix(text,
-                    /*alism*/
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                    common_lang_constants::LOWER_M, common_lang_constants::UPPER_M) ||
-                stem<string_typeT>::is_suffix(text,
-                    /*aliti*/
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                stem<string_typeT>::is_suffix(text,
-                    /*ogist*/
-                    common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                    common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T)) )
+                (tail.ends_with("alism") ||
+                tail.ends_with("aliti") ||
+                tail.ends_with("ogist")) )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length() - 5)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length() - 5)
                     {
                     text.erase(text.length() - 3);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             else if (text.length() >= 5 &&
-                (stem<string_typeT>::is_suffix(text,
-                    /*ousli*/
-                    common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                    common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                stem<string_typeT>::is_suffix(text,
-                    /*entli*/
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                stem<string_typeT>::is_suffix(text,
-                    /*fulli*/
-                    common_lang_constants::LOWER_F, common_lang_constants::UPPER_F,
-                    common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ) )
+                (tail.ends_with("ousli") ||
+                tail.ends_with("entli") ||
+                tail.ends_with("fulli") ) )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-5)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-5)
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
-            else if (text.length() >= 4 && stem<string_typeT>::is_suffix(text,
-                /*alli*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
+            else if (text.length() >= 4 && tail.ends_with("alli") )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-4)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-4)
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             else if (text.length() >= 4 &&
-                (stem<string_typeT>::is_suffix(text,
-                    /*enci*/
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                    common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                stem<string_typeT>::is_suffix(text,
-                    /*anci*/
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                    common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                stem<string_typeT>::is_suffix(text,
-                    /*abli*/
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                    common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ) )
+                (tail.ends_with("enci") ||
+                tail.ends_with("anci") ||
+                tail.ends_with("abli") ) )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-4)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-4)
                     {
                     text[text.length()-1] = common_lang_constants::LOWER_E;
                     }
                 }
-            else if (text.length() >= 4 && stem<string_typeT>::is_suffix(text,
-                /*izer*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) )
+            else if (text.length() >= 4 && tail.ends_with("izer") )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-4)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-4)
                     {
                     text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             else if (text.length() >= 4 &&
-                stem<string_typeT>::is_suffix(text,
-                    /*ator*/
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                    common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) )
+                tail.ends_with("ator") )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-4)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-4)
                     {
                     text.erase(text.length()-1);
                     text[text.length()-1] = common_lang_constants::LOWER_E;
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             else if (text.length() >= 3 &&
-                stem<string_typeT>::get_r1() <= (text.length()-3) &&
-                stem<string_typeT>::is_suffix(text,
-                    /*bli*/
-                    common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
+                stem<string_typeT, policyT>::get_r1() <= (text.length()-3) &&
+                tail.ends_with("bli") )
                 {
                 text[text.length()-1] = common_lang_constants::LOWER_E;
                 }
             else if (text.length() >= 3 &&
-                stem<string_typeT>::get_r1() <= (text.length()-3) &&
-                stem<string_typeT>::is_suffix(text,
-                    /*ogi*/
-                    common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                    common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
+                stem<string_typeT, policyT>::get_r1() <= (text.length()-3) &&
+                tail.ends_with("ogi") )
                 {
-                if (stem<string_typeT>::is_either(text[text.length()-4],
+                if (stem<string_typeT, policyT>::is_either_case(text[text.length()-4],
                     common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) )
                     {
                     text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             else if (text.length() >= 3 &&
-                    stem<string_typeT>::get_r1() <= (text.length()-2) &&
-                    stem<string_typeT>::is_suffix(text,
-                        /*li*/
-                        common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
+                    stem<string_typeT, policyT>::get_r1() <= (text.length()-2) &&
+                    tail.ends_with("li") )
                 {
-                if (stem<string_typeT>::is_one_of(text[text.length()-3], L"cdeghkmnrtCDEGHKMNRT") )
+                if (stem<string_typeT, policyT>::is_one_of(text[text.length()-3], L"cdeghkmnrtCDEGHKMNRT") )
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             }
@@ -1127,117 +715,69 @@ namespace stemming
         //---------------------------------------------
         void step_3(string_typeT& text)
             {
-            if (text.length() >= 7 && stem<string_typeT>::is_suffix(text,
-                /*ational*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) )
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "english::step_3");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_3_ENDINGS))
+                { return; }
+            const packed_tail tail{ pack_tail(text) };
+            if (text.length() >= 7 && tail.ends_with("ational") )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-7)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-7)
                     {
                     text.erase(text.length()-4);
                     text[text.length()-1] = common_lang_constants::LOWER_E;
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
-            else if (text.length() >= 6 && stem<string_typeT>::is_suffix(text,
-                /*tional*/
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) )
+            else if (text.length() >= 6 && tail.ends_with("tional") )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-6)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-6)
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             else if (text.length() >= 5 &&
-                (stem<string_typeT>::is_suffix(text,
-                    /*icate*/
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                    common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                stem<string_typeT>::is_suffix(text,
-                    /*iciti*/
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                    common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                stem<string_typeT>::is_suffix(text,
-                    /*alize*/
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                    common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z,
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ) )
+                (tail.ends_with("icate") ||
+                tail.ends_with("iciti") ||
+                tail.ends_with("alize") ) )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-5)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-5)
                     {
                     text.erase(text.length()-3);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
-            else if (text.length() >= 5 && stem<string_typeT>::is_suffix(text,
-                /*ative*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
+            else if (text.length() >= 5 && tail.ends_with("ative") )
                 {
-                if (stem<string_typeT>::get_r2() <= text.length()-5)
+                if (stem<string_typeT, policyT>::get_r2() <= text.length()-5)
                     {
                     text.erase(text.length()-5);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
-            else if (text.length() >= 4 && stem<string_typeT>::is_suffix(text,
-                /*ical*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) )
+            else if (text.length() >= 4 && tail.ends_with("ical") )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-4)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-4)
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
-            else if (text.length() >= 4 && stem<string_typeT>::is_suffix(text,
-                /*ness*/
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
+            else if (text.length() >= 4 && tail.ends_with("ness") )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-4)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-4)
                     {
                     text.erase(text.length()-4);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
-            else if (text.length() >= 3 && stem<string_typeT>::is_suffix(text,
-                /*ful*/
-                common_lang_constants::LOWER_F, common_lang_constants::UPPER_F,
-                common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) )
+            else if (text.length() >= 3 && tail.ends_with("ful") )
                 {
-                if (stem<string_typeT>::get_r1() <= text.length()-3)
+                if (stem<string_typeT, policyT>::get_r1() <= text.length()-3)
                     {
                     text.erase(text.length()-3);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             }
@@ -1245,145 +785,68 @@ namespace stemming
         //---------------------------------------------
         void step_4(string_typeT& text)
             {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "english::step_4");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_4_ENDINGS))
+                { return; }
+            const packed_tail tail{ pack_tail(text) };
             if (text.length() >= 5 &&
-                stem<string_typeT>::is_suffix(text,
-                    /*ement*/
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                    common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
+                tail.ends_with("ement") )
                 {
-                if (stem<string_typeT>::get_r2() <= text.length()-5)
+                if (stem<string_typeT, policyT>::get_r2() <= text.length()-5)
                     {
                     text.erase(text.length()-5);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             else if (text.length() >= 4 &&
-                    (stem<string_typeT>::is_suffix(text,
-                        /*able*/
-                        common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                        common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
-                        common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                    stem<string_typeT>::is_suffix(text,
-                        /*ible*/
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                        common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
-                        common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                    stem<string_typeT>::is_suffix(text,
-                        /*ment*/
-                        common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                        common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) ||
-                    stem<string_typeT>::is_suffix(text,
-                        /*ence*/
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                        common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                    stem<string_typeT>::is_suffix(text,
-                        /*ance*/
-                        common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                        common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E)) )
+                    (tail.ends_with("able") ||
+                    tail.ends_with("ible") ||
+                    tail.ends_with("ment") ||
+                    tail.ends_with("ence") ||
+                    tail.ends_with("ance")) )
                 {
-                if (stem<string_typeT>::get_r2() <= text.length()-4)
+                if (stem<string_typeT, policyT>::get_r2() <= text.length()-4)
                     {
                     text.erase(text.length()-4);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             else if (text.length() >= 4 &&
-                    (stem<string_typeT>::is_suffix(text,
-                        /*sion*/
-                        common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                        common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ||
-                    stem<string_typeT>::is_suffix(text,
-                        /*tion*/
-                        common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                        common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N)) )
+                    (tail.ends_with("sion") ||
+                    tail.ends_with("tion")) )
                 {
-                if (stem<string_typeT>::get_r2() <= text.length()-3)
+                if (stem<string_typeT, policyT>::get_r2() <= text.length()-3)
                     {
                     text.erase(text.length()-3);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             else if (text.length() >= 3 &&
-                    (stem<string_typeT>::is_suffix(text,
-                        /*ant*/
-                        common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                        common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) ||
-                    stem<string_typeT>::is_suffix(text,
-                        /*ent*/
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                        common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) ||
-                    stem<string_typeT>::is_suffix(text,
-                        /*ism*/
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                        common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                        common_lang_constants::LOWER_M, common_lang_constants::UPPER_M) ||
-                    stem<string_typeT>::is_suffix(text,
-                        /*ate*/
-                        common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                        common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                    stem<string_typeT>::is_suffix(text,
-                        /*iti*/
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                        common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                    stem<string_typeT>::is_suffix(text,
-                        /*ous*/
-                        common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                        common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
-                        common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) ||
-                    stem<string_typeT>::is_suffix(text,
-                        /*ive*/
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                        common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                    stem<string_typeT>::is_suffix(text,
-                        /*ize*/
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                        common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z,
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E)) )
+                    (tail.ends_with("ant") ||
+                    tail.ends_with("ent") ||
+                    tail.ends_with("ism") ||
+                    tail.ends_with("ate") ||
+                    tail.ends_with("iti") ||
+                    tail.ends_with("ous") ||
+                    tail.ends_with("ive") ||
+                    tail.ends_with("ize")) )
                 {
-                if (stem<string_typeT>::get_r2() <= text.length()-3)
+                if (stem<string_typeT, policyT>::get_r2() <= text.length()-3)
                     {
                     text.erase(text.length()-3);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             else if (text.length() >= 2 &&
-                    (stem<string_typeT>::is_suffix(text,
-                        /*al*/
-                        common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                        common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) ||
-                    stem<string_typeT>::is_suffix(text,
-                        /*er*/
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                        common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) ||
-                    stem<string_typeT>::is_suffix(text,
-                        /*ic*/
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                        common_lang_constants::LOWER_C, common_lang_constants::UPPER_C)) )
+                    (tail.ends_with("al") ||
+                    tail.ends_with("er") ||
+                    tail.ends_with("ic")) )
                 {
-                if (stem<string_typeT>::get_r2() <= text.length()-2)
+                if (stem<string_typeT, policyT>::get_r2() <= text.length()-2)
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             }
@@ -1391,33 +854,37 @@ namespace stemming
         //---------------------------------------------
         void step_5(string_typeT& text)
             {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "english::step_5");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_5_ENDINGS))
+                { return; }
             if (text.length() >= 1 &&
-                stem<string_typeT>::is_either(text[text.length()-1],
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1],
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                 {
-                if (stem<string_typeT>::get_r2() != text.length())
+                if (stem<string_typeT, policyT>::get_r2() != text.length())
                     {
                     text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
-                else if (stem<string_typeT>::get_r1() != text.length() &&
+                else if (stem<string_typeT, policyT>::get_r1() != text.length() &&
                     text.length() >= 2 &&
                     // look at the part of the word in front of the last 'e' to see if it ends with
                     // a short syllable.
                     !ends_with_short_syllable(text, text.length()-1))
                     {
                     text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
-            else if (stem<string_typeT>::get_r2() != text.length() &&
-                stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::get_r2() != text.length() &&
+                stem<string_typeT, policyT>::is_suffix(text,
                     /*ll*/
                     common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                     common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
             }
 
@@ -1441,13 +908,13 @@ namespace stemming
                 }
             else if (length == 4 &&
                 /*past*/
-                (stem<string_typeT>::is_either(text[0],
+                (stem<string_typeT, policyT>::is_either_case(text[0],
                     common_lang_constants::LOWER_P, common_lang_constants::UPPER_P) &&
-                 stem<string_typeT>::is_either(text[1],
+                 stem<string_typeT, policyT>::is_either_case(text[1],
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                 stem<string_typeT>::is_either(text[2],
+                 stem<string_typeT, policyT>::is_either_case(text[2],
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) &&
-                 stem<string_typeT>::is_either(text[3],
+                 stem<string_typeT, policyT>::is_either_case(text[3],
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T)))
                 {
                 return true;
@@ -1461,8 +928,8 @@ namespace stemming
                     start == (length-2) &&
                     // following letter
                     (!is_vowel(text[start+1]) &&
-                    !stem<string_typeT>::is_one_of(text[start+1], L"wxWX") &&
-                    stem<string_typeT>::is_neither(text[start+1], LOWER_Y_HASH, UPPER_Y_HASH)) &&
+                    !stem<string_typeT, policyT>::is_one_of(text[start+1], L"wxWX") &&
+                    stem<string_typeT, policyT>::is_neither(text[start+1], LOWER_Y_HASH, UPPER_Y_HASH)) &&
                     // proceeding letter
                     !is_vowel(text[start-1]) )
                     { return true; }
@@ -1478,14 +945,39 @@ namespace stemming
         inline bool is_short_word(const string_typeT& text, const size_t length) const
             {
             return (ends_with_short_syllable(text, length) &&
-                    stem<string_typeT>::get_r1() == text.length());
+                    stem<string_typeT, policyT>::get_r1() == text.length());
+            }
+
+        /// @returns The packed end of the word, for comparing against suffixes.
+        //---------------------------------------------
+        [[nodiscard]]
+        packed_tail pack_tail(const string_typeT& text) const noexcept
+            {
+            return m_is_ascii ? packed_tail::pack<true>(text) : packed_tail::pack<false>(text);
             }
 
         //---------------------------------------------
         inline bool is_vowel(const wchar_t character) const noexcept
-            { return (stem<string_typeT>::is_one_of(character, L"aeiouyAEIOUY") ); }
+            { return (stem<string_typeT, policyT>::is_one_of(character, L"aeiouyAEIOUY") ); }
+
+        // the prefixes which R1 begins after
+        static constexpr prefix_trie<43> R1_PREFIXES{ L"gener", L"commun", L"arsen", L"past",
+                                                      L"univers", L"later", L"emerg", L"organ" };
+
+        // the characters that the suffixes of each step can end with
+        static constexpr character_bitmap STEP_1A_ENDINGS{ L"sd" };
+        static constexpr character_bitmap STEP_1B_ENDINGS{ L"dgy" };
+        static constexpr character_bitmap STEP_1C_ENDINGS{ common_lang_constants::LOWER_Y,
+                                                           LOWER_Y_HASH, UPPER_Y_HASH };
+        static constexpr character_bitmap STEP_2_ENDINGS{ L"ilmnrst" };
+        static constexpr character_bitmap STEP_3_ENDINGS{ L"eils" };
+        static constexpr character_bitmap STEP_4_ENDINGS{ L"ceilmnrst" };
+        static constexpr character_bitmap STEP_5_ENDINGS{ L"el" };
+        static constexpr character_bitmap ALL_STEP_ENDINGS{ STEP_1A_ENDINGS | STEP_1B_ENDINGS |
+            STEP_1C_ENDINGS | STEP_2_ENDINGS | STEP_3_ENDINGS | STEP_4_ENDINGS | STEP_5_ENDINGS };
 
         size_t m_first_vowel{ string_typeT::npos };
+        bool m_is_ascii{ false };
         };
     }
 
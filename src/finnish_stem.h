@@ -20,8 +20,8 @@ namespace stemming
     @brief Finnish stemmer.
     */
     //------------------------------------------------------
-    template <typename string_typeT = std::wstring>
-    class finnish_stem final : public stem<string_typeT>
+    template <typename string_typeT = std::wstring, typename policyT = default_stem_policy>
+    class finnish_stem final : public stem<string_typeT, policyT>
         {
     public:
         /** @brief Stems a Finnish word.
@@ -30,16 +30,24 @@ namespace stemming
             {
             // reset internal data
             m_step_3_successful = false;
-            stem<string_typeT>::reset_r_values();
+            stem<string_typeT, policyT>::reset_r_values();
 
-            std::transform(text.begin(), text.end(), text.begin(), full_width_to_narrow);
-            stem<string_typeT>::remove_possessive_suffix(text);
+            stem<string_typeT, policyT>::normalize_input(text);
+            stem<string_typeT, policyT>::remove_possessive_suffix(text);
 
             if (text.length() < 2)
                 { return; }
 
-            stem<string_typeT>::find_r1(text, FINNISH_VOWELS);
-            stem<string_typeT>::find_r2(text, FINNISH_VOWELS);
+            stem<string_typeT, policyT>::find_r1(text, FINNISH_VOWELS);
+            stem<string_typeT, policyT>::find_r2(text, FINNISH_VOWELS);
+
+            // light stemming only removes the case endings (step 3) and plurals (step 5)
+            if constexpr (policyT::light_stemming)
+                {
+                step_3(text);
+                step_5(text);
+                return;
+                }
 
             step_1(text);
             step_2(text);
@@ -56,13 +64,17 @@ namespace stemming
         //---------------------------------------------
         void step_1(string_typeT& text)
             {
-            if (stem<string_typeT>::is_suffix_in_r1(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "finnish::step_1");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_1_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                     /*kaan*/
                     common_lang_constants::LOWER_K, common_lang_constants::UPPER_K,
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ||
-                stem<string_typeT>::is_suffix_in_r1(text,
+                stem<string_typeT, policyT>::is_suffix_in_r1(text,
                     /*kään*/
                     common_lang_constants::LOWER_K, common_lang_constants::UPPER_K,
                     common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS,
@@ -70,72 +82,72 @@ namespace stemming
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) )
                 {
                 if (text.length() >= 5 &&
-                    stem<string_typeT>::is_one_of(text[text.length()-5], FINNISH_STEP_1_SUFFIX) )
+                    stem<string_typeT, policyT>::is_one_of(text[text.length()-5], FINNISH_STEP_1_SUFFIX) )
                     {
                     text.erase(text.length()-4);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                     /*kin*/
                     common_lang_constants::LOWER_K, common_lang_constants::UPPER_K,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ||
-                stem<string_typeT>::is_suffix_in_r1(text,
+                stem<string_typeT, policyT>::is_suffix_in_r1(text,
                     /*han*/
                     common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ||
-                stem<string_typeT>::is_suffix_in_r1(text,
+                stem<string_typeT, policyT>::is_suffix_in_r1(text,
                     /*hän*/
                     common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
                     common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) )
                 {
                 if (text.length() >= 4 &&
-                    stem<string_typeT>::is_one_of(text[text.length()-4], FINNISH_STEP_1_SUFFIX) )
+                    stem<string_typeT, policyT>::is_one_of(text[text.length()-4], FINNISH_STEP_1_SUFFIX) )
                     {
                     text.erase(text.length()-3);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                     /*sti*/
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
                 {
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*sti*/
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I);
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                     /*ko*/
                     common_lang_constants::LOWER_K, common_lang_constants::UPPER_K,
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) ||
-                stem<string_typeT>::is_suffix_in_r1(text,
+                stem<string_typeT, policyT>::is_suffix_in_r1(text,
                     /*kö*/
                     common_lang_constants::LOWER_K, common_lang_constants::UPPER_K,
                     common_lang_constants::LOWER_O_UMLAUTS, common_lang_constants::UPPER_O_UMLAUTS) ||
-                stem<string_typeT>::is_suffix_in_r1(text,
+                stem<string_typeT, policyT>::is_suffix_in_r1(text,
                     /*pa*/
                     common_lang_constants::LOWER_P, common_lang_constants::UPPER_P,
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) ||
-                stem<string_typeT>::is_suffix_in_r1(text,
+                stem<string_typeT, policyT>::is_suffix_in_r1(text,
                     /*pä*/
                     common_lang_constants::LOWER_P, common_lang_constants::UPPER_P,
                     common_lang_constants:: LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS) )
                 {
                 if (text.length() >= 3 &&
-                    stem<string_typeT>::is_one_of(text[text.length()-3], FINNISH_STEP_1_SUFFIX) )
+                    stem<string_typeT, policyT>::is_one_of(text[text.length()-3], FINNISH_STEP_1_SUFFIX) )
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
@@ -143,22 +155,26 @@ namespace stemming
         //---------------------------------------------
         void step_2(string_typeT& text)
             {
-            if (stem<string_typeT>::delete_if_is_in_r1(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "finnish::step_2");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_2_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                     /*nsa*/
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) ||
-                stem<string_typeT>::delete_if_is_in_r1(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                     /*nsä*/
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                     common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS, false) ||
-                stem<string_typeT>::delete_if_is_in_r1(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                     /*mme*/
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) ||
-                stem<string_typeT>::delete_if_is_in_r1(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                     /*nne*/
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -166,7 +182,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /*si*/
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
@@ -176,16 +192,16 @@ namespace stemming
                       text[text.length()-3] == common_lang_constants::UPPER_K))
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*ni*/
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I, false) )
                 {
-                if (stem<string_typeT>::is_suffix(text,
+                if (stem<string_typeT, policyT>::is_suffix(text,
                     /*kse*/
                     common_lang_constants::LOWER_K, common_lang_constants::UPPER_K,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -195,93 +211,93 @@ namespace stemming
                     }
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /*an*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) )
                 {
                 if ((text.length() >= 4 &&
-                    (stem<string_typeT>::is_partial_suffix(text, (text.length()-4),
+                    (stem<string_typeT, policyT>::is_partial_suffix(text, (text.length()-4),
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) ||
-                    stem<string_typeT>::is_partial_suffix(text, (text.length()-4),
+                    stem<string_typeT, policyT>::is_partial_suffix(text, (text.length()-4),
                         common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A)) ) ||
                     (text.length() >= 5 &&
-                    (stem<string_typeT>::is_partial_suffix(text, (text.length()-5),
+                    (stem<string_typeT, policyT>::is_partial_suffix(text, (text.length()-5),
                         common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                         common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) ||
-                    stem<string_typeT>::is_partial_suffix(text, (text.length()-5),
+                    stem<string_typeT, policyT>::is_partial_suffix(text, (text.length()-5),
                         common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) ||
-                    stem<string_typeT>::is_partial_suffix(text, (text.length()-5),
+                    stem<string_typeT, policyT>::is_partial_suffix(text, (text.length()-5),
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) ||
-                    stem<string_typeT>::is_partial_suffix(text, (text.length()-5),
+                    stem<string_typeT, policyT>::is_partial_suffix(text, (text.length()-5),
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) ) ) )
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /*än*/
                 common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) )
                 {
                 if ((text.length() >= 4 &&
-                    (stem<string_typeT>::is_partial_suffix(text, (text.length()-4),
+                    (stem<string_typeT, policyT>::is_partial_suffix(text, (text.length()-4),
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                         common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS) ||
-                    stem<string_typeT>::is_partial_suffix(text, (text.length()-4),
+                    stem<string_typeT, policyT>::is_partial_suffix(text, (text.length()-4),
                         common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                         common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS)) ) ||
                     (text.length() >= 5 &&
-                    (stem<string_typeT>::is_partial_suffix(text, (text.length()-5),
+                    (stem<string_typeT, policyT>::is_partial_suffix(text, (text.length()-5),
                         common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                         common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                         common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS) ||
-                    stem<string_typeT>::is_partial_suffix(text, (text.length()-5),
+                    stem<string_typeT, policyT>::is_partial_suffix(text, (text.length()-5),
                         common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                         common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS) ||
-                    stem<string_typeT>::is_partial_suffix(text, (text.length()-5),
+                    stem<string_typeT, policyT>::is_partial_suffix(text, (text.length()-5),
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                         common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS) ||
-                    stem<string_typeT>::is_partial_suffix(text, (text.length()-5),
+                    stem<string_typeT, policyT>::is_partial_suffix(text, (text.length()-5),
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                         common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS) ) ) )
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                     /*en*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) )
                 {
                 if (text.length() >= 5 &&
-                    (stem<string_typeT>::is_partial_suffix(text, (text.length()-5),
+                    (stem<string_typeT, policyT>::is_partial_suffix(text, (text.length()-5),
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                    stem<string_typeT>::is_partial_suffix(text, (text.length()-5),
+                    stem<string_typeT, policyT>::is_partial_suffix(text, (text.length()-5),
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ) )
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
@@ -289,283 +305,174 @@ namespace stemming
         //---------------------------------------------
         void step_3(string_typeT& text)
             {
-            // seen followed by LV
-            if (text.length() >= 6 &&
-                stem<string_typeT>::is_suffix_in_r1(text,
-                    /*seen*/
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                stem<string_typeT>::is_one_of(text[text.length()-5], FINNISH_VOWELS_NO_Y) &&
-                stem<string_typeT>::tolower_western(text[text.length()-5]) ==
-                    stem<string_typeT>::tolower_western(text[text.length()-6]) )
-                {
-                text.erase(text.length()-4);
-                stem<string_typeT>::update_r_sections(text);
-                m_step_3_successful = true;
-                return;
-                }
-            // suffix followed by Vi
-            else if (text.length() >= 6 &&
-                    stem<string_typeT>::is_either(text[text.length()-5],
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    (stem<string_typeT>::is_suffix_in_r1(text,
-                        /*siin*/
-                        common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ||
-                    stem<string_typeT>::is_suffix_in_r1(text,
-                        /*tten*/
-                        common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                        common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ) &&
-                    stem<string_typeT>::is_one_of(text[text.length()-6], FINNISH_VOWELS_NO_Y) )
-                {
-                text.erase(text.length()-4);
-                stem<string_typeT>::update_r_sections(text);
-                m_step_3_successful = true;
-                return;
-                }
-            // suffix followed by Vi
-            else if (text.length() >= 5 &&
-                    stem<string_typeT>::is_either(text[text.length()-4],
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_suffix_in_r1(text,
-                        /*den*/
-                        common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                    stem<string_typeT>::is_one_of(text[text.length()-5], FINNISH_VOWELS_NO_Y) )
-                {
-                text.erase(text.length()-3);
-                stem<string_typeT>::update_r_sections(text);
-                m_step_3_successful = true;
-                return;
-                }
-            else if (
-                (stem<string_typeT>::is_suffix_in_r1(text,
-                    /*tta*/
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) ||
-                stem<string_typeT>::is_suffix_in_r1(text,
-                    /*ttä*/
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS)) &&
-                stem<string_typeT>::is_either(text[text.length()-4],
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "finnish::step_3");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_3_ENDINGS))
+                { return; }
+            const size_t length{ text.length() };
+            const size_t r1{ stem<string_typeT, policyT>::get_r1() };
+            // the lowercased letter at a position counted from the end of the word
+            // (1 being the last letter), or zero if the word isn't that long
+            const auto from_end = [&text, length](const size_t position) noexcept
                 {
-                text.erase(text.length()-3);
-                stem<string_typeT>::update_r_sections(text);
-                m_step_3_successful = true;
-                return;
-                }
-            // ends if VHVN
-            else if (
-                (stem<string_typeT>::is_suffix_in_r1(text,
-                    /*han*/
-                    common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ||
-                stem<string_typeT>::is_suffix_in_r1(text,
-                    /*hen*/
-                    common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ||
-                stem<string_typeT>::is_suffix_in_r1(text,
-                    /*hin*/
-                    common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ||
-                stem<string_typeT>::is_suffix_in_r1(text,
-                    /*hon*/
-                    common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                    common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ||
-                stem<string_typeT>::is_suffix_in_r1(text,
-                    /*hän*/
-                    common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                    common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS,
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ||
-                stem<string_typeT>::is_suffix_in_r1(text,
-                    /*hön*/
-                    common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                    common_lang_constants::LOWER_O_UMLAUTS, common_lang_constants::UPPER_O_UMLAUTS,
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ) )
+                return (position <= length) ? to_lower(text[length - position]) : wchar_t{ 0 };
+                };
+            // whether the last letters are in R1
+            const auto in_r1 = [length, r1](const size_t suffix_length) noexcept
+                { return (length >= suffix_length && r1 <= length - suffix_length); };
+
+            // the suffixes are read from the end of the word, and the number of letters
+            // to remove is settled before anything is removed
+            size_t removed{ 0 };
+            const wchar_t last{ from_end(1) };
+            const wchar_t second_last{ from_end(2) };
+            const wchar_t third_last{ from_end(3) };
+            if (last == common_lang_constants::LOWER_N)
                 {
-                if (stem<string_typeT>::tolower_western(text[text.length()-2]) ==
-                        stem<string_typeT>::tolower_western(text[text.length()-4]) )
+                // seen followed by LV
+                if (length >= 6 && in_r1(4) &&
+                    from_end(4) == common_lang_constants::LOWER_S &&
+                    third_last == common_lang_constants::LOWER_E &&
+                    second_last == common_lang_constants::LOWER_E &&
+                    VOWELS_NO_Y.contains(from_end(5)) &&
+                    from_end(5) == from_end(6))
+                    { removed = 4; }
+                // siin or tten followed by Vi
+                else if (length >= 6 && in_r1(4) &&
+                    from_end(5) == common_lang_constants::LOWER_I &&
+                    ((from_end(4) == common_lang_constants::LOWER_S &&
+                      third_last == common_lang_constants::LOWER_I &&
+                      second_last == common_lang_constants::LOWER_I) ||
+                     (from_end(4) == common_lang_constants::LOWER_T &&
+                      third_last == common_lang_constants::LOWER_T &&
+                      second_last == common_lang_constants::LOWER_E)) &&
+                    VOWELS_NO_Y.contains(from_end(6)))
+                    { removed = 4; }
+                // den followed by Vi
+                else if (length >= 5 && in_r1(3) &&
+                    from_end(4) == common_lang_constants::LOWER_I &&
+                    third_last == common_lang_constants::LOWER_D &&
+                    second_last == common_lang_constants::LOWER_E &&
+                    VOWELS_NO_Y.contains(from_end(5)))
+                    { removed = 3; }
+                // VHVN
+                else if (in_r1(3) && third_last == common_lang_constants::LOWER_H &&
+                    HVN_VOWELS.contains(second_last))
                     {
-                    text.erase(text.length()-3);
-                    stem<string_typeT>::update_r_sections(text);
-                    m_step_3_successful = true;
+                    if (second_last != from_end(4))
+                        { return; }
+                    removed = 3;
+                    }
+                // n, followed by LV or ie
+                else if (in_r1(1))
+                    {
+                    removed = (length >= 3 &&
+                               ((VOWELS_NO_Y.contains(second_last) && second_last == third_last) ||
+                                (in_r1(3) && third_last == common_lang_constants::LOWER_I &&
+                                 second_last == common_lang_constants::LOWER_E))) ? 2 : 1;
                     }
-                return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                    /*ssa*/
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) ||
-                stem<string_typeT>::delete_if_is_in_r1(text,
-                    /*ssä*/
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                    common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS, false) ||
-                stem<string_typeT>::delete_if_is_in_r1(text,
-                    /*sta*/
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) ||
-                stem<string_typeT>::delete_if_is_in_r1(text,
-                    /*stä*/
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS, false) ||
-                stem<string_typeT>::delete_if_is_in_r1(text,
-                    /*lla*/
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) ||
-                stem<string_typeT>::delete_if_is_in_r1(text,
-                    /*llä*/
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS, false) ||
-                stem<string_typeT>::delete_if_is_in_r1(text,
-                    /*lta*/
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) ||
-                stem<string_typeT>::delete_if_is_in_r1(text,
-                    /*ltä*/
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS, false) ||
-                stem<string_typeT>::delete_if_is_in_r1(text,
-                    /*lle*/
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) ||
-                stem<string_typeT>::delete_if_is_in_r1(text,
-                    /*ksi*/
-                    common_lang_constants::LOWER_K, common_lang_constants::UPPER_K,
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I, false) ||
-                stem<string_typeT>::delete_if_is_in_r1(text,
-                    /*ine*/
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) ||
-                stem<string_typeT>::delete_if_is_in_r1(text,
-                    /*na*/
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) ||
-                stem<string_typeT>::delete_if_is_in_r1(text,
-                    /*nä*/
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                    common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS, false) )
+            else if (last == common_lang_constants::LOWER_A ||
+                     last == common_lang_constants::LOWER_A_UMLAUTS)
                 {
-                m_step_3_successful = true;
-                return;
+                // tta or ttä followed by e
+                if (in_r1(3) && third_last == common_lang_constants::LOWER_T &&
+                    second_last == common_lang_constants::LOWER_T &&
+                    from_end(4) == common_lang_constants::LOWER_E)
+                    { removed = 3; }
+                // ssa, sta, lla, and lta (or with ä)
+                else if (in_r1(3) &&
+                    ((third_last == common_lang_constants::LOWER_S &&
+                      (second_last == common_lang_constants::LOWER_S ||
+                       second_last == common_lang_constants::LOWER_T)) ||
+                     (third_last == common_lang_constants::LOWER_L &&
+                      (second_last == common_lang_constants::LOWER_L ||
+                       second_last == common_lang_constants::LOWER_T))))
+                    { removed = 3; }
+                // na and ta (or with ä)
+                else if (in_r1(2) &&
+                    (second_last == common_lang_constants::LOWER_N ||
+                     second_last == common_lang_constants::LOWER_T))
+                    { removed = 2; }
+                // a or ä, followed by cv
+                else if (length >= 3 && in_r1(1) &&
+                    !VOWELS.contains(third_last) && VOWELS.contains(second_last))
+                    { removed = 1; }
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                    /*ta*/
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) ||
-                stem<string_typeT>::delete_if_is_in_r1(text,
-                    /*tä*/
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS, false) )
+            // lle and ine
+            else if (last == common_lang_constants::LOWER_E)
                 {
-                m_step_3_successful = true;
-                return;
+                if (in_r1(3) &&
+                    ((third_last == common_lang_constants::LOWER_L &&
+                      second_last == common_lang_constants::LOWER_L) ||
+                     (third_last == common_lang_constants::LOWER_I &&
+                      second_last == common_lang_constants::LOWER_N)))
+                    { removed = 3; }
                 }
-            // suffix followed by cv
-            else if (text.length() >= 3 &&
-                    (stem<string_typeT>::is_suffix_in_r1(text, common_lang_constants::LOWER_A,
-                                                         common_lang_constants::UPPER_A) ||
-                        stem<string_typeT>::is_suffix_in_r1(text, common_lang_constants::LOWER_A_UMLAUTS,
-                                                            common_lang_constants::UPPER_A_UMLAUTS) ) &&
-                    !stem<string_typeT>::is_one_of(text[text.length()-3], FINNISH_VOWELS) &&
-                    stem<string_typeT>::is_one_of(text[text.length()-2], FINNISH_VOWELS) )
+            // ksi
+            else if (last == common_lang_constants::LOWER_I)
                 {
-                text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
-                m_step_3_successful = true;
-                return;
+                if (in_r1(3) && third_last == common_lang_constants::LOWER_K &&
+                    second_last == common_lang_constants::LOWER_S)
+                    { removed = 3; }
                 }
-            // suffix followed by LV or ie
-            else if (stem<string_typeT>::is_suffix_in_r1(text, common_lang_constants::LOWER_N,
-                                                         common_lang_constants::UPPER_N) )
+
+            if (removed != 0)
                 {
-                text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
-                if (text.length() >= 2 &&
-                    ((stem<string_typeT>::is_one_of(text[text.length()-1], FINNISH_VOWELS_NO_Y) &&
-                      stem<string_typeT>::tolower_western(text[text.length()-1]) ==
-                        stem<string_typeT>::tolower_western(text[text.length()-2])) ||
-                     stem<string_typeT>::is_suffix_in_r1(text,
-                         /*ie*/
-                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E)) )
-                    {
-                    text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
-                    }
+                text.erase(length - removed);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 m_step_3_successful = true;
-                return;
                 }
             }
         //---------------------------------------------
         void step_4(string_typeT& text)
             {
-            if (stem<string_typeT>::delete_if_is_in_r2(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "finnish::step_4");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_4_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*impi*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                     common_lang_constants::LOWER_P, common_lang_constants::UPPER_P,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I, false) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*impa*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                     common_lang_constants::LOWER_P, common_lang_constants::UPPER_P,
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*impä*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                     common_lang_constants::LOWER_P, common_lang_constants::UPPER_P,
                     common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS, false) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*immi*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I, false) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*imma*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*immä*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                     common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS, false) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*eja*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_J, common_lang_constants::UPPER_J,
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ejä*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_J, common_lang_constants::UPPER_J,
@@ -574,44 +481,44 @@ namespace stemming
                 return;
                 }
             else if (text.length() >= 5 &&
-                    (stem<string_typeT>::is_suffix_in_r2(text,
+                    (stem<string_typeT, policyT>::is_suffix_in_r2(text,
                         /*mpi*/
                         common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                         common_lang_constants::LOWER_P, common_lang_constants::UPPER_P,
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                    stem<string_typeT>::is_suffix_in_r2(text,
+                    stem<string_typeT, policyT>::is_suffix_in_r2(text,
                         /*mpa*/
                         common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                         common_lang_constants::LOWER_P, common_lang_constants::UPPER_P,
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) ||
-                    stem<string_typeT>::is_suffix_in_r2(text,
+                    stem<string_typeT, policyT>::is_suffix_in_r2(text,
                         /*mpä*/
                         common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                         common_lang_constants::LOWER_P, common_lang_constants::UPPER_P,
                         common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS) ||
-                    stem<string_typeT>::is_suffix_in_r2(text,
+                    stem<string_typeT, policyT>::is_suffix_in_r2(text,
                         /*mmi*/
                         common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                         common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                    stem<string_typeT>::is_suffix_in_r2(text,
+                    stem<string_typeT, policyT>::is_suffix_in_r2(text,
                         /*mma*/
                         common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                         common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) ||
-                    stem<string_typeT>::is_suffix_in_r2(text,
+                    stem<string_typeT, policyT>::is_suffix_in_r2(text,
                         /*mmä*/
                         common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                         common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                         common_lang_constants::LOWER_A_UMLAUTS, common_lang_constants::UPPER_A_UMLAUTS) ) )
                 {
-                if (!(stem<string_typeT>::is_either(text[text.length()-5],
+                if (!(stem<string_typeT, policyT>::is_either_case(text[text.length()-5],
                         common_lang_constants::LOWER_P, common_lang_constants::UPPER_P) &&
-                    stem<string_typeT>::is_either(text[text.length()-4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4],
                         common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) ) )
                     {
                     text.erase(text.length()-3);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             return;
@@ -619,12 +526,16 @@ namespace stemming
         //---------------------------------------------
         void step_5(string_typeT& text)
             {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "finnish::step_5");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_5_ENDINGS))
+                { return; }
             // if step 3 was successful in removing a suffix
             if (m_step_3_successful)
                 {
-                if (stem<string_typeT>::delete_if_is_in_r1(text,
+                if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                    stem<string_typeT>::delete_if_is_in_r1(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                         common_lang_constants::LOWER_J, common_lang_constants::UPPER_J) )
                     {
                     // NOOP
@@ -633,12 +544,12 @@ namespace stemming
             else
                 {
                 if (text.length() >= 2 &&
-                    stem<string_typeT>::is_one_of(text[text.length()-2], FINNISH_VOWELS) )
+                    stem<string_typeT, policyT>::is_one_of(text[text.length()-2], FINNISH_VOWELS) )
                     {
-                    if (stem<string_typeT>::delete_if_is_in_r1(text,
+                    if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                         {
-                        if (!stem<string_typeT>::delete_if_is_in_r2(text,
+                        if (!stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                             /*imma*/
                             common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                             common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -646,19 +557,19 @@ namespace stemming
                             common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) )
                             {
                             if (text.length() >= 5 &&
-                                stem<string_typeT>::is_suffix_in_r2(text,
+                                stem<string_typeT, policyT>::is_suffix_in_r2(text,
                                     /*mma*/
                                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
                                 // isn't proceeded by "po"
-                                !(stem<string_typeT>::is_either(text[text.length()-5],
+                                !(stem<string_typeT, policyT>::is_either_case(text[text.length()-5],
                                     common_lang_constants::LOWER_P, common_lang_constants::UPPER_P) &&
-                                  stem<string_typeT>::is_either(text[text.length()-4],
+                                  stem<string_typeT, policyT>::is_either_case(text[text.length()-4],
                                       common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) ) )
                                 {
                                 text.erase(text.length()-3);
-                                stem<string_typeT>::update_r_sections(text);
+                                stem<string_typeT, policyT>::update_r_sections(text);
                                 }
                             }
                         }
@@ -666,84 +577,82 @@ namespace stemming
                 }
             }
         //---------------------------------------------
+        /** @brief Step 6 (parts a through e).
+            @details Each part shortens the word that the previous one left, so they
+                are applied to a moving end position and the word is truncated once.
+            @param[in,out] text The word being stemmed.*/
         void step_6(string_typeT& text)
             {
-            step_6a(text);
-            step_6b(text);
-            step_6c(text);
-            step_6d(text);
-            step_6e(text);
-            }
-        //---------------------------------------------
-        void step_6a(string_typeT& text)
-            {
-            if (text.length() >= 2 &&
-                stem<string_typeT>::get_r1() <= text.length()-2 &&
-                stem<string_typeT>::is_one_of(text[text.length()-1], FINNISH_VOWELS_NO_Y) &&
-                stem<string_typeT>::tolower_western(text[text.length()-1]) ==
-                    stem<string_typeT>::tolower_western(text[text.length()-2]))
-                {
-                text.erase(text.end()-1);
-                stem<string_typeT>::update_r_sections(text);
-                }
-            }
-        //---------------------------------------------
-        void step_6b(string_typeT& text)
-            {
-            if (text.length() >= 2 &&
-                stem<string_typeT>::get_r1() <= text.length()-2 &&
-                stem<string_typeT>::is_one_of(text[text.length()-2], FINNISH_CONSONANTS) &&
-                stem<string_typeT>::is_one_of(text[text.length()-1], FINNISH_VOWELS_SIMPLE) )
-                {
-                text.erase(text.end()-1);
-                stem<string_typeT>::update_r_sections(text);
-                }
-            }
-        //---------------------------------------------
-        void step_6c(string_typeT& text)
-            {
-            if (stem<string_typeT>::is_suffix_in_r1(text,
-                    /*oj*/
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                    common_lang_constants::LOWER_J, common_lang_constants::UPPER_J) ||
-                stem<string_typeT>::is_suffix_in_r1(text,
-                    /*uj*/
-                    common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
-                    common_lang_constants::LOWER_J, common_lang_constants::UPPER_J) )
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "finnish::step_6");
+            const size_t r1{ stem<string_typeT, policyT>::get_r1() };
+            size_t end{ text.length() };
+            // whether the last two letters before the end are in R1
+            const auto in_r1 = [&end, r1]() noexcept
+                { return (end >= 2 && r1 <= end - 2); };
+
+            // a: a long vowel (other than yy) in R1 is shortened
+            if (in_r1() && VOWELS_NO_Y.contains(text[end - 1]) &&
+                to_lower(text[end - 1]) == to_lower(text[end - 2]))
+                { --end; }
+            // b: a, e, i, or ä after a consonant in R1 is removed
+            if (in_r1() && CONSONANTS.contains(text[end - 2]) &&
+                VOWELS_SIMPLE.contains(text[end - 1]))
+                { --end; }
+            // c: the j of oj or uj in R1 is removed
+            if (in_r1() && to_lower(text[end - 1]) == common_lang_constants::LOWER_J &&
+                (to_lower(text[end - 2]) == common_lang_constants::LOWER_O ||
+                 to_lower(text[end - 2]) == common_lang_constants::LOWER_U))
+                { --end; }
+            // d: the o of jo in R1 is removed
+            if (in_r1() && to_lower(text[end - 1]) == common_lang_constants::LOWER_O &&
+                to_lower(text[end - 2]) == common_lang_constants::LOWER_J)
+                { --end; }
+            // e: if the last non-vowel is a doubled consonant, then one of them is removed
+            size_t last_consonant{ end };
+            while (last_consonant > 0 && VOWELS.contains(text[last_consonant - 1]))
+                { --last_consonant; }
+            if (last_consonant >= 2 && CONSONANTS.contains(text[last_consonant - 1]) &&
+                to_lower(text[last_consonant - 1]) == to_lower(text[last_consonant - 2]))
                 {
-                text.erase(text.end()-1);
-                stem<string_typeT>::update_r_sections(text);
+                std::copy(text.cbegin() + last_consonant, text.cbegin() + end,
+                          text.begin() + (last_consonant - 1));
+                --end;
                 }
-            }
-        //---------------------------------------------
-        void step_6d(string_typeT& text)
-            {
-            if (stem<string_typeT>::is_suffix_in_r1(text,/*jo*/common_lang_constants::LOWER_J,
-                common_lang_constants::UPPER_J, common_lang_constants::LOWER_O,
-                common_lang_constants::UPPER_O) )
+
+            if (end < text.length())
                 {
-                text.erase(text.end()-1);
-                stem<string_typeT>::update_r_sections(text);
+                text.erase(end);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
             }
-        //---------------------------------------------
-        void step_6e(string_typeT& text)
+
+        /// @returns @c ch lowercased, unless the policy has already lowercased the text.
+        [[nodiscard]]
+        static constexpr wchar_t to_lower(const wchar_t ch) noexcept
             {
-            // find the last consonant
-            const size_t index = text.find_last_not_of(FINNISH_VOWELS);
-            if (index == string_typeT::npos ||
-                index < 1)
-                { return; }
-            if (stem<string_typeT>::is_one_of(text[index], FINNISH_CONSONANTS) &&
-                stem<string_typeT>::tolower_western(text[index]) ==
-                    stem<string_typeT>::tolower_western(text[index-1]))
-                {
-                text.erase(index, 1);
-                stem<string_typeT>::update_r_sections(text);
-                }
+            return stem<string_typeT, policyT>::is_lowercased_text() ?
+                ch : stem<string_typeT, policyT>::tolower_western(ch);
             }
+
         // internal data specific to Finnish stemmer
         bool m_step_3_successful{ false };
+
+        // the characters that the suffixes of each step can end with
+        // (step 6 is always run, as 6e looks at the last consonant anywhere in the word)
+        static constexpr character_bitmap STEP_1_ENDINGS{ L"ainoäö" };
+        static constexpr character_bitmap STEP_2_ENDINGS{ L"aeinä" };
+        static constexpr character_bitmap STEP_3_ENDINGS{ L"aeinä" };
+        static constexpr character_bitmap STEP_4_ENDINGS{ L"aiä" };
+        static constexpr character_bitmap STEP_5_ENDINGS{ L"aijt" };
+
+        // the letter classes that steps 3 and 6 read the end of the word with
+        static constexpr character_bitmap VOWELS{ L"aeiouyäö" };
+        static constexpr character_bitmap VOWELS_NO_Y{ FINNISH_VOWELS_NO_Y };
+        static constexpr character_bitmap VOWELS_SIMPLE{ FINNISH_VOWELS_SIMPLE };
+        static constexpr character_bitmap CONSONANTS{ FINNISH_CONSONANTS };
+        // the vowels in step 3's han, hen, hin, hon, hän, and hön
+        static constexpr character_bitmap HVN_VOWELS{ L"aeioäö" };
         };
     }
 
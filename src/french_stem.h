@@ -20,8 +20,8 @@ namespace stemming
     @brief French stemmer.
     */
     //------------------------------------------------------
-    template <typename string_typeT = std::wstring>
-    class french_stem final : public stem<string_typeT>
+    template <typename string_typeT = std::wstring, typename policyT = default_stem_policy>
+    class french_stem final : public stem<string_typeT, policyT>
         {
     public:
         /** @brief Stems a French word.
@@ -30,24 +30,33 @@ namespace stemming
             {
             // reset internal data
             m_step_1_successful = false;
-            stem<string_typeT>::reset_r_values();
+            stem<string_typeT, policyT>::reset_r_values();
 
-            std::transform(text.begin(), text.end(), text.begin(), full_width_to_narrow);
-            stem<string_typeT>::remove_possessive_suffix(text);
+            stem<string_typeT, policyT>::normalize_input(text);
+            stem<string_typeT, policyT>::remove_possessive_suffix(text);
             if (text.length() < 2)
                 { return; }
-            remove_elisions(text);
-            stem<string_typeT>::hash_french_yui(text, FRENCH_VOWELS);
-            stem<string_typeT>::hash_french_ei_diaeresis(text);
+            prepare_word(text);
 
-            stem<string_typeT>::find_r1(text, FRENCH_VOWELS);
-            stem<string_typeT>::find_r2(text, FRENCH_VOWELS);
-            stem<string_typeT>::find_french_rv(text, FRENCH_VOWELS);
+            // none of the suffixes can be at the end of this word (e.g., it ends with a digit),
+            // but an accent may still need to be removed by step 6
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, SUFFIX_STEP_ENDINGS))
+                {
+                step_6(text);
+                stem<string_typeT, policyT>::unhash_french_yui(text);
+                stem<string_typeT, policyT>::unhash_french_ei_diaeresis(text);
+                return;
+                }
 
             const size_t length = text.length();
             step_1(text);
-            if (!m_step_1_successful)
-                { step_2a(text); }
+            // light stemming skips the verb suffixes of steps 2a and 2b,
+            // but still removes the residual suffixes (e.g., plurals) in step 4
+            if constexpr (!policyT::light_stemming)
+                {
+                if (!m_step_1_successful)
+                    { step_2a(text); }
+                }
             if (length != text.length() )
                 { step_3(text); }
             else
@@ -55,8 +64,8 @@ namespace stemming
             step_5(text);
             step_6(text);
 
-            stem<string_typeT>::unhash_french_yui(text);
-            stem<string_typeT>::unhash_french_ei_diaeresis(text);
+            stem<string_typeT, policyT>::unhash_french_yui(text);
+            stem<string_typeT, policyT>::unhash_french_ei_diaeresis(text);
             }
         /// @returns The stemmer's language.
         [[nodiscard]]
@@ -65,14 +74,14 @@ namespace stemming
     private:
         bool ic_to_iqu(string_typeT& text)
             {
-            if (stem<string_typeT>::is_suffix(text,
+            if (stem<string_typeT, policyT>::is_suffix(text,
                 /*ic*/common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_C, common_lang_constants::UPPER_C) )
                 {
-                if (stem<string_typeT>::get_r2() <= text.length()-2)
+                if (stem<string_typeT, policyT>::get_r2() <= text.length()-2)
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     return true;
                     }
                 else
@@ -81,8 +90,8 @@ namespace stemming
                     text += L"iq";
                     text += LOWER_U_HASH;
                     // need to search for r2 again because the 'iq' added here may change that
-                    stem<string_typeT>::find_r2(text, FRENCH_VOWELS);
-                    stem<string_typeT>::find_french_rv(text, FRENCH_VOWELS);
+                    stem<string_typeT, policyT>::find_r2(text, FRENCH_VOWELS);
+                    stem<string_typeT, policyT>::find_french_rv(text, FRENCH_VOWELS);
                     return true;
                     }
                 }
@@ -91,8 +100,12 @@ namespace stemming
         //---------------------------------------------
         void step_1(string_typeT& text)
             {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "french::step_1");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_1_ENDINGS))
+                { return; }
             const size_t length = text.length();
-            if (stem<string_typeT>::is_suffix(text,
+            if (stem<string_typeT, policyT>::is_suffix(text,
                 /*issements*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -105,15 +118,15 @@ namespace stemming
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 if (text.length() >= 10 &&
-                    stem<string_typeT>::get_r1() <= (text.length()-9) &&
-                    !stem<string_typeT>::is_one_of(text[text.length()-10], FRENCH_VOWELS) )
+                    stem<string_typeT, policyT>::get_r1() <= (text.length()-9) &&
+                    !stem<string_typeT, policyT>::is_one_of(text[text.length()-10], FRENCH_VOWELS) )
                     {
                     text.erase(text.length()-9);
                     m_step_1_successful = true;
                     }
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*issement*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -125,8 +138,8 @@ namespace stemming
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 if (text.length() >= 9 &&
-                    stem<string_typeT>::get_r1() <= (text.length()-8) &&
-                    !stem<string_typeT>::is_one_of(text[text.length()-9], FRENCH_VOWELS) )
+                    stem<string_typeT, policyT>::get_r1() <= (text.length()-8) &&
+                    !stem<string_typeT, policyT>::is_one_of(text[text.length()-9], FRENCH_VOWELS) )
                     {
                     text.erase(text.length()-8);
                     m_step_1_successful = true;
@@ -134,7 +147,7 @@ namespace stemming
                 return;
                 }
             // 7
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*atrices*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -152,7 +165,7 @@ namespace stemming
                 return;
                 }
             // 6
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*amment*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -161,14 +174,14 @@ namespace stemming
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
-                if (stem<string_typeT>::get_rv() <= (text.length()-6) )
+                if (stem<string_typeT, policyT>::get_rv() <= (text.length()-6) )
                     {
                     text.replace(text.end()-5, text.end(), L"nt");
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*emment*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -177,14 +190,14 @@ namespace stemming
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
-                if (stem<string_typeT>::get_rv() <= (text.length()-6) )
+                if (stem<string_typeT, policyT>::get_rv() <= (text.length()-6) )
                     {
                     text.replace(text.end()-5, text.end(), L"nt");
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*logies*/
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
@@ -193,15 +206,15 @@ namespace stemming
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
-                if (stem<string_typeT>::get_r2() <= (text.length()-6) )
+                if (stem<string_typeT, policyT>::get_r2() <= (text.length()-6) )
                     {
                     text.erase(text.length()-3);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     m_step_1_successful = true;
                     }
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*atrice*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -209,7 +222,7 @@ namespace stemming
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) ||
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ateurs*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -217,7 +230,7 @@ namespace stemming
                         common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                         common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                         common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) ||
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ations*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -233,7 +246,7 @@ namespace stemming
                     }
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                     /*usions*/
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -241,7 +254,7 @@ namespace stemming
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) ||
-                stem<string_typeT>::is_suffix(text,
+                stem<string_typeT, policyT>::is_suffix(text,
                     /*utions*/
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -250,15 +263,15 @@ namespace stemming
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
-                if (stem<string_typeT>::get_r2() <= (text.length()-6) )
+                if (stem<string_typeT, policyT>::get_r2() <= (text.length()-6) )
                     {
                     text.erase(text.length()-5);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     m_step_1_successful = true;
                     }
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ements*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -267,33 +280,33 @@ namespace stemming
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 {
-                if (stem<string_typeT>::delete_if_is_in_r2(text,
+                if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*iv*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V) )
                     {
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*at*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T);
                     }
-                else if (stem<string_typeT>::is_suffix(text,
+                else if (stem<string_typeT, policyT>::is_suffix(text,
                     /*eus*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                     {
-                    if (stem<string_typeT>::get_r2() <= text.length()-3)
+                    if (stem<string_typeT, policyT>::get_r2() <= text.length()-3)
                         {
                         text.erase(text.length()-3);
-                        stem<string_typeT>::update_r_sections(text);
+                        stem<string_typeT, policyT>::update_r_sections(text);
                         }
-                    else if (stem<string_typeT>::get_r1() <= text.length()-3)
+                    else if (stem<string_typeT, policyT>::get_r1() <= text.length()-3)
                         {
                         text[text.length()-1] = common_lang_constants::LOWER_X;
                         }
                     }
-                else if (stem<string_typeT>::delete_if_is_in_r2(text,
+                else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*abl*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
@@ -306,33 +319,33 @@ namespace stemming
                         text[text.length()-3] == common_lang_constants::UPPER_I) &&
                     (text[text.length()-2] == common_lang_constants::LOWER_Q ||
                         text[text.length()-2] == common_lang_constants::UPPER_Q) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], LOWER_U_HASH, UPPER_U_HASH) )
+                    stem<string_typeT, policyT>::is_either(text[text.length()-1], LOWER_U_HASH, UPPER_U_HASH) )
                     {
-                    if (stem<string_typeT>::get_r2() <= text.length()-3)
+                    if (stem<string_typeT, policyT>::get_r2() <= text.length()-3)
                         {
                         text.erase(text.length()-3);
-                        stem<string_typeT>::update_r_sections(text);
+                        stem<string_typeT, policyT>::update_r_sections(text);
                         }
                     }
-                else if (stem<string_typeT>::is_suffix_in_rv(text,
+                else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                     /*ièr*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_E_GRAVE, common_lang_constants::UPPER_E_GRAVE,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) )
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 else if (text.length() >= 3 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-3) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-3) &&
                     (text[text.length()-2] == common_lang_constants::LOWER_E_GRAVE ||
                         text[text.length()-2] == common_lang_constants::UPPER_E_GRAVE) &&
                     (text[text.length()-1] == common_lang_constants::LOWER_R ||
                         text[text.length()-1] == common_lang_constants::UPPER_R) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], LOWER_I_HASH, UPPER_I_HASH) )
+                    stem<string_typeT, policyT>::is_either(text[text.length()-3], LOWER_I_HASH, UPPER_I_HASH) )
                     {
                     text.replace(text.end()-3, text.end(), L"i");
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 if (length != text.length() )
                     {
@@ -342,14 +355,14 @@ namespace stemming
                 }
             // 5
             else if (
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ateur*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ation*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -365,14 +378,14 @@ namespace stemming
                 return;
                 }
             else if (
-                stem<string_typeT>::is_suffix(text,
+                stem<string_typeT, policyT>::is_suffix(text,
                     /*usion*/
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ||
-                stem<string_typeT>::is_suffix(text,
+                stem<string_typeT, policyT>::is_suffix(text,
                     /*ution*/
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -380,16 +393,16 @@ namespace stemming
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) )
                 {
-                if (stem<string_typeT>::get_r2() <= (text.length()-5) )
+                if (stem<string_typeT, policyT>::get_r2() <= (text.length()-5) )
                     {
                     text.erase(text.length()-4);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     m_step_1_successful = true;
                     }
                 return;
                 }
             else if (
-                stem<string_typeT>::is_suffix(text,
+                stem<string_typeT, policyT>::is_suffix(text,
                     /*ences*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -397,37 +410,37 @@ namespace stemming
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
-                if (stem<string_typeT>::get_r2() <= (text.length()-5) )
+                if (stem<string_typeT, policyT>::get_r2() <= (text.length()-5) )
                     {
                     text.replace(text.end()-3, text.end(), L"t");
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     m_step_1_successful = true;
                     }
                 return;
                 }
             else if (
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ables*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                     common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*istes*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ismes*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ances*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -450,12 +463,12 @@ namespace stemming
                         text[text.length()-2] == common_lang_constants::UPPER_E) &&
                     (text[text.length()-1] == common_lang_constants::LOWER_S ||
                         text[text.length()-1] == common_lang_constants::UPPER_S) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], LOWER_U_HASH, UPPER_U_HASH) )
+                    stem<string_typeT, policyT>::is_either(text[text.length()-3], LOWER_U_HASH, UPPER_U_HASH) )
                     {
-                    if (stem<string_typeT>::get_r2() <= text.length()-5)
+                    if (stem<string_typeT, policyT>::get_r2() <= text.length()-5)
                         {
                         text.erase(text.length()-5);
-                        stem<string_typeT>::update_r_sections(text);
+                        stem<string_typeT, policyT>::update_r_sections(text);
                         }
                     if (length != text.length() )
                         {
@@ -463,7 +476,7 @@ namespace stemming
                         }
                     return;
                     }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*logie*/
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
@@ -471,15 +484,15 @@ namespace stemming
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                 {
-                if (stem<string_typeT>::get_r2() <= (text.length()-5) )
+                if (stem<string_typeT, policyT>::get_r2() <= (text.length()-5) )
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     m_step_1_successful = true;
                     }
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ement*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -487,35 +500,35 @@ namespace stemming
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T, false) )
                 {
-                if (stem<string_typeT>::delete_if_is_in_r2(text,
+                if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*iv*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V, false) )
                     {
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*at*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T);
                     }
-                else if (stem<string_typeT>::is_suffix(text,
+                else if (stem<string_typeT, policyT>::is_suffix(text,
                     /*eus*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                     {
                     if (text.length() >= 3 &&
-                        stem<string_typeT>::get_r2() <= text.length()-3)
+                        stem<string_typeT, policyT>::get_r2() <= text.length()-3)
                         {
                         text.erase(text.length()-3);
-                        stem<string_typeT>::update_r_sections(text);
+                        stem<string_typeT, policyT>::update_r_sections(text);
                         }
                     else if (text.length() >= 3 &&
-                        stem<string_typeT>::get_r1() <= text.length()-3)
+                        stem<string_typeT, policyT>::get_r1() <= text.length()-3)
                         {
                         text[text.length()-1] = common_lang_constants::LOWER_X;
                         }
                     }
-                else if (stem<string_typeT>::delete_if_is_in_r2(text,
+                else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*abl*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
@@ -528,40 +541,40 @@ namespace stemming
                         text[text.length()-3] == common_lang_constants::UPPER_I) &&
                     (text[text.length()-2] == common_lang_constants::LOWER_Q ||
                         text[text.length()-2] == common_lang_constants::UPPER_Q) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], LOWER_U_HASH, UPPER_U_HASH) )
+                    stem<string_typeT, policyT>::is_either(text[text.length()-1], LOWER_U_HASH, UPPER_U_HASH) )
                     {
-                    if (stem<string_typeT>::get_r2() <= text.length()-3)
+                    if (stem<string_typeT, policyT>::get_r2() <= text.length()-3)
                         {
                         text.erase(text.length()-3);
-                        stem<string_typeT>::update_r_sections(text);
+                        stem<string_typeT, policyT>::update_r_sections(text);
                         }
                     }
-                else if (stem<string_typeT>::is_suffix_in_rv(text,
+                else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                     /*ièr*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_E_GRAVE, common_lang_constants::UPPER_E_GRAVE,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) )
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 else if (text.length() >= 3 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-3) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-3) &&
                     (text[text.length()-2] == common_lang_constants::LOWER_E_GRAVE ||
                         text[text.length()-2] == common_lang_constants::UPPER_E_GRAVE) &&
                     (text[text.length()-1] == common_lang_constants::LOWER_R ||
                         text[text.length()-1] == common_lang_constants::UPPER_R) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], LOWER_I_HASH, UPPER_I_HASH) )
+                    stem<string_typeT, policyT>::is_either(text[text.length()-3], LOWER_I_HASH, UPPER_I_HASH) )
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 if (length != text.length() )
                     {
                     m_step_1_successful = true;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*ments*/
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -571,15 +584,15 @@ namespace stemming
                 {
                 // the proceeding vowel must also be n RV
                 if (text.length() >= 6 &&
-                    stem<string_typeT>::get_rv() <= text.length()-6 &&
-                    stem<string_typeT>::is_one_of(text[text.length()-6], FRENCH_VOWELS) )
+                    stem<string_typeT, policyT>::get_rv() <= text.length()-6 &&
+                    stem<string_typeT, policyT>::is_one_of(text[text.length()-6], FRENCH_VOWELS) )
                     {
                     text.erase(text.length()-5);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*euses*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
@@ -587,40 +600,40 @@ namespace stemming
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
-                if (stem<string_typeT>::get_r2() <= text.length()-5)
+                if (stem<string_typeT, policyT>::get_r2() <= text.length()-5)
                     {
                     text.erase(text.length()-5);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
-                else if (stem<string_typeT>::get_r1() <= text.length()-5)
+                else if (stem<string_typeT, policyT>::get_r1() <= text.length()-5)
                     {
                     text.replace(text.end()-3, text.end(), L"x");
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 m_step_1_successful = true;
                 }
             // 4
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*euse*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                 {
-                if (stem<string_typeT>::get_r2() <= text.length()-4)
+                if (stem<string_typeT, policyT>::get_r2() <= text.length()-4)
                     {
                     text.erase(text.length()-4);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 else if (text.length() >= 4 &&
-                    stem<string_typeT>::get_r1() <= text.length()-4)
+                    stem<string_typeT, policyT>::get_r1() <= text.length()-4)
                     {
                     text.replace(text.end()-2, text.end(), L"x");
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 m_step_1_successful = true;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*ment*/
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -629,49 +642,49 @@ namespace stemming
                 {
                 // the proceeding vowel must also be n RV
                 if (text.length() >= 5 &&
-                    stem<string_typeT>::get_rv() <= text.length()-5 &&
-                    stem<string_typeT>::is_one_of(text[text.length()-5], FRENCH_VOWELS) )
+                    stem<string_typeT, policyT>::get_rv() <= text.length()-5 &&
+                    stem<string_typeT, policyT>::is_one_of(text[text.length()-5], FRENCH_VOWELS) )
                     {
                     text.erase(text.length()-4);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*ence*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                 common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                 {
-                if (stem<string_typeT>::get_r2() <= (text.length()-4) )
+                if (stem<string_typeT, policyT>::get_r2() <= (text.length()-4) )
                     {
                     text.replace(text.end()-2, text.end(), L"t");
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     m_step_1_successful = true;
                     }
                 return;
                 }
             else if (
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ance*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*isme*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*able*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                     common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*iste*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -691,12 +704,12 @@ namespace stemming
                         text[text.length()-3] == common_lang_constants::UPPER_Q) &&
                     (text[text.length()-1] == common_lang_constants::LOWER_E ||
                         text[text.length()-1] == common_lang_constants::UPPER_E) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], LOWER_U_HASH, UPPER_U_HASH) )
+                    stem<string_typeT, policyT>::is_either(text[text.length()-2], LOWER_U_HASH, UPPER_U_HASH) )
                     {
-                    if (stem<string_typeT>::get_r2() <= text.length()-4)
+                    if (stem<string_typeT, policyT>::get_r2() <= text.length()-4)
                         {
                         text.erase(text.length()-4);
-                        stem<string_typeT>::update_r_sections(text);
+                        stem<string_typeT, policyT>::update_r_sections(text);
                         }
                     if (length != text.length() )
                         {
@@ -704,7 +717,7 @@ namespace stemming
                         }
                     return;
                     }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*eaux*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
@@ -712,43 +725,43 @@ namespace stemming
                 common_lang_constants::LOWER_X, common_lang_constants::UPPER_X) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 m_step_1_successful = true;
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ités*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                 common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 {
-                if (stem<string_typeT>::is_suffix(text,
+                if (stem<string_typeT, policyT>::is_suffix(text,
                     /*abil*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) )
                     {
-                    if (stem<string_typeT>::get_r2() <= text.length()-4)
+                    if (stem<string_typeT, policyT>::get_r2() <= text.length()-4)
                         {
                         text.erase(text.length()-4);
-                        stem<string_typeT>::update_r_sections(text);
+                        stem<string_typeT, policyT>::update_r_sections(text);
                         }
                     else
                         {
                         text.replace(text.end()-2, text.end(), L"l");
                         }
                     }
-                else if (stem<string_typeT>::is_suffix(text,
+                else if (stem<string_typeT, policyT>::is_suffix(text,
                     /*ic*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_C, common_lang_constants::UPPER_C) )
                     {
-                    if (stem<string_typeT>::get_r2() <= text.length()-2)
+                    if (stem<string_typeT, policyT>::get_r2() <= text.length()-2)
                         {
                         text.erase(text.length()-2);
-                        stem<string_typeT>::update_r_sections(text);
+                        stem<string_typeT, policyT>::update_r_sections(text);
                         }
                     else
                         {
@@ -756,13 +769,13 @@ namespace stemming
                         text += L"iq";
                         text += LOWER_U_HASH;
                         // need to search for r2 again because the 'iq' added here may change that
-                        stem<string_typeT>::find_r2(text, FRENCH_VOWELS);
-                        stem<string_typeT>::find_french_rv(text, FRENCH_VOWELS);
+                        stem<string_typeT, policyT>::find_r2(text, FRENCH_VOWELS);
+                        stem<string_typeT, policyT>::find_french_rv(text, FRENCH_VOWELS);
                         }
                     }
                 else
                     {
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*iv*/
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_V, common_lang_constants::UPPER_V);
@@ -773,14 +786,14 @@ namespace stemming
                     }
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ives*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 {
-                if (stem<string_typeT>::delete_if_is_in_r2(text,
+                if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*at*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
@@ -794,38 +807,38 @@ namespace stemming
                 return;
                 }
             // 3
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ité*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                 common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE, false) )
                 {
-                if (stem<string_typeT>::is_suffix(text,
+                if (stem<string_typeT, policyT>::is_suffix(text,
                     /*abil*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) )
                     {
-                    if (stem<string_typeT>::get_r2() <= text.length()-4)
+                    if (stem<string_typeT, policyT>::get_r2() <= text.length()-4)
                         {
                         text.erase(text.length()-4);
-                        stem<string_typeT>::update_r_sections(text);
+                        stem<string_typeT, policyT>::update_r_sections(text);
                         }
                     else
                         {
                         text.replace(text.end()-2, text.end(), L"l");
                         }
                     }
-                else if (stem<string_typeT>::is_suffix(text,
+                else if (stem<string_typeT, policyT>::is_suffix(text,
                     /*ic*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_C, common_lang_constants::UPPER_C) )
                     {
-                    if (stem<string_typeT>::get_r2() <= text.length()-2)
+                    if (stem<string_typeT, policyT>::get_r2() <= text.length()-2)
                         {
                         text.erase(text.length()-2);
-                        stem<string_typeT>::update_r_sections(text);
+                        stem<string_typeT, policyT>::update_r_sections(text);
                         }
                     else
                         {
@@ -833,13 +846,13 @@ namespace stemming
                         text += L"iq";
                         text += LOWER_U_HASH;
                         // need to search for r2 again because the 'iq' added here may change that
-                        stem<string_typeT>::find_r2(text, FRENCH_VOWELS);
-                        stem<string_typeT>::find_french_rv(text, FRENCH_VOWELS);
+                        stem<string_typeT, policyT>::find_r2(text, FRENCH_VOWELS);
+                        stem<string_typeT, policyT>::find_french_rv(text, FRENCH_VOWELS);
                         }
                     }
                 else
                     {
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*iv*/
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_V, common_lang_constants::UPPER_V);
@@ -850,7 +863,7 @@ namespace stemming
                     }
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*eux*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
@@ -862,58 +875,58 @@ namespace stemming
                     }
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*aux*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                 common_lang_constants::LOWER_X, common_lang_constants::UPPER_X) )
                 {
-                if (stem<string_typeT>::get_r1() <= (text.length()-3) )
+                if (stem<string_typeT, policyT>::get_r1() <= (text.length()-3) )
                     {
                     text.replace(text.end()-2, text.end(), L"l");
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     m_step_1_successful = true;
                     }
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*oux*/
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                 common_lang_constants::LOWER_X, common_lang_constants::UPPER_X) )
                 {
                 if (text.length() >= 4 &&
-                    (stem<string_typeT>::is_either(text[text.length() - 4],
+                    (stem<string_typeT, policyT>::is_either(text[text.length() - 4],
                         common_lang_constants::LOWER_B, common_lang_constants::LOWER_B) ||
-                     stem<string_typeT>::is_either(text[text.length() - 4],
+                     stem<string_typeT, policyT>::is_either(text[text.length() - 4],
                         common_lang_constants::LOWER_H, common_lang_constants::LOWER_H) ||
-                     stem<string_typeT>::is_either(text[text.length() - 4],
+                     stem<string_typeT, policyT>::is_either(text[text.length() - 4],
                         common_lang_constants::LOWER_J, common_lang_constants::LOWER_J) ||
-                     stem<string_typeT>::is_either(text[text.length() - 4],
+                     stem<string_typeT, policyT>::is_either(text[text.length() - 4],
                         common_lang_constants::LOWER_L, common_lang_constants::LOWER_L) ||
-                     stem<string_typeT>::is_either(text[text.length() - 4],
+                     stem<string_typeT, policyT>::is_either(text[text.length() - 4],
                         common_lang_constants::LOWER_N, common_lang_constants::LOWER_N) ||
-                     stem<string_typeT>::is_either(text[text.length() - 4],
+                     stem<string_typeT, policyT>::is_either(text[text.length() - 4],
                         common_lang_constants::LOWER_P, common_lang_constants::LOWER_P)))
                     {
                     text.erase(text.length() - 1);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     m_step_1_successful = true;
                     }
                 return;
                 }
             else if (
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ive*/common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ifs*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_F, common_lang_constants::UPPER_F,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 {
-                if (stem<string_typeT>::delete_if_is_in_r2(text,
+                if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*at*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T, false) )
@@ -927,12 +940,12 @@ namespace stemming
                 return;
                 }
             // 2
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*if*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_F, common_lang_constants::UPPER_F, false) )
                 {
-                if (stem<string_typeT>::delete_if_is_in_r2(text,
+                if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*at*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T, false) )
@@ -949,11 +962,18 @@ namespace stemming
          //---------------------------------------------
         void step_2a(string_typeT& text)
             {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "french::step_2a");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_2A_ENDINGS))
+                {
+                step_2b(text);
+                return;
+                }
             const auto notVowelNorH = [](const auto& ch) noexcept
-                { return (ch != DIARESIS_HASH && !stem<string_typeT>::is_one_of(ch, FRENCH_VOWELS)); };
+                { return (ch != DIARESIS_HASH && !stem<string_typeT, policyT>::is_one_of(ch, FRENCH_VOWELS)); };
 
             if (text.length() >= 9 &&
-                stem<string_typeT>::get_rv() <= (text.length()-8) &&
+                stem<string_typeT, policyT>::get_rv() <= (text.length()-8) &&
                 (text[text.length()-8] == common_lang_constants::LOWER_I ||
                     text[text.length()-8] == common_lang_constants::UPPER_I) &&
                 (text[text.length()-7] == common_lang_constants::LOWER_S ||
@@ -968,16 +988,16 @@ namespace stemming
                     text[text.length()-2] == common_lang_constants::UPPER_N) &&
                 (text[text.length()-1] == common_lang_constants::LOWER_T ||
                     text[text.length()-1] == common_lang_constants::UPPER_T) &&
-                stem<string_typeT>::is_either(text[text.length()-4], LOWER_I_HASH, UPPER_I_HASH) )
+                stem<string_typeT, policyT>::is_either(text[text.length()-4], LOWER_I_HASH, UPPER_I_HASH) )
                 {
-                if (stem<string_typeT>::get_rv() <= (text.length()-7) &&
+                if (stem<string_typeT, policyT>::get_rv() <= (text.length()-7) &&
                     notVowelNorH(text[text.length()-9]) )
                     {
                     text.erase(text.length()-8);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*issantes*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -989,7 +1009,7 @@ namespace stemming
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 if (text.length() >= 9 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-9) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-9) &&
                     notVowelNorH(text[text.length()-9]) )
                     {
                     text.erase(text.length()-8);
@@ -997,7 +1017,7 @@ namespace stemming
                     }
                 }
             else if (text.length() >= 8 &&
-                stem<string_typeT>::get_rv() <= (text.length()-7) &&
+                stem<string_typeT, policyT>::get_rv() <= (text.length()-7) &&
                 (text[text.length()-7] == common_lang_constants::LOWER_I ||
                     text[text.length()-7] == common_lang_constants::UPPER_I) &&
                 (text[text.length()-6] == common_lang_constants::LOWER_R ||
@@ -1010,16 +1030,16 @@ namespace stemming
                     text[text.length()-2] == common_lang_constants::UPPER_N) &&
                 (text[text.length()-1] == common_lang_constants::LOWER_T ||
                     text[text.length()-1] == common_lang_constants::UPPER_T) &&
-                stem<string_typeT>::is_either(text[text.length()-4], LOWER_I_HASH, UPPER_I_HASH) )
+                stem<string_typeT, policyT>::is_either(text[text.length()-4], LOWER_I_HASH, UPPER_I_HASH) )
                 {
-                if (stem<string_typeT>::get_rv() <= (text.length()-8) &&
+                if (stem<string_typeT, policyT>::get_rv() <= (text.length()-8) &&
                     notVowelNorH(text[text.length()-8]) )
                     {
                     text.erase(text.length()-7);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*issante*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1030,14 +1050,14 @@ namespace stemming
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                 {
                 if (text.length() >= 8 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-8) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-8) &&
                     notVowelNorH(text[text.length()-8]) )
                     {
                     text.erase(text.length()-7);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*issants*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1048,14 +1068,14 @@ namespace stemming
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 if (text.length() >= 8 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-8) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-8) &&
                     notVowelNorH(text[text.length()-8]) )
                     {
                     text.erase(text.length()-7);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*issions*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1066,14 +1086,14 @@ namespace stemming
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 if (text.length() >= 8 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-8) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-8) &&
                     notVowelNorH(text[text.length()-8]) )
                     {
                     text.erase(text.length()-7);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*irions*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1083,14 +1103,14 @@ namespace stemming
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 if (text.length() >= 7 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-7) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-7) &&
                     notVowelNorH(text[text.length()-7]) )
                     {
                     text.erase(text.length()-6);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*issais*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1100,14 +1120,14 @@ namespace stemming
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 if (text.length() >= 7 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-7) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-7) &&
                     notVowelNorH(text[text.length()-7]) )
                     {
                     text.erase(text.length()-6);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*issait*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1117,14 +1137,14 @@ namespace stemming
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 if (text.length() >= 7 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-7) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-7) &&
                     notVowelNorH(text[text.length()-7]) )
                     {
                     text.erase(text.length()-6);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*issant*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1134,14 +1154,14 @@ namespace stemming
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 if (text.length() >= 7 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-7) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-7) &&
                     notVowelNorH(text[text.length()-7]) )
                     {
                     text.erase(text.length()-6);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*issent*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1151,14 +1171,14 @@ namespace stemming
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 if (text.length() >= 7 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-7) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-7) &&
                     notVowelNorH(text[text.length()-7]) )
                     {
                     text.erase(text.length()-6);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*issiez*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1168,14 +1188,14 @@ namespace stemming
                 common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z) )
                 {
                 if (text.length() >= 7 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-7) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-7) &&
                     notVowelNorH(text[text.length()-7]) )
                     {
                     text.erase(text.length()-6);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*issons*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1185,14 +1205,14 @@ namespace stemming
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 if (text.length() >= 7 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-7) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-7) &&
                     notVowelNorH(text[text.length()-7]) )
                     {
                     text.erase(text.length()-6);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*irais*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1201,14 +1221,14 @@ namespace stemming
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 if (text.length() >= 6 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-6) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-6) &&
                     notVowelNorH(text[text.length()-6]) )
                     {
                     text.erase(text.length()-5);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*irait*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1217,14 +1237,14 @@ namespace stemming
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 if (text.length() >= 6 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-6) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-6) &&
                     notVowelNorH(text[text.length()-6]) )
                     {
                     text.erase(text.length()-5);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*irent*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1233,14 +1253,14 @@ namespace stemming
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 if (text.length() >= 6 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-6) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-6) &&
                     notVowelNorH(text[text.length()-6]) )
                     {
                     text.erase(text.length()-5);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*iriez*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1249,14 +1269,14 @@ namespace stemming
                 common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z) )
                 {
                 if (text.length() >= 6 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-6) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-6) &&
                     notVowelNorH(text[text.length()-6]) )
                     {
                     text.erase(text.length()-5);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*irons*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1265,14 +1285,14 @@ namespace stemming
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 if (text.length() >= 6 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-6) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-6) &&
                     notVowelNorH(text[text.length()-6]) )
                     {
                     text.erase(text.length()-5);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*iront*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1281,14 +1301,14 @@ namespace stemming
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 if (text.length() >= 6 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-6) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-6) &&
                     notVowelNorH(text[text.length()-6]) )
                     {
                     text.erase(text.length()-5);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*isses*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1297,14 +1317,14 @@ namespace stemming
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 if (text.length() >= 6 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-6) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-6) &&
                     notVowelNorH(text[text.length()-6]) )
                     {
                     text.erase(text.length()-5);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*issez*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1313,14 +1333,14 @@ namespace stemming
                 common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z) )
                 {
                 if (text.length() >= 6 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-6)&&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-6)&&
                     notVowelNorH(text[text.length()-6]) )
                     {
                     text.erase(text.length()-5);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*îmes*/
                 common_lang_constants::LOWER_I_CIRCUMFLEX, common_lang_constants::UPPER_I_CIRCUMFLEX,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -1328,14 +1348,14 @@ namespace stemming
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 if (text.length() >= 5 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-5) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-5) &&
                     notVowelNorH(text[text.length()-5]) )
                     {
                     text.erase(text.length()-4);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*îtes*/
                 common_lang_constants::LOWER_I_CIRCUMFLEX, common_lang_constants::UPPER_I_CIRCUMFLEX,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -1343,14 +1363,14 @@ namespace stemming
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 if (text.length() >= 5 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-5) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-5) &&
                     notVowelNorH(text[text.length()-5]) )
                     {
                     text.erase(text.length()-4);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*irai*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1358,14 +1378,14 @@ namespace stemming
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
                 {
                 if (text.length() >= 5 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-5) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-5) &&
                     notVowelNorH(text[text.length()-5]) )
                     {
                     text.erase(text.length()-4);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*iras*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1373,14 +1393,14 @@ namespace stemming
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 if (text.length() >= 5 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-5) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-5) &&
                     notVowelNorH(text[text.length()-5]) )
                     {
                     text.erase(text.length()-4);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*irez*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1388,14 +1408,14 @@ namespace stemming
                 common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z) )
                 {
                 if (text.length() >= 5 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-5) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-5) &&
                     notVowelNorH(text[text.length()-5]) )
                     {
                     text.erase(text.length()-4);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*isse*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1403,110 +1423,110 @@ namespace stemming
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                 {
                 if (text.length() >= 5 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-5) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-5) &&
                     notVowelNorH(text[text.length()-5]) )
                     {
                     text.erase(text.length()-4);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*ies*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 if (text.length() >= 4 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-4) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-4) &&
                     notVowelNorH(text[text.length()-4]) )
                     {
                     text.erase(text.length()-3);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*ira*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) )
                 {
                 if (text.length() >= 4 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-4) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-4) &&
                     notVowelNorH(text[text.length()-4]) )
                     {
                     text.erase(text.length()-3);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 common_lang_constants::LOWER_I_CIRCUMFLEX, common_lang_constants::UPPER_I_CIRCUMFLEX,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 if (text.length() >= 3 &&
-                    stem<string_typeT>::get_rv() <= text.length()-3 &&
+                    stem<string_typeT, policyT>::get_rv() <= text.length()-3 &&
                     notVowelNorH(text[text.length()-3]) )
                     {
                     text.erase(text.length()-2);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*ie*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                 {
                 if (text.length() >= 3 &&
-                    stem<string_typeT>::get_rv() <= text.length()-3 &&
+                    stem<string_typeT, policyT>::get_rv() <= text.length()-3 &&
                     notVowelNorH(text[text.length()-3]) )
                     {
                     text.erase(text.length()-2);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*ir*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) )
                 {
                 if (text.length() >= 3 &&
-                    stem<string_typeT>::get_rv() <= text.length()-3 &&
+                    stem<string_typeT, policyT>::get_rv() <= text.length()-3 &&
                     notVowelNorH(text[text.length()-3]) )
                     {
                     text.erase(text.length()-2);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*is*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 if (text.length() >= 3 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-3) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-3) &&
                     notVowelNorH(text[text.length()-3]) )
                     {
                     text.erase(text.length()-2);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*it*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 if (text.length() >= 3 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-3) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-3) &&
                     notVowelNorH(text[text.length()-3]) )
                     {
                     text.erase(text.length()-2);
                     return;
                     }
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
                 {
                 if (text.length() >= 2 &&
-                    stem<string_typeT>::get_rv() <= (text.length()-2) &&
+                    stem<string_typeT, policyT>::get_rv() <= (text.length()-2) &&
                     notVowelNorH(text[text.length()-2]) )
                     {
                     text.erase(text.length()-1);
@@ -1519,7 +1539,11 @@ namespace stemming
         //---------------------------------------------
         void step_2b(string_typeT& text)
             {
-            if (stem<string_typeT>::delete_if_is_in_rv(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "french::step_2b");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_2B_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*assions*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1529,11 +1553,11 @@ namespace stemming
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 {
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*assent*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1542,11 +1566,11 @@ namespace stemming
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T, false) )
                 {
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*assiez*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1555,24 +1579,24 @@ namespace stemming
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z, false) )
                 {
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E);
                 return;
                 }
             else if (text.length() >= 7 &&
-                stem<string_typeT>::get_rv() <= (text.length()-7) &&
+                stem<string_typeT, policyT>::get_rv() <= (text.length()-7) &&
                 (text[text.length()-7] == common_lang_constants::LOWER_E || text[text.length()-7] == common_lang_constants::UPPER_E) &&
                 (text[text.length()-6] == common_lang_constants::LOWER_R || text[text.length()-6] == common_lang_constants::UPPER_R) &&
                 (text[text.length()-5] == common_lang_constants::LOWER_A || text[text.length()-5] == common_lang_constants::UPPER_A) &&
                 (text[text.length()-3] == common_lang_constants::LOWER_E || text[text.length()-3] == common_lang_constants::UPPER_E) &&
                 (text[text.length()-2] == common_lang_constants::LOWER_N || text[text.length()-2] == common_lang_constants::UPPER_N) &&
                 (text[text.length()-1] == common_lang_constants::LOWER_T || text[text.length()-1] == common_lang_constants::UPPER_T) &&
-                stem<string_typeT>::is_either(text[text.length()-4], LOWER_I_HASH, UPPER_I_HASH) )
+                stem<string_typeT, policyT>::is_either(text[text.length()-4], LOWER_I_HASH, UPPER_I_HASH) )
                 {
                 text.erase(text.length()-7);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*erions*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1584,19 +1608,19 @@ namespace stemming
                 return;
                 }
             else if (text.length() >= 5 &&
-                stem<string_typeT>::get_rv() <= (text.length()-5) &&
+                stem<string_typeT, policyT>::get_rv() <= (text.length()-5) &&
                 (text[text.length()-5] == common_lang_constants::LOWER_A || text[text.length()-5] == common_lang_constants::UPPER_A) &&
                 (text[text.length()-3] == common_lang_constants::LOWER_E || text[text.length()-3] == common_lang_constants::UPPER_E) &&
                 (text[text.length()-2] == common_lang_constants::LOWER_N || text[text.length()-2] == common_lang_constants::UPPER_N) &&
                 (text[text.length()-1] == common_lang_constants::LOWER_T || text[text.length()-1] == common_lang_constants::UPPER_T) &&
-                stem<string_typeT>::is_either(text[text.length()-4], LOWER_I_HASH, UPPER_I_HASH) )
+                stem<string_typeT, policyT>::is_either(text[text.length()-4], LOWER_I_HASH, UPPER_I_HASH) )
                 {
                 text.erase(text.length()-5);
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*antes*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -1604,11 +1628,11 @@ namespace stemming
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 {
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*asses*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1616,11 +1640,11 @@ namespace stemming
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 {
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*èrent*/
                 common_lang_constants::LOWER_E_GRAVE, common_lang_constants::UPPER_E_GRAVE,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1630,7 +1654,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*erais*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1640,7 +1664,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*erait*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1650,7 +1674,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*eriez*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1660,7 +1684,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*erons*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1670,7 +1694,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*eront*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1680,7 +1704,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*aises*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
@@ -1693,11 +1717,11 @@ namespace stemming
                                    { text.c_str(), text.length() - 5 }))
                     {
                     text.erase(text.length() - 5);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*eais*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
@@ -1707,13 +1731,13 @@ namespace stemming
                 return;
                 }
             else if (
-                stem<string_typeT>::is_suffix_in_r1(text,
+                stem<string_typeT, policyT>::is_suffix_in_r1(text,
                  /*ions*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) &&
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ions*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
@@ -1722,62 +1746,62 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*âmes*/
                 common_lang_constants::LOWER_A_CIRCUMFLEX, common_lang_constants::UPPER_A_CIRCUMFLEX,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 {
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*âtes*/
                 common_lang_constants::LOWER_A_CIRCUMFLEX, common_lang_constants::UPPER_A_CIRCUMFLEX,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 {
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ante*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
                 {
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ants*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 {
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*asse*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
                 {
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*erai*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1786,7 +1810,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*eras*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1795,7 +1819,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*erez*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1804,7 +1828,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*aise*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
@@ -1816,11 +1840,11 @@ namespace stemming
                                    { text.c_str(), text.length() - 4 }))
                     {
                     text.erase(text.length() - 4);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*ais*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
@@ -1831,31 +1855,31 @@ namespace stemming
                                    { text.c_str(), text.length() - 3 }))
                     {
                     text.erase(text.length() - 3);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ait*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T, false) )
                 {
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ant*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T, false) )
                 {
-                stem<string_typeT>::delete_if_is_in_rv(text, common_lang_constants::LOWER_E,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text, common_lang_constants::LOWER_E,
                     common_lang_constants::UPPER_E);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ées*/
                 common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -1863,7 +1887,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*era*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1871,7 +1895,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*iez*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -1879,70 +1903,70 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ât*/
                 common_lang_constants::LOWER_A_CIRCUMFLEX,
                 common_lang_constants::UPPER_A_CIRCUMFLEX, common_lang_constants::LOWER_T,
                 common_lang_constants::UPPER_T, false) )
                 {
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ai*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I, false) )
                 {
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*as*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 {
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ée*/
                 common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*és*/
                 common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*er*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) )
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ez*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z, false) )
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
                 {
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*é*/
                 common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE, false) )
                 {
@@ -1952,6 +1976,8 @@ namespace stemming
         //---------------------------------------------
         void step_3(string_typeT& text)
             {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "french::step_3");
             if (text.length() == 0)
                 { return; }
             if (text[text.length()-1] == LOWER_Y_HASH)
@@ -1974,26 +2000,30 @@ namespace stemming
         //---------------------------------------------
         void step_4(string_typeT& text)
             {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "french::step_4");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_4_ENDINGS))
+                { return; }
             if (text.length() >= 2 &&
                 (text[text.length()-1] == common_lang_constants::LOWER_S ||
                     text[text.length()-1] == common_lang_constants::UPPER_S) &&
-                !stem<string_typeT>::is_one_of(text[text.length()-2], FRENCH_AIOUES))
+                !stem<string_typeT, policyT>::is_one_of(text[text.length()-2], FRENCH_AIOUES))
                 {
                 text.erase(text.length() - 1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
             if (text.length() >= 3 &&
                 (text[text.length()-1] == common_lang_constants::LOWER_S ||
                     text[text.length()-1] == common_lang_constants::UPPER_S) &&
-                stem<string_typeT>::is_either(text[text.length() - 2],
+                stem<string_typeT, policyT>::is_either_case(text[text.length() - 2],
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
                 text[text.length() - 3] == DIARESIS_HASH)
                 {
                 text.erase(text.length() - 1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
 
-            if (stem<string_typeT>::is_suffix_in_rv(text,
+            if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*ière*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_E_GRAVE, common_lang_constants::UPPER_E_GRAVE,
@@ -2001,53 +2031,53 @@ namespace stemming
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                 {
                 text.replace(text.end()-4, text.end(), L"i");
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
             else if (text.length() >= 4 &&
-                stem<string_typeT>::get_rv() <= (text.length()-4) &&
+                stem<string_typeT, policyT>::get_rv() <= (text.length()-4) &&
                 (text[text.length()-3] == common_lang_constants::LOWER_E_GRAVE ||
                     text[text.length()-3] == common_lang_constants::UPPER_E_GRAVE) &&
                 (text[text.length()-2] == common_lang_constants::LOWER_R ||
                     text[text.length()-2] == common_lang_constants::UPPER_R) &&
                 (text[text.length()-1] == common_lang_constants::LOWER_E ||
                     text[text.length()-1] == common_lang_constants::UPPER_E) &&
-                stem<string_typeT>::is_either(text[text.length()-4], LOWER_I_HASH, UPPER_I_HASH) )
+                stem<string_typeT, policyT>::is_either(text[text.length()-4], LOWER_I_HASH, UPPER_I_HASH) )
                 {
                 text.replace(text.end()-4, text.end(), L"i");
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*ier*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) )
                 {
                 text.replace(text.end()-3, text.end(), L"i");
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
             else if (text.length() >= 3 &&
-                stem<string_typeT>::get_rv() <= (text.length()-3) &&
+                stem<string_typeT, policyT>::get_rv() <= (text.length()-3) &&
                 (text[text.length()-2] == common_lang_constants::LOWER_E ||
                     text[text.length()-2] == common_lang_constants::UPPER_E) &&
                 (text[text.length()-1] == common_lang_constants::LOWER_R ||
                     text[text.length()-1] == common_lang_constants::UPPER_R) &&
-                stem<string_typeT>::is_either(text[text.length()-3], LOWER_I_HASH, UPPER_I_HASH) )
+                stem<string_typeT, policyT>::is_either(text[text.length()-3], LOWER_I_HASH, UPPER_I_HASH) )
                 {
                 text.replace(text.end()-3, text.end(), L"i");
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
             else if (
-                stem<string_typeT>::is_suffix_in_rv(text,
+                stem<string_typeT, policyT>::is_suffix_in_rv(text,
                     /*sion*/
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ||
-                stem<string_typeT>::is_suffix_in_rv(text,
+                stem<string_typeT, policyT>::is_suffix_in_rv(text,
                     /*tion*/
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
@@ -2055,28 +2085,28 @@ namespace stemming
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) )
                 {
                 if (text.length() >= 3 &&
-                    stem<string_typeT>::get_r2() <= text.length()-3)
+                    stem<string_typeT, policyT>::get_r2() <= text.length()-3)
                     {
                     text.erase(text.length()-3);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*ë*/
                 common_lang_constants::LOWER_E_UMLAUTS, common_lang_constants::UPPER_E_UMLAUTS) )
                 {
                 if (text.length() >= 3 &&
-                    (stem<string_typeT>::is_either(text[text.length()-3],
+                    (stem<string_typeT, policyT>::is_either_case(text[text.length()-3],
                         common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) &&
-                    stem<string_typeT>::is_either(text[text.length()-2],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2],
                         common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) ) )
                     {
                     text.erase(text.length()-1);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                 {
                 return;
@@ -2085,27 +2115,31 @@ namespace stemming
         //---------------------------------------------
         void step_5(string_typeT& text)
             {
-            if (stem<string_typeT>::is_suffix(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "french::step_5");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_5_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::is_suffix(text,
                 /*enn*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ||
-                stem<string_typeT>::is_suffix(text,
+                stem<string_typeT, policyT>::is_suffix(text,
                     /*onn*/
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ||
-                stem<string_typeT>::is_suffix(text,
+                stem<string_typeT, policyT>::is_suffix(text,
                     /*ett*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) ||
-                stem<string_typeT>::is_suffix(text,
+                stem<string_typeT, policyT>::is_suffix(text,
                     /*ell*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                     common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) ||
-                stem<string_typeT>::is_suffix(text,
+                stem<string_typeT, policyT>::is_suffix(text,
                     /*eill*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
@@ -2113,63 +2147,245 @@ namespace stemming
                     common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
             }
         //---------------------------------------------
         void step_6(string_typeT& text)
             {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "french::step_6");
             const size_t last_vowel = text.find_last_of(FRENCH_VOWELS);
             if (last_vowel == string_typeT::npos ||
                 last_vowel == text.length()-1)
                 {
                 return;
                 }
-            else if (stem<string_typeT>::is_either(text[last_vowel],
+            else if (stem<string_typeT, policyT>::is_either(text[last_vowel],
                 common_lang_constants::LOWER_E_ACUTE, common_lang_constants::LOWER_E_GRAVE) ||
-                    stem<string_typeT>::is_either(text[last_vowel],
+                    stem<string_typeT, policyT>::is_either(text[last_vowel],
                         common_lang_constants::UPPER_E_ACUTE, common_lang_constants::UPPER_E_GRAVE) )
                 {
                 text[last_vowel] = common_lang_constants::LOWER_E;
                 }
             }
 
-        //---------------------------------------------
-        void remove_elisions(string_typeT& text)
+        /** @brief Removes any elision, hashes y, u, i, ë, and ï, and finds R1, R2, and RV.
+            @details This does the work of removing the elision, hash_french_yui(),
+                hash_french_ei_diaeresis(), find_r1(), find_r2(), and find_french_rv()
+                in one forward scan. The elision is skipped over during the scan (and
+                erased once afterwards) and the regions are counted as if ë and ï were
+                already split into their hash and vowel characters, so only words with a
+                diaeresis (which are rare) need a second pass to insert those.
+            @param[in,out] text The word to prepare.*/
+        void prepare_word(string_typeT& text)
             {
-            if (text.length() > 2 && stem<string_typeT>::is_apostrophe(text[1]) &&
-                (stem<string_typeT>::is_either(text[0],
+            const size_t start{ get_elision_length(text) };
+
+            size_t r1{ string_typeT::npos };
+            size_t r2{ string_typeT::npos };
+            size_t rv{ string_typeT::npos };
+            bool r1_vowel_found{ false };
+            bool r2_vowel_found{ false };
+            bool rv_consonant_found{ false };
+            // where the current letter will be once the elision is removed
+            // and the diaereses are hashed
+            size_t position{ 0 };
+            // R1 (and R2 after it) is the region after the first non-vowel following a vowel,
+            // and RV (unless it is one of the exceptions below) is the region after the first
+            // vowel following a non-vowel
+            const auto scan_letter = [&](const bool is_vowel) noexcept
+                {
+                if (r1 == string_typeT::npos)
+                    {
+                    if (is_vowel)
+                        { r1_vowel_found = true; }
+                    else if (r1_vowel_found)
+                        { r1 = position + 1; }
+                    }
+                else if (r2 == string_typeT::npos)
+                    {
+                    if (is_vowel)
+                        { r2_vowel_found = true; }
+                    else if (r2_vowel_found)
+                        { r2 = position + 1; }
+                    }
+                if (rv == string_typeT::npos)
+                    {
+                    if (!is_vowel)
+                        { rv_consonant_found = true; }
+                    else if (rv_consonant_found)
+                        { rv = position + 1; }
+                    }
+                ++position;
+                };
+
+            // same rules as hash_french_yui(), where the next letter is still unhashed
+            // and the previous one already is
+            bool in_vowel_block{ false };
+            bool has_diaeresis{ false };
+            for (size_t i = start; i < text.length(); ++i)
+                {
+                const bool is_vowel{ VOWELS.contains(text[i]) };
+                const bool follows_q{ i > start &&
+                    stem<string_typeT, policyT>::is_either_case(text[i-1],
+                        common_lang_constants::LOWER_Q, common_lang_constants::UPPER_Q) };
+                if (i + 1 < text.length())
+                    {
+                    const bool next_is_vowel{ VOWELS.contains(text[i+1]) };
+                    if (in_vowel_block && is_vowel && next_is_vowel)
+                        {
+                        if (is_yui(text[i]))
+                            {
+                            text[i] = hash_yui(text[i]);
+                            in_vowel_block = false;
+                            }
+                        }
+                    // y after a vowel, or y before a vowel (other than another y)
+                    else if (is_y(text[i]) &&
+                             (in_vowel_block || (next_is_vowel && !is_y(text[i+1]))))
+                        {
+                        text[i] = hash_yui(text[i]);
+                        in_vowel_block = false;
+                        }
+                    else if (is_vowel)
+                        {
+                        if (is_u(text[i]) && follows_q)
+                            {
+                            text[i] = hash_yui(text[i]);
+                            in_vowel_block = false;
+                            }
+                        else
+                            { in_vowel_block = true; }
+                        }
+                    else
+                        { in_vowel_block = false; }
+                    }
+                // last letter
+                else if ((is_y(text[i]) && i > start && VOWELS.contains(text[i-1])) ||
+                         (is_u(text[i]) && follows_q))
+                    {
+                    text[i] = hash_yui(text[i]);
+                    }
+
+                if (is_ei_diaeresis(text[i]))
+                    {
+                    has_diaeresis = true;
+                    scan_letter(false);
+                    scan_letter(true);
+                    }
+                else
+                    { scan_letter(VOWELS.contains(text[i])); }
+                }
+
+            if (start > 0)
+                { text.erase(0, start); }
+            if (has_diaeresis)
+                { stem<string_typeT, policyT>::hash_french_ei_diaeresis(text); }
+
+            stem<string_typeT, policyT>::set_r1((r1 == string_typeT::npos) ? text.length() : r1);
+            stem<string_typeT, policyT>::set_r2((r2 == string_typeT::npos) ? text.length() : r2);
+            if (text.length() < 3)
+                { rv = text.length(); }
+            else if (stem<string_typeT, policyT>::has_french_rv_prefix(text, FRENCH_VOWELS) ||
+                     (VOWELS.contains(text[0]) && VOWELS.contains(text[1])))
+                { rv = 3; }
+            stem<string_typeT, policyT>::set_rv((rv == string_typeT::npos) ? text.length() : rv);
+            }
+
+        /** @returns The length of the elision (e.g., "l'" or "qu'") in front of the word,
+                along with any apostrophe after it.
+            @param text The word to review.*/
+        [[nodiscard]]
+        size_t get_elision_length(const string_typeT& text) const
+            {
+            if constexpr (policyT::skip_elisions)
+                { return 0; }
+            size_t length{ 0 };
+            if (text.length() > 2 && stem<string_typeT, policyT>::is_apostrophe(text[1]) &&
+                (stem<string_typeT, policyT>::is_either(text[0],
                     common_lang_constants::LOWER_C, common_lang_constants::LOWER_C) ||
-                 stem<string_typeT>::is_either(text[0],
+                 stem<string_typeT, policyT>::is_either(text[0],
                     common_lang_constants::LOWER_D, common_lang_constants::LOWER_D) ||
-                 stem<string_typeT>::is_either(text[0],
+                 stem<string_typeT, policyT>::is_either(text[0],
                     common_lang_constants::LOWER_J, common_lang_constants::LOWER_J) ||
-                 stem<string_typeT>::is_either(text[0],
+                 stem<string_typeT, policyT>::is_either(text[0],
                     common_lang_constants::LOWER_L, common_lang_constants::LOWER_L) ||
-                 stem<string_typeT>::is_either(text[0],
+                 stem<string_typeT, policyT>::is_either(text[0],
                     common_lang_constants::LOWER_M, common_lang_constants::LOWER_M) ||
-                 stem<string_typeT>::is_either(text[0],
+                 stem<string_typeT, policyT>::is_either(text[0],
                     common_lang_constants::LOWER_N, common_lang_constants::LOWER_N) ||
-                 stem<string_typeT>::is_either(text[0],
+                 stem<string_typeT, policyT>::is_either(text[0],
                     common_lang_constants::LOWER_S, common_lang_constants::LOWER_S) ||
-                 stem<string_typeT>::is_either(text[0],
+                 stem<string_typeT, policyT>::is_either(text[0],
                     common_lang_constants::LOWER_T, common_lang_constants::LOWER_T)))
                 {
-                text.erase(0, 2);
+                length = 2;
                 }
-            else if (text.length() > 3 && stem<string_typeT>::is_apostrophe(text[2]) &&
-                stem<string_typeT>::is_either(text[0],
+            else if (text.length() > 3 && stem<string_typeT, policyT>::is_apostrophe(text[2]) &&
+                stem<string_typeT, policyT>::is_either(text[0],
                     common_lang_constants::LOWER_Q, common_lang_constants::LOWER_U) &&
-                stem<string_typeT>::is_either(text[0],
+                stem<string_typeT, policyT>::is_either(text[0],
                     common_lang_constants::LOWER_Q, common_lang_constants::LOWER_U))
                 {
-                text.erase(0, 3);
+                length = 3;
                 }
 
             // any remaining apostrophe in front of the string
-            if (!text.empty() && stem<string_typeT>::is_apostrophe(text[0]))
-                {
-                text.erase(0, 1);
+            if (length < text.length() && stem<string_typeT, policyT>::is_apostrophe(text[length]))
+                { ++length; }
+            return length;
+            }
+
+        /// @returns @c true if @c ch is y or Y.
+        [[nodiscard]]
+        static constexpr bool is_y(const wchar_t ch) noexcept
+            { return (ch == common_lang_constants::LOWER_Y || ch == common_lang_constants::UPPER_Y); }
+
+        /// @returns @c true if @c ch is u or U.
+        [[nodiscard]]
+        static constexpr bool is_u(const wchar_t ch) noexcept
+            { return (ch == common_lang_constants::LOWER_U || ch == common_lang_constants::UPPER_U); }
+
+        /// @returns @c true if @c ch is y, u, or i (in either case).
+        [[nodiscard]]
+        static constexpr bool is_yui(const wchar_t ch) noexcept
+            {
+            return (is_y(ch) || is_u(ch) ||
+                    ch == common_lang_constants::LOWER_I || ch == common_lang_constants::UPPER_I);
+            }
+
+        /// @returns @c true if @c ch is ë or ï (in either case).
+        [[nodiscard]]
+        static constexpr bool is_ei_diaeresis(const wchar_t ch) noexcept
+            {
+            return (ch == common_lang_constants::LOWER_I_UMLAUTS ||
+                    ch == common_lang_constants::UPPER_I_UMLAUTS ||
+                    ch == common_lang_constants::LOWER_E_UMLAUTS ||
+                    ch == common_lang_constants::UPPER_E_UMLAUTS);
+            }
+
+        /// @returns The hashed version of y, u, or i (or @c ch if it is none of those).
+        /// @param ch The letter to hash.
+        [[nodiscard]]
+        static constexpr wchar_t hash_yui(const wchar_t ch) noexcept
+            {
+            switch (ch)
+                {
+                case common_lang_constants::LOWER_Y:
+                    return LOWER_Y_HASH;
+                case common_lang_constants::UPPER_Y:
+                    return UPPER_Y_HASH;
+                case common_lang_constants::LOWER_U:
+                    return LOWER_U_HASH;
+                case common_lang_constants::UPPER_U:
+                    return UPPER_U_HASH;
+                case common_lang_constants::LOWER_I:
+                    return LOWER_I_HASH;
+                case common_lang_constants::UPPER_I:
+                    return UPPER_I_HASH;
+                default:
+                    return ch;
                 }
             }
 
@@ -2179,30 +2395,30 @@ namespace stemming
             if (suffix.length() >= 3)
                 {
                 // auv
-                if (stem<string_typeT>::is_either(suffix[suffix.length() - 3],
+                if (stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 3],
                         common_lang_constants::LOWER_A, common_lang_constants::LOWER_A) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 2],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 2],
                         common_lang_constants::LOWER_U, common_lang_constants::LOWER_U) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 1],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 1],
                         common_lang_constants::LOWER_V, common_lang_constants::LOWER_V))
                     {
                     return false;
                     }
                 // al proceeded by one character
                 if (suffix.length() == 3 &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 2],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 2],
                         common_lang_constants::LOWER_A, common_lang_constants::LOWER_A) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 1],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 1],
                         common_lang_constants::LOWER_L, common_lang_constants::LOWER_L))
                     {
                     return false;
                     }
                 // épl
-                if (stem<string_typeT>::is_either(suffix[suffix.length() - 3],
+                if (stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 3],
                         common_lang_constants::LOWER_E_ACUTE, common_lang_constants::LOWER_E_ACUTE) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 2],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 2],
                         common_lang_constants::LOWER_P, common_lang_constants::LOWER_P) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 1],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 1],
                         common_lang_constants::LOWER_L, common_lang_constants::LOWER_L))
                     {
                     return false;
@@ -2213,6 +2429,21 @@ namespace stemming
 
         // internal data specific to French stemmer
         bool m_step_1_successful{ false };
+
+        // the same letters as FRENCH_VOWELS
+        static constexpr character_bitmap VOWELS{ L"aeiouyâàëéêèïîôûù" };
+
+        // the characters that the suffixes of each step can end with
+        // (step 3 only follows a removal and step 6 looks at any trailing consonants,
+        //  so those are always run)
+        static constexpr character_bitmap STEP_1_ENDINGS{ L'c', L'e', L'f', L'l', L'n', L'r', L's',
+            L't', L'v', L'x', common_lang_constants::LOWER_E_ACUTE, LOWER_U_HASH, UPPER_U_HASH };
+        static constexpr character_bitmap STEP_2A_ENDINGS{ L"aeirstz" };
+        static constexpr character_bitmap STEP_2B_ENDINGS{ L"aeirstzé" };
+        static constexpr character_bitmap STEP_4_ENDINGS{ L"enrsë" };
+        static constexpr character_bitmap STEP_5_ENDINGS{ L"lnt" };
+        static constexpr character_bitmap SUFFIX_STEP_ENDINGS{ STEP_1_ENDINGS | STEP_2A_ENDINGS |
+            STEP_2B_ENDINGS | STEP_4_ENDINGS | STEP_5_ENDINGS };
         };
     }
 
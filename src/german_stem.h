@@ -20,8 +20,8 @@ namespace stemming
     @brief German stemmer.
     */
     //------------------------------------------------------
-    template <typename string_typeT = std::wstring>
-    class german_stem final : public stem<string_typeT>
+    template <typename string_typeT = std::wstring, typename policyT = default_stem_policy>
+    class german_stem final : public stem<string_typeT, policyT>
         {
     public:
         /** @brief Set to @c true (the default) to use the algorithm that expands "ä" to "ae", etc...
@@ -40,88 +40,181 @@ namespace stemming
         /** @param[in,out] text string to stem.*/
         void operator()(string_typeT& text) final
             {
+            stem<string_typeT, policyT>::normalize_input(text);
             if (text.length() < 2)
                 {
-                stem<string_typeT>::remove_german_umlauts(text);
+                stem<string_typeT, policyT>::remove_german_umlauts(text);
                 return;
                 }
 
             // reset internal data
-            stem<string_typeT>::reset_r_values();
+            stem<string_typeT, policyT>::reset_r_values();
 
-            std::transform(text.begin(), text.end(), text.begin(), full_width_to_narrow);
-            stem<string_typeT>::remove_possessive_suffix(text);
+            stem<string_typeT, policyT>::remove_possessive_suffix(text);
 
-            stem<string_typeT>::hash_german_yu(text, GERMAN_VOWELS);
-            // change 'ß' to "ss"
-            stem<string_typeT>::replace_all(text, string_typeT(1, common_lang_constants::ESZETT), L"ss");
-            // German variant addition
-            if (is_transliterating_umlauts())
+            prepare_word(text);
+
+            // none of the steps can remove anything from this word (e.g., it ends with a digit)
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, ALL_STEP_ENDINGS))
                 {
-                stem<string_typeT>::replace_all(text, L"ae",
-                    string_typeT(1, common_lang_constants::LOWER_A_UMLAUTS));
-                stem<string_typeT>::replace_all(text, L"oe",
-                    string_typeT(1, common_lang_constants::LOWER_O_UMLAUTS));
-                // ue to ü, if not in front of 'q'
-                size_t start = 1;
-                while (start != string_typeT::npos)
-                    {
-                    start = text.find(L"ue", start);
-                    if (start == string_typeT::npos ||
-                        stem<string_typeT>::is_either(text[start-1],
-                            common_lang_constants::LOWER_Q, common_lang_constants::UPPER_Q) )
-                        {
-                        break;
-                        }
-                    text.replace(start, 2, string_typeT(1, common_lang_constants::LOWER_U_UMLAUTS));
-                    }
+                restore_word(text);
+                return;
                 }
 
-            stem<string_typeT>::find_r1(text, GERMAN_VOWELS);
-            if (stem<string_typeT>::get_r1() == text.length() )
+            stem<string_typeT, policyT>::find_r1(text, GERMAN_VOWELS);
+            if (stem<string_typeT, policyT>::get_r1() == text.length() )
                 {
-                stem<string_typeT>::remove_german_umlauts(text);
-                stem<string_typeT>::unhash_german_yu(text);
+                restore_word(text);
                 return;
                 }
-            stem<string_typeT>::find_r2(text, GERMAN_VOWELS);
+            stem<string_typeT, policyT>::find_r2(text, GERMAN_VOWELS);
             // R1 must have at least 3 characters in front of it
-            if (stem<string_typeT>::get_r1() < 3)
+            if (stem<string_typeT, policyT>::get_r1() < 3)
                 {
-                stem<string_typeT>::set_r1(3);
+                stem<string_typeT, policyT>::set_r1(3);
                 }
 
             step_1(text);
             step_2(text);
-            step_3(text);
+            // step 3 removes derivational suffixes
+            if constexpr (!policyT::light_stemming)
+                { step_3(text); }
 
-            // unhash special 'u' and 'y' back, and remove the umlaut accent from a, o and u. 
-            stem<string_typeT>::remove_german_umlauts(text);
-            stem<string_typeT>::unhash_german_yu(text);
+            restore_word(text);
             }
     private:
+        /** @brief Hashes u and y between vowels, changes ß to ss, and (if transliterating
+                umlauts) changes ae, oe, and ue to ä, ö, and ü, all in one pass.
+            @details The word is compacted in place, with the write position trailing
+                the read position by the number of letters merged so far. Only a ß read
+                when nothing has been merged yet needs the rest of the word moved over.\n
+                ue is not changed at the start of the word, and once a que is found,
+                no further ue is changed.
+            @param[in,out] text The word to prepare.*/
+        void prepare_word(string_typeT& text)
+            {
+            size_t write{ 0 };
+            // whether the previous letter (before being hashed) is a vowel
+            bool previous_is_vowel{ false };
+            bool merge_ue{ is_transliterating_umlauts() };
+            for (size_t read = 0; read < text.length(); ++read)
+                {
+                wchar_t ch = text[read];
+                if (ch == common_lang_constants::ESZETT)
+                    {
+                    if (write == read)
+                        { text.insert(read++, 1, common_lang_constants::LOWER_S); }
+                    text[write++] = common_lang_constants::LOWER_S;
+                    text[write++] = common_lang_constants::LOWER_S;
+                    previous_is_vowel = false;
+                    continue;
+                    }
+
+                const bool is_vowel{ VOWELS.contains(ch) };
+                // u or y between vowels
+                if (previous_is_vowel && is_vowel &&
+                    read + 1 < text.length() && VOWELS.contains(text[read + 1]))
+                    {
+                    ch = (ch == common_lang_constants::LOWER_Y) ? LOWER_Y_HASH :
+                         (ch == common_lang_constants::UPPER_Y) ? UPPER_Y_HASH :
+                         (ch == common_lang_constants::LOWER_U) ? LOWER_U_HASH :
+                         (ch == common_lang_constants::UPPER_U) ? UPPER_U_HASH :
+                         ch;
+                    }
+                previous_is_vowel = is_vowel;
+
+                if (ch == common_lang_constants::LOWER_E && write > 0 &&
+                    is_transliterating_umlauts())
+                    {
+                    auto& previous = text[write - 1];
+                    if (previous == common_lang_constants::LOWER_A)
+                        {
+                        previous = common_lang_constants::LOWER_A_UMLAUTS;
+                        continue;
+                        }
+                    else if (previous == common_lang_constants::LOWER_O)
+                        {
+                        previous = common_lang_constants::LOWER_O_UMLAUTS;
+                        continue;
+                        }
+                    else if (previous == common_lang_constants::LOWER_U && write > 1 && merge_ue)
+                        {
+                        if (stem<string_typeT, policyT>::is_either_case(text[write - 2],
+                                common_lang_constants::LOWER_Q, common_lang_constants::UPPER_Q))
+                            { merge_ue = false; }
+                        else
+                            {
+                            previous = common_lang_constants::LOWER_U_UMLAUTS;
+                            continue;
+                            }
+                        }
+                    }
+                text[write++] = ch;
+                }
+            text.erase(write);
+            }
+
+        /// @brief Unhashes u and y and removes the umlauts from ä, ö, and ü, in one pass.
+        /// @param[in,out] text The stemmed word.
+        static void restore_word(string_typeT& text)
+            {
+            std::transform(text.cbegin(), text.cend(), text.begin(),
+                [](const auto& ch) noexcept
+                {
+                switch (ch)
+                    {
+                    case common_lang_constants::LOWER_A_UMLAUTS:
+                        return common_lang_constants::LOWER_A;
+                    case common_lang_constants::UPPER_A_UMLAUTS:
+                        return common_lang_constants::UPPER_A;
+                    case common_lang_constants::LOWER_O_UMLAUTS:
+                        return common_lang_constants::LOWER_O;
+                    case common_lang_constants::UPPER_O_UMLAUTS:
+                        return common_lang_constants::UPPER_O;
+                    case common_lang_constants::LOWER_U_UMLAUTS:
+                        [[fallthrough]];
+                    case LOWER_U_HASH:
+                        return common_lang_constants::LOWER_U;
+                    case common_lang_constants::UPPER_U_UMLAUTS:
+                        [[fallthrough]];
+                    case UPPER_U_HASH:
+                        return common_lang_constants::UPPER_U;
+                    case LOWER_Y_HASH:
+                        return common_lang_constants::LOWER_Y;
+                    case UPPER_Y_HASH:
+                        return common_lang_constants::UPPER_Y;
+                    default:
+                        return static_cast<wchar_t>(ch);
+                    }
+                });
+            }
+
         //---------------------------------------------
         void step_1(string_typeT& text)
             {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "german::step_1");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_1_ENDINGS))
+                { return; }
             bool groupCDeleted{ false };
             // 'em', but not if 'system'
-            if ((stem<string_typeT>::is_suffix(text,
+            if ((stem<string_typeT, policyT>::is_suffix(text,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M)) &&
-                !(stem<string_typeT>::is_suffix(text,
+                !(stem<string_typeT, policyT>::is_suffix(text,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                     common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M)) &&
-                stem<string_typeT>::delete_if_is_in_r1(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*em*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M) )
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*erinnen*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -133,7 +226,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*erin*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -142,7 +235,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*ern*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -150,62 +243,62 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /*lns*/
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 text.erase(text.length() - 2);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /*ln*/
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) )
                 {
                 text.erase(text.length() - 1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*er*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) )
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*es*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 groupCDeleted = true;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*en*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) )
                 {
                 groupCDeleted = true;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                 {
                 groupCDeleted = true;
                 }
             // Define a valid s-ending as one of b, d, f, g, h, k, l, m, n, r or t.
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
-                if (stem<string_typeT>::is_one_of(text[text.length()-2], L"bdfghklmnrtBDFGHKLMNRT") )
+                if (stem<string_typeT, policyT>::is_one_of(text[text.length()-2], L"bdfghklmnrtBDFGHKLMNRT") )
                     {
                     text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
 
             if (groupCDeleted && text.length() > 4 &&
-                stem<string_typeT>::is_suffix(text,
+                stem<string_typeT, policyT>::is_suffix(text,
                           common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                           common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                           common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -215,20 +308,24 @@ namespace stemming
         //---------------------------------------------
         void step_2(string_typeT& text)
             {
-            if (stem<string_typeT>::delete_if_is_in_r1(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "german::step_2");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_2_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*est*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*er*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) )
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*en*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) )
                 {
@@ -236,20 +333,20 @@ namespace stemming
                 }
             // Define a valid st-ending as the same list, excluding letter r.
             else if (text.length() >= 6 &&
-                    stem<string_typeT>::is_suffix_in_r1(text,
+                    stem<string_typeT, policyT>::is_suffix_in_r1(text,
                         /*st*/
                         common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
-                if (stem<string_typeT>::is_one_of(text[text.length()-3], L"bdfghklmntBDFGHKLMNT"))
+                if (stem<string_typeT, policyT>::is_one_of(text[text.length()-3], L"bdfghklmntBDFGHKLMNT"))
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
             else if (text.length() >= 4 &&
-                    stem<string_typeT>::is_suffix_in_r1(text,
+                    stem<string_typeT, policyT>::is_suffix_in_r1(text,
                         /*et*/
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
@@ -259,12 +356,12 @@ namespace stemming
                     L's', L't', L'z', L'ä', L'D', L'F', L'G', L'K',
                     L'L', L'M', L'N', L'R', L'S', L'T', L'Z', L'Ä',
                     UPPER_U_HASH, LOWER_U_HASH, 0 };
-                if (stem<string_typeT>::is_one_of(text[text.length() - 3], VALID_ET_SUFFIX_CHARACTERS) &&
+                if (stem<string_typeT, policyT>::is_one_of(text[text.length() - 3], VALID_ET_SUFFIX_CHARACTERS) &&
                     has_et_suffix(std::basic_string_view<typename string_typeT::value_type>
                                   { text.c_str(), text.length() - 2 }))
                     {
                     text.erase(text.length() - 2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
@@ -272,21 +369,25 @@ namespace stemming
         //---------------------------------------------
         void step_3(string_typeT& text)
             {
-            if (stem<string_typeT>::delete_if_is_in_r2(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "german::step_3");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_3_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*heit*/common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*lich*/common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
                     common_lang_constants::LOWER_H, common_lang_constants::UPPER_H) )
                 {
-                if (stem<string_typeT>::delete_if_is_in_r1(text,
+                if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                     /*er*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) ||
-                    stem<string_typeT>::delete_if_is_in_r1(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                         /*en*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                         common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) )
                     {
@@ -294,18 +395,18 @@ namespace stemming
                     }
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*keit*/common_lang_constants::LOWER_K, common_lang_constants::UPPER_K,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
-                if (stem<string_typeT>::delete_if_is_in_r2(text,
+                if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*lich*/common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
                         common_lang_constants::LOWER_H, common_lang_constants::UPPER_H) ||
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ig*/common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) )
                     {
@@ -313,79 +414,79 @@ namespace stemming
                     }
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*isch*/common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                 common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
                 common_lang_constants::LOWER_H, common_lang_constants::UPPER_H) )
                 {
                 if (text.length() >= 5 &&
-                    stem<string_typeT>::get_r2() <= (text.length()-4) &&
-                    stem<string_typeT>::is_neither(text[text.length()-5],
+                    stem<string_typeT, policyT>::get_r2() <= (text.length()-4) &&
+                    stem<string_typeT, policyT>::is_neither(text[text.length()-5],
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                     {
                     text.erase(text.length()-4);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*end*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) )
                 {
                 if (text.length() >= 3 &&
-                    stem<string_typeT>::is_suffix_in_r2(text,
+                    stem<string_typeT, policyT>::is_suffix_in_r2(text,
                         /*ig*/common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_G, common_lang_constants::UPPER_G)  &&
-                    stem<string_typeT>::is_neither(text[text.length()-3],
+                    stem<string_typeT, policyT>::is_neither(text[text.length()-3],
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ung*/common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                 common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) )
                 {
                 if (text.length() >= 3 &&
-                    stem<string_typeT>::is_suffix_in_r2(text,
+                    stem<string_typeT, policyT>::is_suffix_in_r2(text,
                         /*ig*/common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_G, common_lang_constants::UPPER_G)  &&
-                    stem<string_typeT>::is_neither(text[text.length()-3],
+                    stem<string_typeT, policyT>::is_neither(text[text.length()-3],
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*ig*/common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) )
                 {
                 if (text.length() >= 3 &&
-                    stem<string_typeT>::get_r2() <= text.length()-2 &&
-                    stem<string_typeT>::is_neither(text[text.length()-3],
+                    stem<string_typeT, policyT>::get_r2() <= text.length()-2 &&
+                    stem<string_typeT, policyT>::is_neither(text[text.length()-3],
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*ik*/common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_K, common_lang_constants::UPPER_K) )
                 {
                 if (text.length() >= 3 &&
-                    stem<string_typeT>::get_r2() <= text.length()-2 &&
-                    stem<string_typeT>::is_neither(text[text.length()-3],
+                    stem<string_typeT, policyT>::get_r2() <= text.length()-2 &&
+                    stem<string_typeT, policyT>::is_neither(text[text.length()-3],
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             }
@@ -397,69 +498,69 @@ namespace stemming
                 {
                 // geordn
                 if (suffix.length() >= 6 &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 6],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 6],
                         common_lang_constants::LOWER_G, common_lang_constants::LOWER_G) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 5],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 5],
                         common_lang_constants::LOWER_E, common_lang_constants::LOWER_E) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 4],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 4],
                         common_lang_constants::LOWER_O, common_lang_constants::LOWER_O) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 3],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 3],
                         common_lang_constants::LOWER_R, common_lang_constants::LOWER_R) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 2],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 2],
                         common_lang_constants::LOWER_D, common_lang_constants::LOWER_D) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 1],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 1],
                         common_lang_constants::LOWER_N, common_lang_constants::LOWER_N))
                     {
                     return false;
                     }
                 // intern
                 if (suffix.length() >= 6 &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 6],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 6],
                         common_lang_constants::LOWER_I, common_lang_constants::LOWER_I) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 5],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 5],
                         common_lang_constants::LOWER_N, common_lang_constants::LOWER_N) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 4],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 4],
                         common_lang_constants::LOWER_T, common_lang_constants::LOWER_T) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 3],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 3],
                         common_lang_constants::LOWER_E, common_lang_constants::LOWER_E) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 2],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 2],
                         common_lang_constants::LOWER_R, common_lang_constants::LOWER_R) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 1],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 1],
                         common_lang_constants::LOWER_N, common_lang_constants::LOWER_N))
                     {
                     return false;
                     }
                 // tick
                 if (suffix.length() >= 4 &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 4],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 4],
                         common_lang_constants::LOWER_T, common_lang_constants::LOWER_T) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 3],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 3],
                         common_lang_constants::LOWER_I, common_lang_constants::LOWER_I) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 2],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 2],
                         common_lang_constants::LOWER_C, common_lang_constants::LOWER_C) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 1],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 1],
                         common_lang_constants::LOWER_K, common_lang_constants::LOWER_K))
                     {
                     return false;
                     }
                 // plan
                 if (suffix.length() >= 4 &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 4],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 4],
                         common_lang_constants::LOWER_P, common_lang_constants::LOWER_P) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 3],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 3],
                         common_lang_constants::LOWER_L, common_lang_constants::LOWER_L) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 2],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 2],
                         common_lang_constants::LOWER_A, common_lang_constants::LOWER_A) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 1],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 1],
                         common_lang_constants::LOWER_N, common_lang_constants::LOWER_N))
                     {
                     return false;
                     }
                 // tr
                 if (suffix.length() >= 2 &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 2],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 2],
                         common_lang_constants::LOWER_T, common_lang_constants::LOWER_T) &&
-                    stem<string_typeT>::is_either(suffix[suffix.length() - 1],
+                    stem<string_typeT, policyT>::is_either(suffix[suffix.length() - 1],
                         common_lang_constants::LOWER_R, common_lang_constants::LOWER_R))
                     {
                     return false;
@@ -469,6 +570,14 @@ namespace stemming
             }
 
         bool m_transliterate_umlauts{ true };
+
+        // the characters that the suffixes of each step can end with
+        static constexpr character_bitmap STEP_1_ENDINGS{ L"emnrs" };
+        static constexpr character_bitmap STEP_2_ENDINGS{ L"nrt" };
+        static constexpr character_bitmap STEP_3_ENDINGS{ L"dghknrt" };
+        static constexpr character_bitmap ALL_STEP_ENDINGS{
+            STEP_1_ENDINGS | STEP_2_ENDINGS | STEP_3_ENDINGS };
+        static constexpr character_bitmap VOWELS{ L"aeiouyäöü" };
         };
     }
 
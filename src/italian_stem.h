@@ -20,8 +20,8 @@ namespace stemming
         @brief Italian stemmer.
     */
     //------------------------------------------------------
-    template <typename string_typeT = std::wstring>
-    class italian_stem final : public stem<string_typeT>
+    template <typename string_typeT = std::wstring, typename policyT = default_stem_policy>
+    class italian_stem final : public stem<string_typeT, policyT>
         {
     public:
         /** @brief Stems an Italian word.
@@ -29,35 +29,47 @@ namespace stemming
         void operator()(string_typeT& text) final
             {
             // reset internal data
-            stem<string_typeT>::reset_r_values();
+            stem<string_typeT, policyT>::reset_r_values();
 
+            stem<string_typeT, policyT>::normalize_input(text);
             if (is_exception(text))
                 { return; }
 
-            std::transform(text.begin(), text.end(), text.begin(), full_width_to_narrow);
-            stem<string_typeT>::remove_possessive_suffix(text);
-            stem<string_typeT>::italian_acutes_to_graves(text);
+            stem<string_typeT, policyT>::remove_possessive_suffix(text);
+            stem<string_typeT, policyT>::italian_acutes_to_graves(text);
             if (text.length() < 3)
                 { return; }
-            stem<string_typeT>::hash_italian_ui(text, ITALIAN_VOWELS);
+            stem<string_typeT, policyT>::hash_italian_ui(text, ITALIAN_VOWELS);
+            // words ending with something like a digit can't have any of the suffixes
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, ALL_STEP_ENDINGS))
+                {
+                stem<string_typeT, policyT>::unhash_italian_ui(text);
+                return;
+                }
 
-            stem<string_typeT>::find_r1(text, ITALIAN_VOWELS);
-            stem<string_typeT>::find_r2(text, ITALIAN_VOWELS);
-            stem<string_typeT>::find_spanish_rv(text, ITALIAN_VOWELS);
+            stem<string_typeT, policyT>::find_r1(text, ITALIAN_VOWELS);
+            stem<string_typeT, policyT>::find_r2(text, ITALIAN_VOWELS);
+            stem<string_typeT, policyT>::find_spanish_rv(text, ITALIAN_VOWELS);
 
-            step_0(text);
+            // light stemming leaves attached pronouns (step 0) and verb suffixes (step 2) alone
+            if constexpr (policyT::light_stemming)
+                { step_1(text); }
+            else
+                {
+                step_0(text);
 
-            const size_t text_length = text.length();
-            step_1(text);
+                const size_t text_length = text.length();
+                step_1(text);
 
-            // step 2 is called only if step 1 did not remove a suffix
-            if (text_length == text.length() )
-                { step_2(text); }
+                // step 2 is called only if step 1 did not remove a suffix
+                if (text_length == text.length() )
+                    { step_2(text); }
+                }
 
             step_3a(text);
             step_3b(text);
 
-            stem<string_typeT>::unhash_italian_ui(text);
+            stem<string_typeT, policyT>::unhash_italian_ui(text);
             }
         /// @returns The stemmer's language.
         [[nodiscard]]
@@ -69,7 +81,7 @@ namespace stemming
         bool is_exception(string_typeT& text)
             {
             if (text.length() == 6 &&
-                stem<string_typeT>::is_suffix(text,
+                stem<string_typeT, policyT>::is_suffix(text,
                     common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -85,431 +97,30 @@ namespace stemming
         //---------------------------------------------
         void step_0(string_typeT& text)
             {
-            if (stem<string_typeT>::is_suffix(text,
-                /*gliela*/
-                common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) )
-                {
-                if (step_0a(text, 6) || step_0b(text, 6) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*gliele*/
-                common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
-                {
-                if (step_0a(text, 6) || step_0b(text, 6) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*glieli*/
-                common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
-                {
-                if (step_0a(text, 6) || step_0b(text, 6) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*glielo*/
-                common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) )
-                {
-                if (step_0a(text, 6) || step_0b(text, 6) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*gliene*/
-                common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
-                {
-                if (step_0a(text, 6) || step_0b(text, 6) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*sene*/
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*mela*/
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*mele*/
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*meli*/
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*melo*/
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*mene*/
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*tela*/
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*tele*/
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*teli*/
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*telo*/
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*tene*/
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*cela*/
-                common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*cela*/
-                common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*celi*/
-                common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*celo*/
-                common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*cene*/
-                common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*vela*/
-                common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*vele*/
-                common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*veli*/
-                common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*velo*/
-                common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*vene*/
-                common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
-                {
-                if (step_0a(text, 4) || step_0b(text, 4) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*gli*/
-                common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
-                {
-                if (step_0a(text, 3) || step_0b(text, 3) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*ci*/
-                common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
-                {
-                if (step_0a(text, 2) || step_0b(text, 2) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*la*/
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) )
-                {
-                if (step_0a(text, 2) || step_0b(text, 2) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*le*/
-                common_lang_constants::LOWER_L,
-                common_lang_constants::UPPER_L, common_lang_constants::LOWER_E,
-                common_lang_constants::UPPER_E) )
-                {
-                if (step_0a(text, 2) || step_0b(text, 2) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*li*/
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
-                {
-                if (step_0a(text, 2) || step_0b(text, 2) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*lo*/
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) )
-                {
-                if (step_0a(text, 2) || step_0b(text, 2) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*mi*/
-                common_lang_constants::LOWER_M,
-                common_lang_constants::UPPER_M, common_lang_constants::LOWER_I,
-                common_lang_constants::UPPER_I) )
-                {
-                if (step_0a(text, 2) || step_0b(text, 2) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*ne*/
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
-                {
-                if (step_0a(text, 2) || step_0b(text, 2) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*si*/
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
-                {
-                if (step_0a(text, 2) || step_0b(text, 2) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*ti*/
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
-                {
-                if (step_0a(text, 2) || step_0b(text, 2) ) { /*NOOP*/ }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix(text,
-                /*vi*/
-                common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
-                {
-                if (step_0a(text, 2) || step_0b(text, 2) ) { /*NOOP*/ }
-                return;
-                }
-            }
-        //---------------------------------------------
-        bool step_0a(string_typeT& text, size_t suffix_length)
-            {
-            if (text.length() >= (suffix_length+4) &&
-                stem<string_typeT>::get_rv() <= text.length()-(4+suffix_length) &&
-                (/*ando*/
-                (stem<string_typeT>::is_either(text[text.length()-(4+suffix_length)],
-                        common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(text[text.length()-(3+suffix_length)],
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                    stem<string_typeT>::is_either(text[text.length()-(2+suffix_length)],
-                        common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) &&
-                    stem<string_typeT>::is_either(text[text.length()-(1+suffix_length)],
-                        common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) ) ||
-                /*endo*/
-                (stem<string_typeT>::is_either(text[text.length()-(4+suffix_length)],
-                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                    stem<string_typeT>::is_either(text[text.length()-(3+suffix_length)],
-                        common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                    stem<string_typeT>::is_either(text[text.length()-(2+suffix_length)],
-                        common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) &&
-                    stem<string_typeT>::is_either(text[text.length()-(1+suffix_length)],
-                        common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) ) ) )
-                {
-                text.erase(text.length()-suffix_length);
-                stem<string_typeT>::update_r_sections(text);
-                return true;
-                }
-            return false;
-            }
-        //---------------------------------------------
-        bool step_0b(string_typeT& text, size_t suffix_length)
-            {
-            if ((text.length() >= suffix_length+2) &&
-                stem<string_typeT>::get_rv() <= (text.length()-(2+suffix_length)) &&
-                (
-                /*ar*/
-                (stem<string_typeT>::is_either(text[text.length()-(2+suffix_length)],
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                stem<string_typeT>::is_either(text[text.length()-1-suffix_length],
-                    common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) ) ||
-                /*er*/
-                (stem<string_typeT>::is_either(text[text.length()-(2+suffix_length)],
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                stem<string_typeT>::is_either(text[text.length()-1-suffix_length],
-                    common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) ) ||
-                /*or*/
-                (stem<string_typeT>::is_either(text[text.length()-(2+suffix_length)],
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                stem<string_typeT>::is_either(text[text.length()-1-suffix_length],
-                    common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) )
-                ) )
-                {
-                text.replace(text.end()-suffix_length, text.end(), L"e");
-                stem<string_typeT>::update_r_sections(text);
-                return true;
-                }
-            return false;
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "italian::step_0");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_0_ENDINGS))
+                { return; }
+            // the pronoun itself doesn't need to be in RV
+            const auto pronoun = stem<string_typeT, policyT>::find_attached_pronoun(text,
+                ATTACHED_PRONOUNS, PRONOUN_VERB_ENDINGS, 0);
+            if (pronoun.m_verb_ending_length == 0)
+                { return; }
+            // deleted after a gerund (ando, endo), replaced with 'e' after an infinitive (ar, er, ir)
+            if (pronoun.m_verb_ending_index < GERUND_COUNT)
+                { text.erase(text.length() - pronoun.m_pronoun_length); }
+            else
+                { text.replace(text.end() - pronoun.m_pronoun_length, text.end(), L"e"); }
+            stem<string_typeT, policyT>::update_r_sections(text);
             }
         //---------------------------------------------
         void step_1(string_typeT& text)
             {
-            if (stem<string_typeT>::delete_if_is_in_rv(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "italian::step_1");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_1_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*amento*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -517,7 +128,7 @@ namespace stemming
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*amenti*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -525,7 +136,7 @@ namespace stemming
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*imento*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -533,7 +144,7 @@ namespace stemming
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*imenti*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -544,7 +155,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*azione*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z,
@@ -553,13 +164,13 @@ namespace stemming
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                 {
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ic*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_C, common_lang_constants::UPPER_C);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*azioni*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z,
@@ -568,14 +179,14 @@ namespace stemming
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
                 {
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ic*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_C, common_lang_constants::UPPER_C);
                 return;
                 }
             else if (
-                stem<string_typeT>::is_suffix_in_r2(text,
+                stem<string_typeT, policyT>::is_suffix_in_r2(text,
                     /*uzione*/
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                     common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z,
@@ -583,7 +194,7 @@ namespace stemming
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                stem<string_typeT>::is_suffix_in_r2(text,
+                stem<string_typeT, policyT>::is_suffix_in_r2(text,
                     /*uzioni*/
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                     common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z,
@@ -591,7 +202,7 @@ namespace stemming
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                stem<string_typeT>::is_suffix_in_r2(text,
+                stem<string_typeT, policyT>::is_suffix_in_r2(text,
                     /*usione*/
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -599,7 +210,7 @@ namespace stemming
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                stem<string_typeT>::is_suffix_in_r2(text,
+                stem<string_typeT, policyT>::is_suffix_in_r2(text,
                     /*usioni*/
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -609,10 +220,10 @@ namespace stemming
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
                 {
                 text.erase(text.length()-5);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                     /*amente*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -621,35 +232,35 @@ namespace stemming
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                 {
-                if (stem<string_typeT>::delete_if_is_in_r2(text,
+                if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*iv*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V) )
                     {
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*at*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T);
                     }
                 else if (
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*abil*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) ||
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ic*/
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_C, common_lang_constants::UPPER_C) ||
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*os*/
                         common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                         common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                     { /*NOOP*/ }
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*atrice*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -657,7 +268,7 @@ namespace stemming
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*atrici*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -668,35 +279,35 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*abile*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*abili*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ibile*/
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ibili*/
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*mente*/
                         common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -706,7 +317,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*atore*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -714,13 +325,13 @@ namespace stemming
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                 {
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ic*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_C, common_lang_constants::UPPER_C);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*atori*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -728,21 +339,21 @@ namespace stemming
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
                 {
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ic*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_C, common_lang_constants::UPPER_C);
                 return;
                 }
             else if (
-                stem<string_typeT>::is_suffix_in_r2(text,
+                stem<string_typeT, policyT>::is_suffix_in_r2(text,
                 /*logia*/
                     common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                     common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) ||
-                stem<string_typeT>::is_suffix_in_r2(text,
+                stem<string_typeT, policyT>::is_suffix_in_r2(text,
                     /*logie*/
                     common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
@@ -751,17 +362,17 @@ namespace stemming
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                 {
                 text.erase(text.length()-2);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
             else if (
-                stem<string_typeT>::is_suffix_in_r2(text,
+                stem<string_typeT, policyT>::is_suffix_in_r2(text,
                     /*enza*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z,
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) ||
-                stem<string_typeT>::is_suffix_in_r2(text,
+                stem<string_typeT, policyT>::is_suffix_in_r2(text,
                     /*enze*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -769,89 +380,89 @@ namespace stemming
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                 {
                 text.replace(text.end()-2, text.end(), L"te");
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
             else if (
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ante*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*anti*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*anza*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z,
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*anze*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                     common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*iche*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
                     common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ichi*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
                     common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ismo*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ismi*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ista*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*iste*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*isti*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*istà*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                     common_lang_constants::LOWER_A_GRAVE, common_lang_constants::UPPER_A_GRAVE) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*istè*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                     common_lang_constants::LOWER_E_GRAVE, common_lang_constants::UPPER_E_GRAVE) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*istì*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -860,7 +471,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ico*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
@@ -868,7 +479,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ici*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
@@ -876,7 +487,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ica*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
@@ -884,7 +495,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ice*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
@@ -892,7 +503,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*oso*/
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -900,7 +511,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*osi*/
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -908,7 +519,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*osa*/
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -916,7 +527,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ose*/
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -924,23 +535,23 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ità*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                     common_lang_constants::LOWER_A_GRAVE, common_lang_constants::UPPER_A_GRAVE) )
                 {
-                if (stem<string_typeT>::delete_if_is_in_r2(text,
+                if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*abil*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) ||
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ic*/
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_C, common_lang_constants::UPPER_C) ||
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*iv*/
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_V, common_lang_constants::UPPER_V) )
@@ -948,33 +559,33 @@ namespace stemming
                 return;
                 }
             else if (
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ivo*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ivi*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*iva*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) ||
-                stem<string_typeT>::delete_if_is_in_r2(text,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ive*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                 {
-                if (stem<string_typeT>::delete_if_is_in_r2(text,
+                if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*at*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                     {
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ic*/
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_C, common_lang_constants::UPPER_C);
@@ -985,7 +596,11 @@ namespace stemming
         //---------------------------------------------
         void step_2(string_typeT& text)
             {
-            if (stem<string_typeT>::delete_if_is_in_rv(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "italian::step_2");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_2_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*erebbero*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -998,7 +613,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*irebbero*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1011,7 +626,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*assero*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1022,7 +637,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*assimo*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1033,7 +648,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*eranno*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1044,7 +659,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*erebbe*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1055,7 +670,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*eremmo*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1066,7 +681,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ereste*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1077,7 +692,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*eresti*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1088,7 +703,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*essero*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1099,7 +714,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*iranno*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1110,7 +725,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*irebbe*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1121,7 +736,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*iremmo*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1132,7 +747,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ireste*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1143,7 +758,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*iresti*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1154,7 +769,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*iscano*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1165,7 +780,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*iscono*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1176,7 +791,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*issero*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1187,7 +802,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*arono*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1197,7 +812,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*avamo*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1207,7 +822,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*avano*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1217,7 +832,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*avate*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1227,7 +842,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*eremo*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1237,7 +852,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*erete*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1247,7 +862,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*erono*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1257,7 +872,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*evamo*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1267,7 +882,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*evano*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1277,7 +892,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*evate*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1287,7 +902,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*iremo*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1297,7 +912,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*irete*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1307,7 +922,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*irono*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1317,7 +932,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ivamo*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1327,7 +942,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ivano*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1337,7 +952,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ivate*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1347,7 +962,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ammo*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -1356,7 +971,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ando*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -1365,7 +980,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*asse*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1374,7 +989,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*assi*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1383,7 +998,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*emmo*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -1392,7 +1007,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*enda*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -1401,7 +1016,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ende*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -1410,7 +1025,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*endi*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -1419,7 +1034,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*endo*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -1428,7 +1043,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*erai*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1437,7 +1052,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*erei*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1446,7 +1061,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*yamo*/
                     common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y,
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
@@ -1455,7 +1070,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*iamo*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
@@ -1464,7 +1079,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*immo*/common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                     common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -1472,7 +1087,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*irai*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1481,7 +1096,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*irei*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1490,7 +1105,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*isca*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1499,7 +1114,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*isce*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1508,7 +1123,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*isci*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1517,7 +1132,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*isco*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1526,7 +1141,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ano*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -1534,7 +1149,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*are*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1542,7 +1157,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ata*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -1550,7 +1165,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ate*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -1558,7 +1173,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ati*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -1566,7 +1181,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ato*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -1574,7 +1189,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ava*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1582,7 +1197,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*avi*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1590,7 +1205,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*avo*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1598,7 +1213,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*erà*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1606,7 +1221,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ere*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1614,7 +1229,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*erò*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1622,7 +1237,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ete*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -1630,7 +1245,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*eva*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1638,7 +1253,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*evi*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1646,7 +1261,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*evo*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1654,7 +1269,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*irà*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1662,7 +1277,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ire*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1670,7 +1285,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*irò*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1678,7 +1293,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ita*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -1686,7 +1301,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ite*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -1694,7 +1309,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*iti*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -1702,7 +1317,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ito*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -1710,7 +1325,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*iva*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1718,7 +1333,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ivi*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1726,7 +1341,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ivo*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1734,7 +1349,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ono*/
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -1742,7 +1357,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*uta*/
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -1750,7 +1365,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ute*/
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -1758,7 +1373,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*uti*/
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -1766,7 +1381,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*uto*/
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
@@ -1774,7 +1389,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ar*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) )
@@ -1782,7 +1397,7 @@ namespace stemming
                 return;
                 }
             // 'ir' not in original specification, but used in general implementation
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ir*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) )
@@ -1795,35 +1410,60 @@ namespace stemming
         //---------------------------------------------
         void step_3a(string_typeT& text)
             {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "italian::step_3a");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_3A_ENDINGS))
+                { return; }
             if (text.length() >= 1 &&
-                stem<string_typeT>::get_rv() <= text.length()-1 &&
-                stem<string_typeT>::is_one_of(text[text.length()-1], ITALIAN_VOWELS_SIMPLE) )
+                stem<string_typeT, policyT>::get_rv() <= text.length()-1 &&
+                stem<string_typeT, policyT>::is_one_of(text[text.length()-1], ITALIAN_VOWELS_SIMPLE) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
-                if (stem<string_typeT>::get_rv() <= text.length()-1 &&
-                    stem<string_typeT>::is_either(text[text.length()-1],
+                stem<string_typeT, policyT>::update_r_sections(text);
+                if (stem<string_typeT, policyT>::get_rv() <= text.length()-1 &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
                     {
                     text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             }
         //---------------------------------------------
         void step_3b(string_typeT& text)
             {
-            if (stem<string_typeT>::is_suffix_in_rv(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "italian::step_3b");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_3B_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                     /*ch*/common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
                 common_lang_constants::LOWER_H, common_lang_constants::UPPER_H) ||
-                stem<string_typeT>::is_suffix_in_rv(text,
+                stem<string_typeT, policyT>::is_suffix_in_rv(text,
                     /*gh*/common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
                     common_lang_constants::LOWER_H, common_lang_constants::UPPER_H) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
             }
+
+        // the pronouns (and the gerunds and infinitives in front of them) removed by step 0
+        static constexpr suffix_trie<56> ATTACHED_PRONOUNS{ L"gliela", L"gliele", L"glieli", L"glielo",
+            L"gliene", L"sene", L"mela", L"mele", L"meli", L"melo", L"mene", L"tela", L"tele", L"teli",
+            L"telo", L"tene", L"cela", L"celi", L"celo", L"cene", L"vela", L"vele", L"veli", L"velo",
+            L"vene", L"gli", L"ci", L"la", L"le", L"li", L"lo", L"mi", L"ne", L"si", L"ti", L"vi" };
+        static constexpr suffix_trie<10> PRONOUN_VERB_ENDINGS{ L"ando", L"endo", L"ar", L"er", L"ir" };
+        static constexpr size_t GERUND_COUNT{ 2 };
+
+        // the characters that the suffixes of each step can end with
+        static constexpr character_bitmap STEP_0_ENDINGS{ ATTACHED_PRONOUNS.get_last_characters() };
+        static constexpr character_bitmap STEP_1_ENDINGS{ L"aceilostvàèì" };
+        static constexpr character_bitmap STEP_2_ENDINGS{ L"aeioràò" };
+        static constexpr character_bitmap STEP_3A_ENDINGS{ ITALIAN_VOWELS_SIMPLE };
+        static constexpr character_bitmap STEP_3B_ENDINGS{ L"h" };
+        static constexpr character_bitmap ALL_STEP_ENDINGS{ STEP_0_ENDINGS | STEP_1_ENDINGS |
+            STEP_2_ENDINGS | STEP_3A_ENDINGS | STEP_3B_ENDINGS };
         };
     }
 
@@ -20,8 +20,8 @@ namespace stemming
         @brief Norwegian stemmer.
     */
     //------------------------------------------------------
-    template <typename string_typeT = std::wstring>
-    class norwegian_stem final : public stem<string_typeT>
+    template <typename string_typeT = std::wstring, typename policyT = default_stem_policy>
+    class norwegian_stem final : public stem<string_typeT, policyT>
         {
     public:
         /** @brief Stems a Norwegian word.
@@ -29,25 +29,30 @@ namespace stemming
         void operator()(string_typeT& text) final
             {
             // reset internal data
-            stem<string_typeT>::reset_r_values();
+            stem<string_typeT, policyT>::reset_r_values();
 
-            std::transform(text.begin(), text.end(), text.begin(), full_width_to_narrow);
-            stem<string_typeT>::remove_possessive_suffix(text);
+            stem<string_typeT, policyT>::normalize_input(text);
+            stem<string_typeT, policyT>::remove_possessive_suffix(text);
 
             if (text.length() < 3)
                 { return; }
+            // a word (or number) that doesn't end with a letter from any of the suffixes is left as-is
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, ALL_STEP_ENDINGS))
+                { return; }
 
-            stem<string_typeT>::find_r1(text, NORWEGIAN_VOWELS);
-            if (stem<string_typeT>::get_r1() == text.length() )
+            stem<string_typeT, policyT>::find_r1(text, NORWEGIAN_VOWELS);
+            if (stem<string_typeT, policyT>::get_r1() == text.length() )
                 { return; }
             // R1 must have at least 3 characters in front of it
-            if (stem<string_typeT>::get_r1() < 3)
-                { stem<string_typeT>::set_r1(3); }
+            if (stem<string_typeT, policyT>::get_r1() < 3)
+                { stem<string_typeT, policyT>::set_r1(3); }
             // Norwegian does not use R2
 
             step_1(text);
             step_2(text);
-            step_3(text);
+            // step 3 removes derivational suffixes
+            if constexpr (!policyT::light_stemming)
+                { step_3(text); }
             }
 
         /// @returns The stemmer's language.
@@ -58,252 +63,158 @@ namespace stemming
         //---------------------------------------------
         void step_1(string_typeT& text)
             {
-            if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*hetenes*/
-                common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*hetene*/
-                common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*hetens*/
-                common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*heter*/
-                common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*heten*/
-                common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*endes*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ande*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ende*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*edes*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "norwegian::step_1");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_1_ENDINGS))
+                { return; }
+            const auto suffix =
+                stem<string_typeT, policyT>::delete_longest_suffix_in_r1(text, STEP_1_SUFFIXES,
+                                                                         STEP_1_DELETED_SUFFIX_COUNT);
+            if (suffix.m_length == 0 || suffix.m_index < STEP_1_DELETED_SUFFIX_COUNT)
+                { return; }
+            // erte and ert are replaced with er
+            if (suffix.m_index == STEP_1_DELETED_SUFFIX_COUNT)
                 {
-                return;
+                text.erase(text.length()-2);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*enes*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
+            else if (suffix.m_index == STEP_1_DELETED_SUFFIX_COUNT + 1)
                 {
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
-                /*erte*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
-                {
-                text.erase(text.length()-2);
-                stem<string_typeT>::update_r_sections(text);
-                return;
+                text.erase(text.length()-1);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
-                /*ers*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S))
+            // ers is deleted, unless it follows one of the exceptions
+            else if (suffix.m_index == STEP_1_DELETED_SUFFIX_COUNT + 2)
                 {
                 if (text.length() >= 7 &&
-                    stem<string_typeT>::is_either(text[text.length() - 7],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 7],
                         common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) &&
-                    stem<string_typeT>::is_either(text[text.length() - 6],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 6],
                         common_lang_constants::LOWER_K, common_lang_constants::UPPER_K) &&
-                    stem<string_typeT>::is_either(text[text.length() - 5],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 5],
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(text[text.length() - 4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                         common_lang_constants::LOWER_P, common_lang_constants::UPPER_P))
                     {
                     text.erase(text.length() - 3);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 else if (text.length() >= 6 &&
-                    stem<string_typeT>::is_either(text[text.length() - 6],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 6],
                         common_lang_constants::LOWER_G, common_lang_constants::UPPER_G) &&
-                    stem<string_typeT>::is_either(text[text.length() - 5],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 5],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(text[text.length() - 4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                         common_lang_constants::LOWER_V, common_lang_constants::UPPER_V))
                     {
                     text.erase(text.length() - 3);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 else if (text.length() >= 6 &&
-                    stem<string_typeT>::is_either(text[text.length() - 6],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 6],
                         common_lang_constants::LOWER_H, common_lang_constants::UPPER_H) &&
-                    stem<string_typeT>::is_either(text[text.length() - 5],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 5],
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(text[text.length() - 4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                         common_lang_constants::LOWER_V, common_lang_constants::UPPER_V))
                     {
                     text.erase(text.length() - 3);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 else if (text.length() >= 6 &&
-                    stem<string_typeT>::is_either(text[text.length() - 6],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 6],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(text[text.length() - 5],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 5],
                         common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                    stem<string_typeT>::is_either(text[text.length() - 4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                         common_lang_constants::LOWER_D, common_lang_constants::UPPER_D))
                     {
                     return;
                     }
                 else if (text.length() >= 6 &&
-                    stem<string_typeT>::is_either(text[text.length() - 6],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 6],
                         common_lang_constants::LOWER_K, common_lang_constants::UPPER_K) &&
-                    stem<string_typeT>::is_either(text[text.length() - 5],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 5],
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(text[text.length() - 4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                         common_lang_constants::LOWER_P, common_lang_constants::UPPER_P))
                     {
                     return;
                     }
                 else if (text.length() >= 6 &&
-                    stem<string_typeT>::is_either(text[text.length() - 6],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 6],
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(text[text.length() - 5],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 5],
                         common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) &&
-                    stem<string_typeT>::is_either(text[text.length() - 4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))
                     {
                     return;
                     }
                 else if (text.length() >= 6 &&
-                    stem<string_typeT>::is_either(text[text.length() - 6],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 6],
                         common_lang_constants::LOWER_O_STROKE, common_lang_constants::UPPER_O_STROKE) &&
-                    stem<string_typeT>::is_either(text[text.length() - 5],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 5],
                         common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) &&
-                    stem<string_typeT>::is_either(text[text.length() - 4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))
                     {
                     return;
                     }
                 else if (text.length() >= 6 &&
-                    stem<string_typeT>::is_either(text[text.length() - 6],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 6],
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(text[text.length() - 5],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 5],
                         common_lang_constants::LOWER_M, common_lang_constants::UPPER_M) &&
-                    stem<string_typeT>::is_either(text[text.length() - 4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                         common_lang_constants::LOWER_M, common_lang_constants::UPPER_M))
                     {
                     return;
                     }
                 else if (text.length() >= 6 &&
-                    stem<string_typeT>::is_either(text[text.length() - 6],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 6],
                         common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) &&
-                    stem<string_typeT>::is_either(text[text.length() - 5],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 5],
                         common_lang_constants::LOWER_M, common_lang_constants::UPPER_M) &&
-                    stem<string_typeT>::is_either(text[text.length() - 4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                         common_lang_constants::LOWER_M, common_lang_constants::UPPER_M))
                     {
                     return;
                     }
                 else if (text.length() >= 5 &&
-                    stem<string_typeT>::is_either(text[text.length() - 5],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 5],
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) &&
-                    stem<string_typeT>::is_either(text[text.length() - 4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))
                     {
                     return;
                     }
                 else if (text.length() >= 5 &&
-                    stem<string_typeT>::is_either(text[text.length() - 5],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 5],
                         common_lang_constants::LOWER_K, common_lang_constants::UPPER_K) &&
-                    stem<string_typeT>::is_either(text[text.length() - 4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                         common_lang_constants::LOWER_K, common_lang_constants::UPPER_K))
                     {
                     return;
                     }
                 else if (text.length() >= 5 &&
-                    stem<string_typeT>::is_either(text[text.length() - 5],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 5],
                     common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                    stem<string_typeT>::is_either(text[text.length() - 4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                     common_lang_constants::LOWER_K, common_lang_constants::UPPER_K))
                     {
                     return;
                     }
                 else if (text.length() >= 5 &&
-                    stem<string_typeT>::is_either(text[text.length() - 5],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 5],
                         common_lang_constants::LOWER_P, common_lang_constants::UPPER_P) &&
-                    stem<string_typeT>::is_either(text[text.length() - 4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                         common_lang_constants::LOWER_P, common_lang_constants::UPPER_P))
                     {
                     return;
                     }
                 else if (text.length() >= 4 &&
-                    stem<string_typeT>::is_either(text[text.length() - 4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                         common_lang_constants::LOWER_V, common_lang_constants::UPPER_V))
                     {
                     return;
@@ -311,161 +222,38 @@ namespace stemming
                 else
                     {
                     text.erase(text.length() - 3);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ets*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*het*/
-                common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ast*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ens*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ene*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ane*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ede*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
-                /*ert*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
-                {
-                text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*et*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*es*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*as*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ar*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) )
+            // s is only deleted if it follows a valid s-ending
+            else
                 {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*er*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*en*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
-                {
-                if (stem<string_typeT>::get_r1() <= text.length()-1)
+                if (text.length() >= 2 &&
+                    stem<string_typeT, policyT>::is_one_of(text[text.length()-2],
+                    L"bcdfghjlmnoptvyzBCDFGHJLMNOPTVYZ") )
                     {
-                    // only delete if a valid "s" ending
-                    if (text.length() >= 2 &&
-                        stem<string_typeT>::is_one_of(text[text.length()-2],
-                        L"bcdfghjlmnoptvyzBCDFGHJLMNOPTVYZ") )
-                        {
-                        text.erase(text.length()-1);
-                        stem<string_typeT>::update_r_sections(text);
-                        return;
-                        }
-                    else if (text.length() >= 3 &&
-                        stem<string_typeT>::is_either(text[text.length()-2],
-                            common_lang_constants::LOWER_K, common_lang_constants::UPPER_K) &&
-                        !stem<string_typeT>::is_one_of(text[text.length()-3], NORWEGIAN_VOWELS))
-                        {
-                        text.erase(text.length()-1);
-                        stem<string_typeT>::update_r_sections(text);
-                        return;
-                        }
-                    else if (text.length() >= 3 &&
-                        stem<string_typeT>::is_either(text[text.length()-2],
-                            common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) &&
-                        stem<string_typeT>::is_neither(text[text.length() - 3],
-                            common_lang_constants::LOWER_E, common_lang_constants::UPPER_E))
-                        {
-                        text.erase(text.length()-1);
-                        stem<string_typeT>::update_r_sections(text);
-                        return;
-                        }
+                    text.erase(text.length()-1);
+                    stem<string_typeT, policyT>::update_r_sections(text);
+                    return;
+                    }
+                else if (text.length() >= 3 &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2],
+                        common_lang_constants::LOWER_K, common_lang_constants::UPPER_K) &&
+                    !stem<string_typeT, policyT>::is_one_of(text[text.length()-3], NORWEGIAN_VOWELS))
+                    {
+                    text.erase(text.length()-1);
+                    stem<string_typeT, policyT>::update_r_sections(text);
+                    return;
+                    }
+                else if (text.length() >= 3 &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2],
+                        common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) &&
+                    stem<string_typeT, policyT>::is_neither(text[text.length() - 3],
+                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E))
+                    {
+                    text.erase(text.length()-1);
+                    stem<string_typeT, policyT>::update_r_sections(text);
+                    return;
                     }
                 }
             }
@@ -473,29 +261,37 @@ namespace stemming
         //---------------------------------------------
         void step_2(string_typeT& text)
             {
-            if (stem<string_typeT>::is_suffix_in_r1(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "norwegian::step_2");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_2_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /*dt*/
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /*vt*/
                 common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
             }
         //---------------------------------------------
         void step_3(string_typeT& text)
             {
-            if (stem<string_typeT>::delete_if_is_in_r1(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "norwegian::step_3");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_3_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*hetslov*/
                 common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -507,7 +303,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*slov*/
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
@@ -516,7 +312,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*elov*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
@@ -525,7 +321,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*elig*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
@@ -534,7 +330,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*eleg*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
@@ -543,7 +339,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*lov*/
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
@@ -551,7 +347,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*els*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
@@ -559,7 +355,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*lig*/
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
@@ -567,7 +363,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*eig*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
@@ -575,7 +371,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*leg*/
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -583,7 +379,7 @@ namespace stemming
                 {
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*ig*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_G, common_lang_constants::UPPER_G, false) )
@@ -591,6 +387,22 @@ namespace stemming
                 return;
                 }
             }
+
+        // step 1's suffixes: the ones that are simply deleted, followed by
+        // the ones that are replaced or need a check of their own
+        static constexpr suffix_trie<56> STEP_1_SUFFIXES{
+            L"hetenes", L"hetene", L"hetens", L"heter", L"heten", L"endes", L"ande", L"ende",
+            L"edes", L"enes", L"ets", L"het", L"ast", L"ens", L"ene", L"ane", L"ede", L"et",
+            L"es", L"as", L"ar", L"er", L"en", L"a", L"e",
+            L"erte", L"ert", L"ers", L"s" };
+        static constexpr size_t STEP_1_DELETED_SUFFIX_COUNT{ 25 };
+
+        // the characters that the suffixes of each step can end with
+        static constexpr character_bitmap STEP_1_ENDINGS{ STEP_1_SUFFIXES.get_last_characters() };
+        static constexpr character_bitmap STEP_2_ENDINGS{ L"t" };
+        static constexpr character_bitmap STEP_3_ENDINGS{ L"gsv" };
+        static constexpr character_bitmap ALL_STEP_ENDINGS{
+            STEP_1_ENDINGS | STEP_2_ENDINGS | STEP_3_ENDINGS };
         };
     }
 
@@ -20,8 +20,8 @@ namespace stemming
         @brief Portuguese stemmer.
     */
     //------------------------------------------------------
-    template <typename string_typeT = std::wstring>
-    class portuguese_stem final : public stem<string_typeT>
+    template <typename string_typeT = std::wstring, typename policyT = default_stem_policy>
+    class portuguese_stem final : public stem<string_typeT, policyT>
         {
     public:
         /** @brief Stems a Portuguese word.
@@ -31,26 +31,17 @@ namespace stemming
             // reset internal data
             m_altered_suffix_index = 0;
             m_step1_step2_altered = false;
-            stem<string_typeT>::reset_r_values();
+            stem<string_typeT, policyT>::reset_r_values();
 
-            std::transform(text.begin(), text.end(), text.begin(), full_width_to_narrow);
-            stem<string_typeT>::remove_possessive_suffix(text);
+            stem<string_typeT, policyT>::normalize_input(text);
+            stem<string_typeT, policyT>::remove_possessive_suffix(text);
 
             if (text.length() < 3)
                 { return; }
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, ALL_STEP_ENDINGS))
+                { return; }
 
-            stem<string_typeT>::replace_all(text, string_typeT(1,
-                common_lang_constants::LOWER_A_TILDE), L"a~");
-            stem<string_typeT>::replace_all(text, string_typeT(1,
-                common_lang_constants::UPPER_A_TILDE), L"A~");
-            stem<string_typeT>::replace_all(text, string_typeT(1,
-                common_lang_constants::LOWER_O_TILDE), L"o~");
-            stem<string_typeT>::replace_all(text, string_typeT(1,
-                common_lang_constants::UPPER_O_TILDE), L"O~");
-
-            stem<string_typeT>::find_r1(text, PORTUGUESE_VOWELS);
-            stem<string_typeT>::find_r2(text, PORTUGUESE_VOWELS);
-            stem<string_typeT>::find_spanish_rv(text, PORTUGUESE_VOWELS);
+            find_regions(text);
 
             step_1(text);
             // intermediate steps handled by step 1
@@ -59,27 +50,105 @@ namespace stemming
                 step_4(text);
                 }
             step_5(text);
-
-            // turn a~, o~ back into ã, õ
-            stem<string_typeT>::replace_all(text, L"a~", string_typeT(1,
-                common_lang_constants::LOWER_A_TILDE));
-            stem<string_typeT>::replace_all(text, L"A~", string_typeT(1,
-                common_lang_constants::UPPER_A_TILDE));
-            stem<string_typeT>::replace_all(text, L"o~", string_typeT(1,
-                common_lang_constants::LOWER_O_TILDE));
-            stem<string_typeT>::replace_all(text, L"O~", string_typeT(1,
-                common_lang_constants::UPPER_O_TILDE));
             }
         /// @returns The stemmer's language.
         [[nodiscard]]
         stemming_type get_language() const noexcept final
             { return stemming_type::portuguese; }
     private:
+        /** @brief Finds R1, R2, and RV.
+            @details The algorithm treats ã and õ as a vowel followed by a consonant
+                (i.e., a~ and o~), so they are read as two letters here. Rather than
+                expanding them in the string, each region starts after the letter
+                (counting ã and õ as one) that ends it, which is where it would start
+                in the expanded string. The suffixes are then compared against ã and õ
+                directly.
+            @param text The word to review.*/
+        void find_regions(const string_typeT& text)
+            {
+            size_t r1{ string_typeT::npos };
+            size_t r2{ string_typeT::npos };
+            size_t rv{ string_typeT::npos };
+            bool r1_vowel_found{ false };
+            bool r2_vowel_found{ false };
+            // RV depends on whether the first two letters are vowels
+            bool first_is_vowel{ false };
+            bool second_is_vowel{ false };
+            size_t letter_count{ 0 };
+            // advances R1, R2, and RV past a letter of the character at position
+            const auto scan_letter = [&](const bool is_vowel, const size_t position) noexcept
+                {
+                if (r1 == string_typeT::npos)
+                    {
+                    if (is_vowel)
+                        { r1_vowel_found = true; }
+                    else if (r1_vowel_found)
+                        { r1 = position + 1; }
+                    }
+                else if (r2 == string_typeT::npos)
+                    {
+                    if (is_vowel)
+                        { r2_vowel_found = true; }
+                    else if (r2_vowel_found)
+                        { r2 = position + 1; }
+                    }
+
+                if (letter_count == 0)
+                    { first_is_vowel = is_vowel; }
+                else if (letter_count == 1)
+                    { second_is_vowel = is_vowel; }
+                // after the next vowel if the second letter is a consonant,
+                // after the next consonant if the first two letters are vowels,
+                // otherwise after the third letter
+                else if (rv == string_typeT::npos &&
+                         ((!second_is_vowel && is_vowel) ||
+                          (first_is_vowel && second_is_vowel && !is_vowel) ||
+                          (!first_is_vowel && second_is_vowel)))
+                    { rv = position + 1; }
+                ++letter_count;
+                };
+
+            for (size_t i = 0; i < text.length(); ++i)
+                {
+                if (is_nasal_vowel(text[i]))
+                    {
+                    scan_letter(true, i);
+                    scan_letter(false, i);
+                    }
+                else
+                    { scan_letter(stem<string_typeT, policyT>::is_one_of(text[i], PORTUGUESE_VOWELS), i); }
+                }
+
+            stem<string_typeT, policyT>::set_r1((r1 == string_typeT::npos) ? text.length() : r1);
+            stem<string_typeT, policyT>::set_r2((r2 == string_typeT::npos) ? text.length() : r2);
+            // words shorter than four letters have no RV
+            stem<string_typeT, policyT>::set_rv((rv == string_typeT::npos || letter_count < 4) ?
+                text.length() : rv);
+            }
+
+        /// @returns @c true if @c ch is ã or õ (in either case).
+        [[nodiscard]]
+        static constexpr bool is_nasal_vowel(const wchar_t ch) noexcept
+            {
+            return (ch == common_lang_constants::LOWER_A_TILDE ||
+                    ch == common_lang_constants::UPPER_A_TILDE ||
+                    ch == common_lang_constants::LOWER_O_TILDE ||
+                    ch == common_lang_constants::UPPER_O_TILDE);
+            }
+
         //---------------------------------------------
         void step_1(string_typeT& text)
             {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "portuguese::step_1");
+            // nothing to remove here, so go straight to step 2
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_1_ENDINGS))
+                {
+                step_2(text);
+                return;
+                }
             const size_t original_length = text.length();
-            if (stem<string_typeT>::delete_if_is_in_r2(text,
+            if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*amentos*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -91,7 +160,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*imentos*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -103,21 +172,20 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::is_suffix_in_r2(text,
-                /*uço~es*/
+            else if (stem<string_typeT, policyT>::is_suffix_in_r2(text,
+                /*uções*/
                 common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                 common_lang_constants::LOWER_C_CEDILLA, common_lang_constants::UPPER_C_CEDILLA,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::TILDE, common_lang_constants::TILDE,
+                common_lang_constants::LOWER_O_TILDE, common_lang_constants::UPPER_O_TILDE,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
-                text.erase(text.length()-5);
+                text.erase(text.length()-4);
                 m_altered_suffix_index = text.length()-1;
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*amento*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -128,7 +196,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*imento*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -139,7 +207,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*adoras*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
@@ -150,7 +218,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*adores*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
@@ -161,18 +229,17 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
-                /*aço~es*/
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
+                /*ações*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_C_CEDILLA, common_lang_constants::UPPER_C_CEDILLA,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::TILDE, common_lang_constants::TILDE,
+                common_lang_constants::LOWER_O_TILDE, common_lang_constants::UPPER_O_TILDE,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::is_suffix_in_r2(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r2(text,
                 /*ências*/
                 common_lang_constants::LOWER_E_CIRCUMFLEX, common_lang_constants::UPPER_E_CIRCUMFLEX,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -183,10 +250,10 @@ namespace stemming
                 {
                 text.replace(text.end()-6, text.end(), L"ente");
                 m_altered_suffix_index = text.length()-4;
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::is_suffix_in_r2(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r2(text,
                 /*logias*/
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
@@ -197,10 +264,10 @@ namespace stemming
                 {
                 text.erase(text.length()-3);
                 m_altered_suffix_index = text.length()-3;
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*amente*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -209,27 +276,27 @@ namespace stemming
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                 {
-                if (stem<string_typeT>::delete_if_is_in_r2(text,
+                if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*iv*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V, false) )
                     {
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*at*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T, false);
                     }
                 else
                     {
-                    if (stem<string_typeT>::delete_if_is_in_r2(text,
+                    if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                             /*os*/
                             common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                             common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) ||
-                        stem<string_typeT>::delete_if_is_in_r2(text,
+                        stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                             /*ic*/
                             common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                             common_lang_constants::LOWER_C, common_lang_constants::UPPER_C) ||
-                        stem<string_typeT>::delete_if_is_in_r2(text,
+                        stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                             /*ad*/
                             common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                             common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) )
@@ -239,7 +306,7 @@ namespace stemming
                     }
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*idades*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
@@ -248,17 +315,17 @@ namespace stemming
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
-                if (stem<string_typeT>::delete_if_is_in_r2(text,
+                if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*abil*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) ||
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ic*/
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_C, common_lang_constants::UPPER_C) ||
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*iv*/
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_V, common_lang_constants::UPPER_V) )
@@ -267,7 +334,7 @@ namespace stemming
                     }
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::is_suffix_in_r2(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r2(text,
                 /*logia*/
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
@@ -277,23 +344,22 @@ namespace stemming
                 {
                 text.erase(text.length()-2);
                 m_altered_suffix_index = text.length()-3;
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::is_suffix_in_r2(text,
-                /*uça~o*/
+            else if (stem<string_typeT, policyT>::is_suffix_in_r2(text,
+                /*ução*/
                 common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                 common_lang_constants::LOWER_C_CEDILLA, common_lang_constants::UPPER_C_CEDILLA,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::TILDE, common_lang_constants::TILDE,
+                common_lang_constants::LOWER_A_TILDE, common_lang_constants::UPPER_A_TILDE,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) )
                 {
-                text.erase(text.length()-4);
+                text.erase(text.length()-3);
                 m_altered_suffix_index = text.length()-1;
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::is_suffix_in_r2(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r2(text,
                 /*ência*/
                 common_lang_constants::LOWER_E_CIRCUMFLEX, common_lang_constants::UPPER_E_CIRCUMFLEX,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -303,10 +369,10 @@ namespace stemming
                 {
                 text.replace(text.end()-5, text.end(), L"ente");
                 m_altered_suffix_index = text.length()-4;
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*mente*/
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -314,19 +380,19 @@ namespace stemming
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                 {
-                if (stem<string_typeT>::delete_if_is_in_r2(text,
+                if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ante*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*avel*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) ||
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ível*/
                         common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
                         common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -337,7 +403,7 @@ namespace stemming
                     }
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*idade*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
@@ -345,17 +411,17 @@ namespace stemming
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) )
                 {
-                if (stem<string_typeT>::delete_if_is_in_r2(text,
+                if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*abil*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) ||
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ic*/
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_C, common_lang_constants::UPPER_C) ||
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*iv*/
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_V, common_lang_constants::UPPER_V) )
@@ -364,7 +430,7 @@ namespace stemming
                     }
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*eiras*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
@@ -372,15 +438,15 @@ namespace stemming
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
-                if (stem<string_typeT>::get_rv() <= text.length()-4)
+                if (stem<string_typeT, policyT>::get_rv() <= text.length()-4)
                     {
                     text.erase(text.length()-2);
                     m_altered_suffix_index = text.length()-3;
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*antes*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -390,7 +456,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ância*/
                 common_lang_constants::LOWER_A_CIRCUMFLEX, common_lang_constants::UPPER_A_CIRCUMFLEX,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -400,7 +466,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ismos*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -410,7 +476,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*istas*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -420,7 +486,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*adora*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
@@ -430,17 +496,16 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
-                /*aça~o*/
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
+                /*ação*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_C_CEDILLA, common_lang_constants::UPPER_C_CEDILLA,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::TILDE, common_lang_constants::TILDE,
+                common_lang_constants::LOWER_A_TILDE, common_lang_constants::UPPER_A_TILDE,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) )
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ante*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -449,7 +514,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ezas*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z,
@@ -458,7 +523,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*icos*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
@@ -467,7 +532,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*icas*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
@@ -476,7 +541,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ismo*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -485,7 +550,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ável*/
                 common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
                 common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -494,7 +559,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ível*/
                 common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
                 common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -503,7 +568,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ista*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -512,7 +577,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*osos*/
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -521,7 +586,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*osas*/
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -530,7 +595,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ador*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
@@ -539,14 +604,14 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ivas*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
-                if (stem<string_typeT>::delete_if_is_in_r2(text,
+                if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*at*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
@@ -555,14 +620,14 @@ namespace stemming
                     }
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ivos*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
-                if (stem<string_typeT>::delete_if_is_in_r2(text,
+                if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*at*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
@@ -571,28 +636,28 @@ namespace stemming
                     }
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::is_suffix(text,
+            else if (stem<string_typeT, policyT>::is_suffix(text,
                 /*eira*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) )
                 {
-                if (stem<string_typeT>::get_rv() <= text.length()-3)
+                if (stem<string_typeT, policyT>::get_rv() <= text.length()-3)
                     {
                     text.erase(text.length()-1);
                     m_altered_suffix_index = text.length()-3;
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*iva*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) )
                 {
-                if (stem<string_typeT>::delete_if_is_in_r2(text,
+                if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*at*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
@@ -601,13 +666,13 @@ namespace stemming
                     }
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*ivo*/
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                     common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) )
                 {
-                if (stem<string_typeT>::delete_if_is_in_r2(text,
+                if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                     /*at*/
                     common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                     common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
@@ -616,7 +681,7 @@ namespace stemming
                     }
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*eza*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_Z, common_lang_constants::UPPER_Z,
@@ -624,7 +689,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ico*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
@@ -632,7 +697,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ica*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
@@ -640,7 +705,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*oso*/
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -648,7 +713,7 @@ namespace stemming
                 {
                 // NOOP (fall through to branching statement)
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*osa*/
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -670,1258 +735,211 @@ namespace stemming
         //---------------------------------------------
         void step_2(string_typeT& text)
             {
-            const size_t original_length = text.length();
-            if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*aríamos*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*eríamos*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*iríamos*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "portuguese::step_2");
+            // light stemming only removes the plural endings, not the verb suffixes
+            if constexpr (policyT::light_stemming)
                 {
-                // NOOP (fall through to branching statement)
+                if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
+                    /*as*/
+                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
+                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) ||
+                    stem<string_typeT, policyT>::delete_if_is_in_rv(text,
+                    /*es*/
+                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
+                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
+                    {
+                    m_step1_step2_altered = true;
+                    step_3(text);
+                    }
+                return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ássemos*/
-                common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_2_ENDINGS))
+                { return; }
+            // the longest verb suffix in RV is deleted
+            const auto suffix = STEP_2_SUFFIXES.template match_suffix<
+                stem<string_typeT, policyT>::is_lowercased_text()>(text, text.length(),
+                    stem<string_typeT, policyT>::get_rv());
+            if (suffix.m_length != 0)
+                {
+                text.erase(text.length() - suffix.m_length);
+                stem<string_typeT, policyT>::update_r_sections(text);
+                m_step1_step2_altered = true;
+                step_3(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*êssemos*/
-                common_lang_constants::LOWER_E_CIRCUMFLEX, common_lang_constants::UPPER_E_CIRCUMFLEX,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
+            }
+        //---------------------------------------------
+        void step_3(string_typeT& text)
+            {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "portuguese::step_3");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_3_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::is_suffix(text,
+                /*ci*/
+                common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
+                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
+                stem<string_typeT, policyT>::get_rv() <= text.length()-1)
                 {
-                // NOOP (fall through to branching statement)
+                text.erase(text.length()-1);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*íssemos*/
-                common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
+            }
+        //---------------------------------------------
+        void step_4(string_typeT& text)
+            {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "portuguese::step_4");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_4_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
+                /*os*/
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*aríeis*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*eríeis*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*iríeis*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
+                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
-                // NOOP (fall through to branching statement)
+                return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ásseis*/
-                common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
+                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) )
                 {
-                // NOOP (fall through to branching statement)
+                return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ésseis*/
-                common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
+                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
                 {
-                // NOOP (fall through to branching statement)
+                return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ísseis*/
-                common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
+                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) )
                 {
-                // NOOP (fall through to branching statement)
+                return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*áramos*/
-                common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
+                common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE) )
                 {
-                // NOOP (fall through to branching statement)
+                return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*éramos*/
-                common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
+                common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE) )
                 {
-                // NOOP (fall through to branching statement)
+                return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*íramos*/
-                common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
+                common_lang_constants::LOWER_O_ACUTE, common_lang_constants::UPPER_O_ACUTE) )
                 {
-                // NOOP (fall through to branching statement)
+                return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ávamos*/
-                common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
-                common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
+            }
+        //---------------------------------------------
+        void step_5(string_typeT& text)
+            {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "portuguese::step_5");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_5_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
+                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
                 {
-                // NOOP (fall through to branching statement)
+                if (text.length() >= 1 &&
+                    stem<string_typeT, policyT>::get_rv() <= text.length()-1 &&
+                    (stem<string_typeT, policyT>::is_suffix(text,
+                        /*gu*/
+                        common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
+                        common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) ||
+                    stem<string_typeT, policyT>::is_suffix(text,
+                        /*ci*/
+                        common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
+                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I)) )
+                    {
+                    text.erase(text.length()-1);
+                    stem<string_typeT, policyT>::update_r_sections(text);
+                    }
+                return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*aremos*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
+                /*é*/
+                common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE, false) )
                 {
-                // NOOP (fall through to branching statement)
+                if (text.length() >= 1 &&
+                    stem<string_typeT, policyT>::get_rv() <= text.length()-1 &&
+                    (stem<string_typeT, policyT>::is_suffix(text,
+                        /*gu*/
+                        common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
+                        common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) ||
+                    stem<string_typeT, policyT>::is_suffix(text,
+                        /*ci*/
+                        common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
+                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I)) )
+                    {
+                    text.erase(text.length()-1);
+                    stem<string_typeT, policyT>::update_r_sections(text);
+                    }
+                return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*eremos*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
+                /*ê*/
+                common_lang_constants::LOWER_E_CIRCUMFLEX,
+                common_lang_constants::UPPER_E_CIRCUMFLEX, false) )
                 {
-                // NOOP (fall through to branching statement)
+                if (text.length() >= 1 &&
+                    stem<string_typeT, policyT>::get_rv() <= text.length()-1 &&
+                    (stem<string_typeT, policyT>::is_suffix(text,
+                        /*gu*/
+                        common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
+                        common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) ||
+                    stem<string_typeT, policyT>::is_suffix(text,
+                        /*ci*/
+                        common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
+                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I)) )
+                    {
+                    text.erase(text.length()-1);
+                    stem<string_typeT, policyT>::update_r_sections(text);
+                    }
+                return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*iremos*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
+            else if (text.length() >= 1 &&
+                text[text.length()-1] == common_lang_constants::UPPER_C_CEDILLA)
                 {
-                // NOOP (fall through to branching statement)
+                text[text.length()-1] = common_lang_constants::UPPER_C;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ariam*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M, false) )
+            else if (text.length() >= 1 &&
+                text[text.length()-1] == common_lang_constants::LOWER_C_CEDILLA)
                 {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*eriam*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*iriam*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*assem*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*essem*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*issem*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ara~o*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::TILDE, common_lang_constants::TILDE,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*era~o*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::TILDE, common_lang_constants::TILDE,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ira~o*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::TILDE, common_lang_constants::TILDE,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*arias*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*erias*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*irias*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ardes*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*erdes*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*irdes*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*asses*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*esses*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*isses*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*astes*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*estes*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*istes*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*áreis*/
-                common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*areis*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*éreis*/
-                common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ereis*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*íreis*/
-                common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ireis*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*áveis*/
-                common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
-                common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*íamos*/
-                common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*armos*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ermos*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*irmos*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*aria*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*eria*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*iria*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*asse*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*esse*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*isse*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*aste*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*este*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*iste*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*arei*/
-                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*erei*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*irei*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*aram*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*eram*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*iram*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*avam*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*arem*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*erem*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*irem*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ando*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*endo*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*indo*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*adas*/
-                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*idas*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*arás*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*aras*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*erás*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*eras*/
-                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*irás*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*avas*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ares*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*eres*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ires*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*íeis*/
-                common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ados*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*idos*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ámos*/
-                common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*amos*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*emos*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*imos*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*iras*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ada*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ida*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ará*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ara*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*erá*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*era*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*irá*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ava*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*iam*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ado*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ido*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ias*/common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ais*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*eis*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ira*/common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ia*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ei*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*am*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*em*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ar*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*er*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ir*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*as*/
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*es*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*is*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*eu*/
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_U, common_lang_constants::UPPER_U, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*iu*/
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
-                common_lang_constants::LOWER_U, common_lang_constants::UPPER_U, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ou*/
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_U, common_lang_constants::UPPER_U, false) )
-                {
-                // NOOP (fall through to branching statement)
-                }
-
-            if (original_length != text.length() )
-                {
-                m_step1_step2_altered = true;
-                step_3(text);
-                }
-            }
-        //---------------------------------------------
-        void step_3(string_typeT& text)
-            {
-            if (stem<string_typeT>::is_suffix(text,
-                /*ci*/
-                common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                stem<string_typeT>::get_rv() <= text.length()-1)
-                {
-                text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
-                }
-            }
-        //---------------------------------------------
-        void step_4(string_typeT& text)
-            {
-            if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*os*/
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE) )
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                common_lang_constants::LOWER_O_ACUTE, common_lang_constants::UPPER_O_ACUTE) )
-                {
-                return;
-                }
-            }
-        //---------------------------------------------
-        void step_5(string_typeT& text)
-            {
-            if (stem<string_typeT>::delete_if_is_in_rv(text,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                {
-                if (text.length() >= 1 &&
-                    stem<string_typeT>::get_rv() <= text.length()-1 &&
-                    (stem<string_typeT>::is_suffix(text,
-                        /*gu*/
-                        common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
-                        common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) ||
-                    stem<string_typeT>::is_suffix(text,
-                        /*ci*/
-                        common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I)) )
-                    {
-                    text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
-                    }
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*é*/
-                common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE, false) )
-                {
-                if (text.length() >= 1 &&
-                    stem<string_typeT>::get_rv() <= text.length()-1 &&
-                    (stem<string_typeT>::is_suffix(text,
-                        /*gu*/
-                        common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
-                        common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) ||
-                    stem<string_typeT>::is_suffix(text,
-                        /*ci*/
-                        common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I)) )
-                    {
-                    text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
-                    }
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
-                /*ê*/
-                common_lang_constants::LOWER_E_CIRCUMFLEX,
-                common_lang_constants::UPPER_E_CIRCUMFLEX, false) )
-                {
-                if (text.length() >= 1 &&
-                    stem<string_typeT>::get_rv() <= text.length()-1 &&
-                    (stem<string_typeT>::is_suffix(text,
-                        /*gu*/
-                        common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
-                        common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) ||
-                    stem<string_typeT>::is_suffix(text,
-                        /*ci*/
-                        common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
-                        common_lang_constants::LOWER_I, common_lang_constants::UPPER_I)) )
-                    {
-                    text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
-                    }
-                return;
-                }
-            else if (text.length() >= 1 &&
-                text[text.length()-1] == common_lang_constants::UPPER_C_CEDILLA)
-                {
-                text[text.length()-1] = common_lang_constants::UPPER_C;
-                }
-            else if (text.length() >= 1 &&
-                text[text.length()-1] == common_lang_constants::LOWER_C_CEDILLA)
-                {
-                text[text.length()-1] = common_lang_constants::LOWER_C;
+                text[text.length()-1] = common_lang_constants::LOWER_C;
                 }
             }
         // internal data specific to Portuguese stemmer
         bool m_step1_step2_altered{ false };
         size_t m_altered_suffix_index{ 0 };
+
+        // the verb suffixes removed by step 2 (if in RV)
+        static constexpr suffix_trie<178> STEP_2_SUFFIXES{
+            L"aríamos", L"eríamos", L"iríamos", L"ássemos", L"êssemos", L"íssemos",
+            L"aríeis", L"eríeis", L"iríeis", L"ásseis", L"ésseis", L"ísseis",
+            L"áramos", L"éramos", L"íramos", L"ávamos", L"aremos", L"eremos", L"iremos",
+            L"ariam", L"eriam", L"iriam", L"assem", L"essem", L"issem",
+            L"arias", L"erias", L"irias", L"ardes", L"erdes", L"irdes",
+            L"asses", L"esses", L"isses", L"astes", L"estes", L"istes",
+            L"áreis", L"areis", L"éreis", L"ereis", L"íreis", L"ireis", L"áveis", L"íamos",
+            L"armos", L"ermos", L"irmos",
+            L"arão", L"erão", L"irão", L"aria", L"eria", L"iria", L"asse", L"esse", L"isse",
+            L"aste", L"este", L"iste", L"arei", L"erei", L"irei", L"aram", L"eram", L"iram",
+            L"avam", L"arem", L"erem", L"irem", L"ando", L"endo", L"indo", L"adas", L"idas",
+            L"arás", L"aras", L"erás", L"eras", L"irás", L"avas", L"ares", L"eres", L"ires",
+            L"íeis", L"ados", L"idos", L"ámos", L"amos", L"emos", L"imos", L"iras",
+            L"ada", L"ida", L"ará", L"ara", L"erá", L"era", L"irá", L"ava", L"iam",
+            L"ado", L"ido", L"ias", L"ais", L"eis", L"ira",
+            L"ia", L"ei", L"am", L"em", L"ar", L"er", L"ir", L"as", L"es", L"is", L"eu", L"iu", L"ou" };
+
+        // the characters that the suffixes of each step can end with
+        // (step 5 also changes a trailing 'ç' to 'c')
+        static constexpr character_bitmap STEP_1_ENDINGS{ L"acdeilmorstuvá" };
+        static constexpr character_bitmap STEP_2_ENDINGS{ STEP_2_SUFFIXES.get_last_characters() };
+        static constexpr character_bitmap STEP_3_ENDINGS{ L"i" };
+        static constexpr character_bitmap STEP_4_ENDINGS{ L"aiosáíó" };
+        static constexpr character_bitmap STEP_5_ENDINGS{ L"eiuéêç" };
+        static constexpr character_bitmap ALL_STEP_ENDINGS{ STEP_1_ENDINGS | STEP_2_ENDINGS |
+            STEP_3_ENDINGS | STEP_4_ENDINGS | STEP_5_ENDINGS };
         };
     }
 
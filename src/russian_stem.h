@@ -119,8 +119,8 @@ namespace stemming
     /**
         @brief Russian stemmer.
     */
-    template <typename string_typeT = std::wstring>
-    class russian_stem final : public stem<string_typeT>
+    template <typename string_typeT = std::wstring, typename policyT = default_stem_policy>
+    class russian_stem final : public stem<string_typeT, policyT>
         {
     public:
         /** @brief Stems a Russian word.
@@ -128,27 +128,22 @@ namespace stemming
         void operator()(string_typeT& text) final
             {
             if (text.length() < 2)
-                { return; }
-
-            std::transform(text.cbegin(), text.cend(), text.begin(), full_width_to_narrow);
-            // change 33rd letter ('&#x0451;') to '&#x0435;'
-            std::transform(text.cbegin(), text.cend(), text.begin(),
-                [](auto& ch) noexcept
                 {
-                return (ch == 0x0451 ? RUSSIAN_IE_LOWER :
-                        ch == 0x0401 ? RUSSIAN_IE_UPPER:
-                        ch);
-                });
+                stem<string_typeT, policyT>::normalize_input(text);
+                return;
+                }
 
-            // reset internal data
-            stem<string_typeT>::reset_r_values();
+            prepare_word(text);
 
-            stem<string_typeT>::find_r1(text, RUSSIAN_VOWELS);
-            stem<string_typeT>::find_r2(text, RUSSIAN_VOWELS);
-            stem<string_typeT>::find_russian_rv(text, RUSSIAN_VOWELS);
+            // a word that isn't Cyrillic (or ends with a digit) can't have any of the suffixes
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, ALL_STEP_ENDINGS))
+                { return; }
 
             step_1(text);
             step_2(text);
+            // steps 3 and 4 remove derivational and superlative suffixes
+            if constexpr (policyT::light_stemming)
+                { return; }
             step_3(text);
             step_4(text);
             }
@@ -157,521 +152,218 @@ namespace stemming
         stemming_type get_language() const noexcept final
             { return stemming_type::russian; }
     private:
-        void step_1(string_typeT& text)
+        /** @brief Normalizes the word, changes the 33rd letter (ё) to е, and finds
+                R1, R2, and RV, all in one pass.
+            @param[in,out] text The word to prepare.*/
+        void prepare_word(string_typeT& text)
             {
-            // search for a perfect gerund
-            // group 2
-            if (stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YERU_LOWER, RUSSIAN_YERU_UPPER,
-                                   RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER,
-                                   RUSSIAN_SHA_LOWER, RUSSIAN_SHA_UPPER,
-                                   RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                                   RUSSIAN_ES_LOWER, RUSSIAN_ES_UPPER,
-                                   RUSSIAN_SOFT_SIGN_LOWER, RUSSIAN_SOFT_SIGN_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                                   RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER,
-                                   RUSSIAN_SHA_LOWER, RUSSIAN_SHA_UPPER,
-                                   RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                                   RUSSIAN_ES_LOWER, RUSSIAN_ES_UPPER,
-                                   RUSSIAN_SOFT_SIGN_LOWER, RUSSIAN_SOFT_SIGN_UPPER, false) )
-                { return; }
-            // group 1
-            else if (stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER,
-                                        RUSSIAN_SHA_LOWER, RUSSIAN_SHA_UPPER,
-                                        RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                                        RUSSIAN_ES_LOWER, RUSSIAN_ES_UPPER,
-                                        RUSSIAN_SOFT_SIGN_LOWER, RUSSIAN_SOFT_SIGN_UPPER) )
+            constexpr bool lowercase_text{ policyT::fold_case && !policyT::assume_lowercase };
+            size_t r1{ string_typeT::npos };
+            size_t r2{ string_typeT::npos };
+            size_t rv{ string_typeT::npos };
+            bool r1_vowel_found{ false };
+            bool r2_vowel_found{ false };
+            for (size_t i = 0; i < text.length(); ++i)
                 {
-                if (stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_A_LOWER, RUSSIAN_A_UPPER,
-                                    RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER,
-                                    RUSSIAN_SHA_LOWER, RUSSIAN_SHA_UPPER,
-                                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                                    RUSSIAN_ES_LOWER, RUSSIAN_ES_UPPER,
-                                    RUSSIAN_SOFT_SIGN_LOWER, RUSSIAN_SOFT_SIGN_UPPER) ||
-                    stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER,
-                                    RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER,
-                                    RUSSIAN_SHA_LOWER, RUSSIAN_SHA_UPPER,
-                                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                                    RUSSIAN_ES_LOWER, RUSSIAN_ES_UPPER,
-                                    RUSSIAN_SOFT_SIGN_LOWER, RUSSIAN_SOFT_SIGN_UPPER) )
+                wchar_t ch = text[i];
+                if constexpr (!policyT::assume_no_fullwidth)
+                    { ch = full_width_to_narrow(ch); }
+                if constexpr (lowercase_text)
+                    { ch = tolower_latin1_cyrillic(ch); }
+                ch = (ch == 0x0451 ? RUSSIAN_IE_LOWER :
+                      ch == 0x0401 ? RUSSIAN_IE_UPPER :
+                      ch);
+                text[i] = ch;
+
+                const bool is_vowel{ is_russian_vowel(ch) };
+                // RV is the region after the first vowel
+                if (is_vowel && rv == string_typeT::npos)
+                    { rv = i + 1; }
+                // R1 is the region after the first non-vowel following a vowel,
+                // and R2 is the same thing, but starting in R1
+                if (r1 == string_typeT::npos)
                     {
-                    text.erase(text.end()-5, text.end() );
-                    stem<string_typeT>::update_r_sections(text);
-                    return;
+                    if (is_vowel)
+                        { r1_vowel_found = true; }
+                    else if (r1_vowel_found)
+                        { r1 = i + 1; }
                     }
-                }
-            // group 2
-            else if (stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                                        RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER,
-                                        RUSSIAN_SHA_LOWER, RUSSIAN_SHA_UPPER,
-                                        RUSSIAN_I_LOWER, RUSSIAN_I_UPPER, false) ||
-                     stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YERU_LOWER, RUSSIAN_YERU_UPPER,
-                                        RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER,
-                                        RUSSIAN_SHA_LOWER, RUSSIAN_SHA_UPPER,
-                                        RUSSIAN_I_LOWER, RUSSIAN_I_UPPER, false) )
-                { return; }
-            // group 1
-            else if (stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER,
-                                        RUSSIAN_SHA_LOWER, RUSSIAN_SHA_UPPER,
-                                        RUSSIAN_I_LOWER, RUSSIAN_I_UPPER) )
-                {
-                if (stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_A_LOWER, RUSSIAN_A_UPPER,
-                                    RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER,
-                                    RUSSIAN_SHA_LOWER, RUSSIAN_SHA_UPPER,
-                                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER) ||
-                    stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER,
-                                    RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER,
-                                    RUSSIAN_SHA_LOWER, RUSSIAN_SHA_UPPER,
-                                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER) )
+                else if (r2 == string_typeT::npos)
                     {
-                    text.erase(text.end()-3, text.end() );
-                    stem<string_typeT>::update_r_sections(text);
-                    return;
+                    if (is_vowel)
+                        { r2_vowel_found = true; }
+                    else if (r2_vowel_found)
+                        { r2 = i + 1; }
                     }
                 }
-            // group 2
-            else if (stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YERU_LOWER, RUSSIAN_YERU_UPPER,
-                    RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER, false) )
+
+            stem<string_typeT, policyT>::set_r1((r1 == string_typeT::npos) ? text.length() : r1);
+            stem<string_typeT, policyT>::set_r2((r2 == string_typeT::npos) ? text.length() : r2);
+            stem<string_typeT, policyT>::set_rv((rv == string_typeT::npos) ? text.length() : rv);
+            }
+
+        /// @returns @c true if @c ch is a Russian vowel (in either case).
+        /// @details Both cases of the 32 letters from А to я map onto the same bit
+        ///     of a 32-bit mask, so this is a subtraction, a compare, and a shift.
+        [[nodiscard]]
+        static constexpr bool is_russian_vowel(const wchar_t ch) noexcept
+            {
+            const auto offset = static_cast<uint32_t>(ch) - static_cast<uint32_t>(RUSSIAN_A_UPPER);
+            return (offset < 64 && ((RUSSIAN_VOWEL_MASK >> (offset & 0x1F)) & 1) != 0);
+            }
+
+        void step_1(string_typeT& text)
+            {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "russian::step_1");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_1_ENDINGS))
                 { return; }
-            // group 1
-            else if (stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER) )
-                {
-                if (stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_A_LOWER, RUSSIAN_A_UPPER,
-                    RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER) ||
-                    stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER,
-                        RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER) )
-                    {
-                    text.erase(text.end()-1, text.end() );
-                    stem<string_typeT>::update_r_sections(text);
-                    return;
-                    }
-                }
-            // reflexive
-            if (stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_ES_LOWER, RUSSIAN_ES_UPPER,
-                RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_ES_LOWER, RUSSIAN_ES_UPPER,
-                    RUSSIAN_SOFT_SIGN_LOWER, RUSSIAN_SOFT_SIGN_UPPER, false) )
-                { /*NOOP*/ }
-            // adjectival
-            if (stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YERU_LOWER, RUSSIAN_YERU_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_GHE_LOWER, RUSSIAN_GHE_UPPER, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER,
-                    RUSSIAN_GHE_LOWER, RUSSIAN_GHE_UPPER, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER, RUSSIAN_U_LOWER, RUSSIAN_U_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER, RUSSIAN_U_LOWER, RUSSIAN_U_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YERU_LOWER, RUSSIAN_YERU_UPPER,
-                    RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER,
-                    RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_SHORT_I_LOWER, RUSSIAN_SHORT_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_SHORT_I_LOWER, RUSSIAN_SHORT_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YERU_LOWER, RUSSIAN_YERU_UPPER,
-                    RUSSIAN_SHORT_I_LOWER, RUSSIAN_SHORT_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER,
-                    RUSSIAN_SHORT_I_LOWER, RUSSIAN_SHORT_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YERU_LOWER, RUSSIAN_YERU_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_HA_LOWER, RUSSIAN_HA_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YERU_LOWER, RUSSIAN_YERU_UPPER,
-                    RUSSIAN_HA_LOWER, RUSSIAN_HA_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_U_LOWER, RUSSIAN_U_UPPER,
-                    RUSSIAN_YU_LOWER, RUSSIAN_YU_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YU_LOWER, RUSSIAN_YU_UPPER,
-                    RUSSIAN_YU_LOWER, RUSSIAN_YU_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_A_LOWER, RUSSIAN_A_UPPER,
-                    RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER,
-                    RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER,
-                    RUSSIAN_YU_LOWER, RUSSIAN_YU_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_YU_LOWER, RUSSIAN_YU_UPPER, false) )
-                {
-                // delete participles
-                // group 2
-                if (stem<string_typeT>::delete_if_is_in_rv(text,
-                        RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                        RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER, RUSSIAN_SHA_LOWER, RUSSIAN_SHA_UPPER, false) ||
-                    stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YERU_LOWER, RUSSIAN_YERU_UPPER,
-                        RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER, RUSSIAN_SHA_LOWER, RUSSIAN_SHA_UPPER, false) ||
-                    stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_U_LOWER, RUSSIAN_U_UPPER,
-                        RUSSIAN_YU_LOWER, RUSSIAN_YU_UPPER, RUSSIAN_SHCHA_LOWER, RUSSIAN_SHCHA_UPPER, false) )
-                    { /*NOOP*/ }
-                // group 1
-                else if (
-                    stem<string_typeT>::is_suffix_in_rv(text,
-                        RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER, RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER) ||
-                    stem<string_typeT>::is_suffix_in_rv(text,
-                        RUSSIAN_EN_LOWER, RUSSIAN_EN_UPPER, RUSSIAN_EN_LOWER, RUSSIAN_EN_UPPER) ||
-                    stem<string_typeT>::is_suffix_in_rv(text,
-                        RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER, RUSSIAN_SHA_LOWER, RUSSIAN_SHA_UPPER) ||
-                    stem<string_typeT>::is_suffix_in_rv(text,
-                        RUSSIAN_YU_LOWER, RUSSIAN_YU_UPPER, RUSSIAN_SHCHA_LOWER, RUSSIAN_SHCHA_UPPER) )
-                    {
-                    if (text.length() >= 3 &&
-                        stem<string_typeT>::get_rv() <= text.length()-3 &&
-                        (stem<string_typeT>::is_either(text[text.length()-3], RUSSIAN_A_LOWER,
-                            RUSSIAN_A_UPPER) ||
-                        stem<string_typeT>::is_either(text[text.length()-3], RUSSIAN_YA_LOWER,
-                            RUSSIAN_YA_UPPER)) )
-                        {
-                        text.erase(text.end()-2, text.end() );
-                        stem<string_typeT>::update_r_sections(text);
-                        return;
-                        }
-                    }
-                else if (stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_SHCHA_LOWER, RUSSIAN_SHCHA_UPPER) )
-                    {
-                    if (text.length() >= 2 &&
-                        stem<string_typeT>::get_rv() <= text.length()-2 &&
-                        (stem<string_typeT>::is_either(text[text.length()-2], RUSSIAN_A_LOWER,
-                            RUSSIAN_A_UPPER) ||
-                        stem<string_typeT>::is_either(text[text.length()-2], RUSSIAN_YA_LOWER,
-                            RUSSIAN_YA_UPPER)) )
-                        {
-                        text.erase(text.end()-1, text.end() );
-                        stem<string_typeT>::update_r_sections(text);
-                        return;
-                        }
-                    }
-                return;
-                }
-            // verb
-            // group 2
-            else if (stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_SHORT_I_LOWER, RUSSIAN_SHORT_I_UPPER, RUSSIAN_TE_LOWER, RUSSIAN_TE_UPPER,
-                    RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER, false) ||/*4*/
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_U_LOWER, RUSSIAN_U_UPPER,
-                    RUSSIAN_SHORT_I_LOWER, RUSSIAN_SHORT_I_UPPER, RUSSIAN_TE_LOWER,
-                    RUSSIAN_TE_UPPER, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_SHORT_I_LOWER, RUSSIAN_SHORT_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_U_LOWER, RUSSIAN_U_UPPER,
-                    RUSSIAN_SHORT_I_LOWER, RUSSIAN_SHORT_I_UPPER, false) )
-                {
-                return;
-                }
-            // group 1
-            if (stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_TE_LOWER, RUSSIAN_TE_UPPER, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER) ||
-                stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_SHORT_I_LOWER,
-                    RUSSIAN_SHORT_I_UPPER, RUSSIAN_TE_LOWER, RUSSIAN_TE_UPPER, RUSSIAN_IE_LOWER,
-                    RUSSIAN_IE_UPPER) ||
-                stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_SHA_LOWER, RUSSIAN_SHA_UPPER, RUSSIAN_SOFT_SIGN_LOWER,
-                    RUSSIAN_SOFT_SIGN_UPPER) ||
-                stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_EN_LOWER, RUSSIAN_EN_UPPER,
-                    RUSSIAN_EN_LOWER, RUSSIAN_EN_UPPER, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER) )
-                {
-                if (text.length() >= 4 &&
-                    stem<string_typeT>::get_rv() <= text.length()-4 &&
-                    (stem<string_typeT>::is_either(text[text.length()-4], RUSSIAN_A_LOWER, RUSSIAN_A_UPPER) ||
-                    stem<string_typeT>::is_either(text[text.length()-4], RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER)) )
-                    {
-                    text.erase(text.end()-3, text.end() );
-                    stem<string_typeT>::update_r_sections(text);
-                    return;
-                    }
-                }
-            // group 2
-            else if (stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_EL_LOWER, RUSSIAN_EL_UPPER, RUSSIAN_A_LOWER, RUSSIAN_A_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YERU_LOWER, RUSSIAN_YERU_UPPER,
-                    RUSSIAN_EL_LOWER, RUSSIAN_EL_UPPER, RUSSIAN_A_LOWER, RUSSIAN_A_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_EN_LOWER, RUSSIAN_EN_UPPER, RUSSIAN_A_LOWER, RUSSIAN_A_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_TE_LOWER, RUSSIAN_TE_UPPER, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_EL_LOWER, RUSSIAN_EL_UPPER, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YERU_LOWER, RUSSIAN_YERU_UPPER,
-                    RUSSIAN_EL_LOWER, RUSSIAN_EL_UPPER, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_EL_LOWER, RUSSIAN_EL_UPPER, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YERU_LOWER, RUSSIAN_YERU_UPPER,
-                    RUSSIAN_EL_LOWER, RUSSIAN_EL_UPPER, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_EN_LOWER, RUSSIAN_EN_UPPER, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_U_LOWER, RUSSIAN_U_UPPER,
-                    RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER, RUSSIAN_TE_LOWER, RUSSIAN_TE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_U_LOWER, RUSSIAN_U_UPPER,
-                    RUSSIAN_YU_LOWER, RUSSIAN_YU_UPPER, RUSSIAN_TE_LOWER, RUSSIAN_TE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_EN_LOWER, RUSSIAN_EN_UPPER, RUSSIAN_YERU_LOWER, RUSSIAN_YERU_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_TE_LOWER, RUSSIAN_TE_UPPER, RUSSIAN_SOFT_SIGN_LOWER, RUSSIAN_SOFT_SIGN_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YERU_LOWER, RUSSIAN_YERU_UPPER,
-                    RUSSIAN_TE_LOWER, RUSSIAN_TE_UPPER, RUSSIAN_SOFT_SIGN_LOWER, RUSSIAN_SOFT_SIGN_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_SHA_LOWER, RUSSIAN_SHA_UPPER, RUSSIAN_SOFT_SIGN_LOWER, RUSSIAN_SOFT_SIGN_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_EL_LOWER, RUSSIAN_EL_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YERU_LOWER, RUSSIAN_YERU_UPPER,
-                    RUSSIAN_EL_LOWER, RUSSIAN_EL_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YERU_LOWER, RUSSIAN_YERU_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_EN_LOWER, RUSSIAN_EN_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER,
-                    RUSSIAN_TE_LOWER, RUSSIAN_TE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_TE_LOWER, RUSSIAN_TE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YERU_LOWER, RUSSIAN_YERU_UPPER,
-                    RUSSIAN_TE_LOWER, RUSSIAN_TE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_U_LOWER, RUSSIAN_U_UPPER,
-                    RUSSIAN_YU_LOWER, RUSSIAN_YU_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_YU_LOWER, RUSSIAN_YU_UPPER, false) )
+            if (delete_suffix(text, PERFECTIVE_GERUNDS, GERUND_GROUP_1_COUNT))
+                { return; }
+            delete_suffix(text, REFLEXIVE_SUFFIXES);
+            // an adjectival ending is an adjective, optionally preceded by a participle
+            if (delete_suffix(text, ADJECTIVE_SUFFIXES))
                 {
+                delete_suffix(text, PARTICIPLE_SUFFIXES, PARTICIPLE_GROUP_1_COUNT);
                 return;
                 }
-            // group 1
-            else if (stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_EL_LOWER, RUSSIAN_EL_UPPER,
-                    RUSSIAN_A_LOWER, RUSSIAN_A_UPPER) ||
-                stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_EN_LOWER, RUSSIAN_EN_UPPER,
-                    RUSSIAN_A_LOWER, RUSSIAN_A_UPPER) ||
-                stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_EL_LOWER, RUSSIAN_EL_UPPER,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER) ||
-                stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER) ||
-                stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_EL_LOWER, RUSSIAN_EL_UPPER,
-                    RUSSIAN_O_LOWER, RUSSIAN_O_UPPER) ||
-                stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_EN_LOWER, RUSSIAN_EN_UPPER,
-                    RUSSIAN_O_LOWER, RUSSIAN_O_UPPER) ||
-                stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_TE_LOWER, RUSSIAN_TE_UPPER) ||
-                stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_YU_LOWER, RUSSIAN_YU_UPPER,
-                    RUSSIAN_TE_LOWER, RUSSIAN_TE_UPPER) ||
-                stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_EN_LOWER, RUSSIAN_EN_UPPER,
-                    RUSSIAN_YERU_LOWER, RUSSIAN_YERU_UPPER) ||
-                stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_TE_LOWER, RUSSIAN_TE_UPPER,
-                    RUSSIAN_SOFT_SIGN_LOWER, RUSSIAN_SOFT_SIGN_UPPER) )
-                {
-                if (text.length() >= 3 &&
-                    stem<string_typeT>::get_rv() <= text.length()-3 &&
-                    (stem<string_typeT>::is_either(text[text.length()-3], RUSSIAN_A_LOWER, RUSSIAN_A_UPPER) ||
-                    stem<string_typeT>::is_either(text[text.length()-3], RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER)) )
-                    {
-                    text.erase(text.end()-2, text.end() );
-                    stem<string_typeT>::update_r_sections(text);
-                    return;
-                    }
-                }
-            if (stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_SHORT_I_LOWER,
-                                                    RUSSIAN_SHORT_I_UPPER) ||
-                stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_EL_LOWER, RUSSIAN_EL_UPPER) ||
-                stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_EN_LOWER, RUSSIAN_EN_UPPER) )
-                {
-                if (text.length() >= 2 &&
-                    stem<string_typeT>::get_rv() <= text.length()-2 &&
-                    (stem<string_typeT>::is_either(text[text.length()-2], RUSSIAN_A_LOWER,
-                        RUSSIAN_A_UPPER) ||
-                    stem<string_typeT>::is_either(text[text.length()-2], RUSSIAN_YA_LOWER,
-                        RUSSIAN_YA_UPPER)) )
-                    {
-                    text.erase(text.end()-1, text.end() );
-                    stem<string_typeT>::update_r_sections(text);
-                    return;
-                    }
-                }
-
-            // noun
-            if (stem<string_typeT>::delete_if_is_in_rv(
-                text, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER,
-                    RUSSIAN_HA_LOWER, RUSSIAN_HA_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_A_LOWER, RUSSIAN_A_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_O_LOWER, RUSSIAN_O_UPPER,
-                    RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_SOFT_SIGN_LOWER, RUSSIAN_SOFT_SIGN_UPPER,
-                    RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_SHORT_I_LOWER, RUSSIAN_SHORT_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_A_LOWER, RUSSIAN_A_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_O_LOWER, RUSSIAN_O_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_YU_LOWER, RUSSIAN_YU_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_SOFT_SIGN_LOWER, RUSSIAN_SOFT_SIGN_UPPER,
-                    RUSSIAN_YU_LOWER, RUSSIAN_YU_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_SOFT_SIGN_LOWER, RUSSIAN_SOFT_SIGN_UPPER,
-                    RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_O_LOWER, RUSSIAN_O_UPPER,
-                    RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_VE_LOWER, RUSSIAN_VE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_A_LOWER, RUSSIAN_A_UPPER,
-                    RUSSIAN_HA_LOWER, RUSSIAN_HA_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
-                    RUSSIAN_SHORT_I_LOWER, RUSSIAN_SHORT_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_O_LOWER, RUSSIAN_O_UPPER,
-                    RUSSIAN_SHORT_I_LOWER, RUSSIAN_SHORT_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER,
-                    RUSSIAN_SHORT_I_LOWER, RUSSIAN_SHORT_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_SOFT_SIGN_LOWER, RUSSIAN_SOFT_SIGN_UPPER,
-                    RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER,
-                    RUSSIAN_EM_LOWER, RUSSIAN_EM_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER,
-                    RUSSIAN_HA_LOWER, RUSSIAN_HA_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_I_LOWER, RUSSIAN_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_A_LOWER, RUSSIAN_A_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_O_LOWER, RUSSIAN_O_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_U_LOWER, RUSSIAN_U_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_YU_LOWER, RUSSIAN_YU_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_YA_LOWER, RUSSIAN_YA_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_SOFT_SIGN_LOWER, RUSSIAN_SOFT_SIGN_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_YERU_LOWER, RUSSIAN_YERU_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_SHORT_I_LOWER, RUSSIAN_SHORT_I_UPPER, false) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
-                    RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER, false) )
+            if (delete_suffix(text, VERB_SUFFIXES, VERB_GROUP_1_COUNT))
                 { return; }
+            delete_suffix(text, NOUN_SUFFIXES);
+            }
+        /** @brief Deletes the longest suffix from a group that is in RV.
+            @details The first suffixes of a group can be "group 1" suffixes, which
+                are stored with the а or я that they must follow. That letter is
+                part of the match (and must also be in RV), but is not deleted.
+            @param[in,out] text The word to stem.
+            @param suffixes The suffix group to search.
+            @param group_1_count The number of group 1 suffixes at the start of @c suffixes.
+            @returns @c true if a suffix was deleted.*/
+        template<size_t node_countT>
+        bool delete_suffix(string_typeT& text, const suffix_trie<node_countT>& suffixes,
+                           const size_t group_1_count = 0)
+            {
+            const auto suffix = suffixes.template match_suffix<
+                stem<string_typeT, policyT>::is_lowercased_text()>(text, text.length(),
+                    stem<string_typeT, policyT>::get_rv());
+            if (suffix.m_length == 0)
+                { return false; }
+            text.erase(text.length() - (suffix.m_index < group_1_count ?
+                                        suffix.m_length - 1 : suffix.m_length));
+            stem<string_typeT, policyT>::update_r_sections(text);
+            return true;
             }
         void step_2(string_typeT& text)
-            { stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_I_UPPER, RUSSIAN_I_LOWER); }
+            {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "russian::step_2");
+            stem<string_typeT, policyT>::delete_if_is_in_rv(text, RUSSIAN_I_LOWER, RUSSIAN_I_UPPER);
+            }
         void step_3(string_typeT& text)
             {
-            if (stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "russian::step_3");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_3_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::is_suffix_in_rv(text, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER,
                                    RUSSIAN_ES_LOWER, RUSSIAN_ES_UPPER,
                                    RUSSIAN_TE_LOWER, RUSSIAN_TE_UPPER,
                                    RUSSIAN_SOFT_SIGN_LOWER, RUSSIAN_SOFT_SIGN_UPPER) )
                 {
-                stem<string_typeT>::delete_if_is_in_r2(text, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER,
                                    RUSSIAN_ES_LOWER, RUSSIAN_ES_UPPER,
                                    RUSSIAN_TE_LOWER, RUSSIAN_TE_UPPER,
                                    RUSSIAN_SOFT_SIGN_LOWER, RUSSIAN_SOFT_SIGN_UPPER);
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER,
                                 RUSSIAN_ES_LOWER, RUSSIAN_ES_UPPER,
                                 RUSSIAN_TE_LOWER, RUSSIAN_TE_UPPER) )
                 {
-                stem<string_typeT>::delete_if_is_in_r2(text, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER,
+                stem<string_typeT, policyT>::delete_if_is_in_r2(text, RUSSIAN_O_LOWER, RUSSIAN_O_UPPER,
                                    RUSSIAN_ES_LOWER, RUSSIAN_ES_UPPER,
                                    RUSSIAN_TE_LOWER, RUSSIAN_TE_UPPER);
                 }
             }
         void step_4(string_typeT& text)
             {
-            if (stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_EN_LOWER, RUSSIAN_EN_UPPER,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "russian::step_4");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_4_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::is_suffix_in_rv(text, RUSSIAN_EN_LOWER, RUSSIAN_EN_UPPER,
                                 RUSSIAN_EN_LOWER, RUSSIAN_EN_UPPER) )
                 {
                 text.erase(text.end()-1, text.end() );
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
                                           RUSSIAN_SHORT_I_LOWER, RUSSIAN_SHORT_I_UPPER,
                                           RUSSIAN_SHA_LOWER, RUSSIAN_SHA_UPPER,
                                           RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER) ||
-                stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text, RUSSIAN_IE_LOWER, RUSSIAN_IE_UPPER,
                                           RUSSIAN_SHORT_I_LOWER, RUSSIAN_SHORT_I_UPPER,
                                           RUSSIAN_SHA_LOWER, RUSSIAN_SHA_UPPER))
                 {
-                if (stem<string_typeT>::is_suffix_in_rv(text, RUSSIAN_EN_LOWER, RUSSIAN_EN_UPPER,
+                if (stem<string_typeT, policyT>::is_suffix_in_rv(text, RUSSIAN_EN_LOWER, RUSSIAN_EN_UPPER,
                                 RUSSIAN_EN_LOWER, RUSSIAN_EN_UPPER) )
                     {
                     text.erase(text.end()-1, text.end() );
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 }
             else
-                { stem<string_typeT>::delete_if_is_in_rv(text, RUSSIAN_SOFT_SIGN_LOWER,
+                { stem<string_typeT, policyT>::delete_if_is_in_rv(text, RUSSIAN_SOFT_SIGN_LOWER,
                     RUSSIAN_SOFT_SIGN_UPPER); }
             }
+
+        // а, е, и, о, у, ы, э, ю, and я, as offsets from а
+        static constexpr uint32_t RUSSIAN_VOWEL_MASK{
+            (1U << 0) | (1U << 5) | (1U << 8) | (1U << 14) | (1U << 19) |
+            (1U << 27) | (1U << 29) | (1U << 30) | (1U << 31) };
+
+        // Each suffix group of step 1, searched backwards from the end of the word.
+        // Group 1 suffixes (which must follow а or я) are listed first, with that letter.
+        static constexpr size_t GERUND_GROUP_1_COUNT{ 6 };
+        static constexpr suffix_trie<22> PERFECTIVE_GERUNDS{
+            L"авшись", L"явшись", L"авши", L"явши", L"ав", L"яв",
+            L"ившись", L"ывшись", L"ивши", L"ывши", L"ив", L"ыв" };
+        static constexpr suffix_trie<5> REFLEXIVE_SUFFIXES{ L"ся", L"сь" };
+        static constexpr suffix_trie<39> ADJECTIVE_SUFFIXES{
+            L"ими", L"ыми", L"его", L"ого", L"ему", L"ому", L"ее", L"ие", L"ые", L"ое",
+            L"ей", L"ий", L"ый", L"ой", L"ем", L"им", L"ым", L"ом", L"их", L"ых",
+            L"ую", L"юю", L"ая", L"яя", L"ою", L"ею" };
+        static constexpr size_t PARTICIPLE_GROUP_1_COUNT{ 10 };
+        static constexpr suffix_trie<22> PARTICIPLE_SUFFIXES{
+            L"аем", L"яем", L"анн", L"янн", L"авш", L"явш", L"ающ", L"яющ", L"ащ", L"ящ",
+            L"ивш", L"ывш", L"ующ" };
+        static constexpr size_t VERB_GROUP_1_COUNT{ 34 };
+        static constexpr suffix_trie<91> VERB_SUFFIXES{
+            L"аете", L"яете", L"айте", L"яйте", L"аешь", L"яешь", L"анно", L"янно",
+            L"ала", L"яла", L"ана", L"яна", L"али", L"яли", L"аем", L"яем", L"ало", L"яло",
+            L"ано", L"яно", L"ает", L"яет", L"ают", L"яют", L"аны", L"яны", L"ать", L"ять",
+            L"ай", L"яй", L"ал", L"ял", L"ан", L"ян",
+            L"ейте", L"уйте", L"ей", L"уй", L"ила", L"ыла", L"ена", L"ите", L"или", L"ыли",
+            L"ило", L"ыло", L"ено", L"ует", L"уют", L"ены", L"ить", L"ыть", L"ишь",
+            L"ил", L"ыл", L"им", L"ым", L"ен", L"ят", L"ит", L"ыт", L"ую", L"ю" };
+        // (ией is left out, as the adjectival ей is always removed before it)
+        static constexpr suffix_trie<40> NOUN_SUFFIXES{
+            L"иями", L"иях", L"ями", L"ами", L"иям", L"ием", L"ев", L"ов", L"ие", L"ье",
+            L"ии", L"ей", L"еи", L"ам", L"ом", L"ем", L"ию", L"ью", L"ия", L"ья", L"ах",
+            L"ой", L"ий", L"ям", L"ях", L"и", L"а", L"е", L"о", L"у", L"ю", L"я", L"ь",
+            L"ы", L"й" };
+
+        // the characters that the suffixes of each step can end with
+        // (step 2 is a single character, so it is not filtered; participles are only
+        // removed along with an adjective, so they don't need to be in step 1's)
+        static constexpr character_bitmap STEP_1_ENDINGS{
+            PERFECTIVE_GERUNDS.get_last_characters() | REFLEXIVE_SUFFIXES.get_last_characters() |
+            ADJECTIVE_SUFFIXES.get_last_characters() | VERB_SUFFIXES.get_last_characters() |
+            NOUN_SUFFIXES.get_last_characters() };
+        static constexpr character_bitmap STEP_2_ENDINGS{ L"и" };
+        static constexpr character_bitmap STEP_3_ENDINGS{ L"ть" };
+        static constexpr character_bitmap STEP_4_ENDINGS{ L"еншь" };
+        static constexpr character_bitmap ALL_STEP_ENDINGS{
+            STEP_1_ENDINGS | STEP_2_ENDINGS | STEP_3_ENDINGS | STEP_4_ENDINGS };
         };
     }
 
@@ -20,8 +20,8 @@ namespace stemming
         @brief Spanish stemmer.
     */
     //------------------------------------------------------
-    template <typename string_typeT = std::wstring>
-    class spanish_stem final : public stem<string_typeT>
+    template <typename string_typeT = std::wstring, typename policyT = default_stem_policy>
+    class spanish_stem final : public stem<string_typeT, policyT>
         {
     public:
         /** @brief Stems a Spanish word.
@@ -29,27 +29,36 @@ namespace stemming
         void operator()(string_typeT& text) final
             {
             // reset internal data
-            stem<string_typeT>::reset_r_values();
+            stem<string_typeT, policyT>::reset_r_values();
 
-            std::transform(text.begin(), text.end(), text.begin(), full_width_to_narrow);
-            stem<string_typeT>::remove_possessive_suffix(text);
+            stem<string_typeT, policyT>::normalize_input(text);
+            stem<string_typeT, policyT>::remove_possessive_suffix(text);
 
             if (text.length() < 3)
                 {
-                stem<string_typeT>::remove_spanish_acutes(text);
+                stem<string_typeT, policyT>::remove_spanish_acutes(text);
                 return;
                 }
 
-            stem<string_typeT>::find_r1(text, SPANISH_VOWELS);
-            stem<string_typeT>::find_r2(text, SPANISH_VOWELS);
-            stem<string_typeT>::find_spanish_rv(text, SPANISH_VOWELS);
+            // nothing can be removed from a word that doesn't end with any of the suffixes' letters
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, ALL_STEP_ENDINGS))
+                {
+                stem<string_typeT, policyT>::remove_spanish_acutes(text);
+                return;
+                }
+
+            stem<string_typeT, policyT>::find_r1(text, SPANISH_VOWELS);
+            stem<string_typeT, policyT>::find_r2(text, SPANISH_VOWELS);
+            stem<string_typeT, policyT>::find_spanish_rv(text, SPANISH_VOWELS);
 
-            step_0(text);
+            // light stemming leaves attached pronouns (step 0) and verb suffixes (steps 2a and 2b) alone
+            if constexpr (!policyT::light_stemming)
+                { step_0(text); }
             step_1(text);
             // steps 2a and 2b are only called from step1
             step_3(text);
 
-            stem<string_typeT>::remove_spanish_acutes(text);
+            stem<string_typeT, policyT>::remove_spanish_acutes(text);
             }
         /// @returns The stemmer's language.
         [[nodiscard]]
@@ -59,375 +68,54 @@ namespace stemming
         //---------------------------------------------
         void step_0(string_typeT& text)
             {
-            if (stem<string_typeT>::is_suffix_in_rv(text,/*selos*/common_lang_constants::LOWER_S,
-                common_lang_constants::UPPER_S, common_lang_constants::LOWER_E,
-                common_lang_constants::UPPER_E, common_lang_constants::LOWER_L,
-                common_lang_constants::UPPER_L, common_lang_constants::LOWER_O,
-                common_lang_constants::UPPER_O, common_lang_constants::LOWER_S,
-                common_lang_constants::UPPER_S))
-                {
-                if (step_0a(text, 5))
-                    { return; }
-                if (step_0b(text, 5))
-                    { return; }
-                if (step_0c(text, 5))
-                    { return; }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,/*selas*/common_lang_constants::LOWER_S,
-                common_lang_constants::UPPER_S, common_lang_constants::LOWER_E,
-                common_lang_constants::UPPER_E, common_lang_constants::LOWER_L,
-                common_lang_constants::UPPER_L, common_lang_constants::LOWER_A,
-                common_lang_constants::UPPER_A, common_lang_constants::LOWER_S,
-                common_lang_constants::UPPER_S))
-                {
-                if (step_0a(text, 5))
-                    { return; }
-                if (step_0b(text, 5))
-                    { return; }
-                if (step_0c(text, 5))
-                    { return; }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
-                /*sela*/
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A))
-                {
-                if (step_0a(text, 4))
-                    { return; }
-                if (step_0b(text, 4))
-                    { return; }
-                if (step_0c(text, 4))
-                    { return; }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
-                /*selo*/
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O))
-                {
-                if (step_0a(text, 4))
-                    { return; }
-                if (step_0b(text, 4))
-                    { return; }
-                if (step_0c(text, 4))
-                    { return; }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
-                /*las*/
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S))
-                {
-                if (step_0a(text, 3))
-                    { return; }
-                if (step_0b(text, 3))
-                    { return; }
-                if (step_0c(text, 3))
-                    { return; }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
-                /*les*/
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S))
-                {
-                if (step_0a(text, 3))
-                    { return; }
-                if (step_0b(text, 3))
-                    { return; }
-                if (step_0c(text, 3))
-                    { return; }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
-                /*los*/
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S))
-                {
-                if (step_0a(text, 3))
-                    { return; }
-                if (step_0b(text, 3))
-                    { return; }
-                if (step_0c(text, 3))
-                    { return; }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
-                /*nos*/
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S))
-                {
-                if (step_0a(text, 3))
-                    { return; }
-                if (step_0b(text, 3))
-                    { return; }
-                if (step_0c(text, 3))
-                    { return; }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
-                /*la*/
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A))
-                {
-                if (step_0a(text, 2))
-                    { return; }
-                if (step_0b(text, 2))
-                    { return; }
-                if (step_0c(text, 2))
-                    { return; }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
-                /*le*/
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E))
-                {
-                if (step_0a(text, 2))
-                    { return; }
-                if (step_0b(text, 2))
-                    { return; }
-                if (step_0c(text, 2))
-                    { return; }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
-                /*lo*/
-                common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
-                common_lang_constants::LOWER_O, common_lang_constants::UPPER_O))
-                {
-                if (step_0a(text, 2))
-                    { return; }
-                if (step_0b(text, 2))
-                    { return; }
-                if (step_0c(text, 2))
-                    { return; }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
-                /*me*/
-                common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E))
-                {
-                if (step_0a(text, 2))
-                    { return; }
-                if (step_0b(text, 2))
-                    { return; }
-                if (step_0c(text, 2))
-                    { return; }
-                return;
-                }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
-                /*se*/
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E))
-                {
-                if (step_0a(text, 2))
-                    { return; }
-                if (step_0b(text, 2))
-                    { return; }
-                if (step_0c(text, 2))
-                    { return; }
-                return;
-                }
-            }
-        //---------------------------------------------
-        bool step_0a(string_typeT& text, size_t suffix_length)
-            {
-            if ((text.length() >= suffix_length+5) &&
-                stem<string_typeT>::get_rv() <= (text.length()-(5+suffix_length)) &&
-                /*iéndo*/
-                (stem<string_typeT>::is_either(text[text.length()-(5+suffix_length)],
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                stem<string_typeT>::is_either(text[text.length()-(4+suffix_length)],
-                    common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE) &&
-                stem<string_typeT>::is_either(text[text.length()-(3+suffix_length)],
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                stem<string_typeT>::is_either(text[text.length()-(2+suffix_length)],
-                    common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) &&
-                stem<string_typeT>::is_either(text[text.length()-(1+suffix_length)],
-                    common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) ) )
-                {
-                text.erase(text.length()-suffix_length);
-                text[text.length()-4] = common_lang_constants::LOWER_E;
-                stem<string_typeT>::update_r_sections(text);
-                return true;
-                }
-            else if ((text.length() >= suffix_length+4) &&
-                stem<string_typeT>::get_rv() <= (text.length()-(4+suffix_length)) &&
-                /*ándo*/
-                (stem<string_typeT>::is_either(text[text.length()-(4+suffix_length)],
-                    common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE) &&
-                stem<string_typeT>::is_either(text[text.length()-(3+suffix_length)],
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                stem<string_typeT>::is_either(text[text.length()-(2+suffix_length)],
-                    common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) &&
-                stem<string_typeT>::is_either(text[text.length()-(1+suffix_length)],
-                    common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) ) )
-                {
-                text.erase(text.length()-suffix_length);
-                text[text.length()-4] = common_lang_constants::LOWER_A;
-                stem<string_typeT>::update_r_sections(text);
-                return true;
-                }
-            else if ((text.length() >= suffix_length+2) &&
-                stem<string_typeT>::get_rv() <= (text.length()-(2+suffix_length)) &&
-                /*ár*/
-                (stem<string_typeT>::is_either(text[text.length()-(2+suffix_length)],
-                    common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE) &&
-                stem<string_typeT>::is_either(text[text.length()-(1+suffix_length)],
-                    common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) ) )
-                {
-                text.erase(text.length()-suffix_length);
-                text[text.length()-2] = common_lang_constants::LOWER_A;
-                stem<string_typeT>::update_r_sections(text);
-                return true;
-                }
-            else if ((text.length() >= suffix_length+2) &&
-                stem<string_typeT>::get_rv() <= (text.length()-(2+suffix_length)) &&
-                /*ér*/
-                (stem<string_typeT>::is_either(text[text.length()-(2+suffix_length)],
-                    common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE) &&
-                stem<string_typeT>::is_either(text[text.length()-(1+suffix_length)],
-                    common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) ) )
-                {
-                text.erase(text.length()-suffix_length);
-                text[text.length()-2] = common_lang_constants::LOWER_E;
-                stem<string_typeT>::update_r_sections(text);
-                return true;
-                }
-            else if ((text.length() >= suffix_length + 2) &&
-                stem<string_typeT>::get_rv() <= (text.length()-(2+suffix_length)) &&
-                /*ír*/
-                (stem<string_typeT>::is_either(text[text.length()-(2+suffix_length)],
-                    common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE) &&
-                stem<string_typeT>::is_either(text[text.length()-(1+suffix_length)],
-                    common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) ) )
-                {
-                text.erase(text.length()-suffix_length);
-                text[text.length()-2] = common_lang_constants::LOWER_I;
-                stem<string_typeT>::update_r_sections(text);
-                return true;
-                }
-            return false;
-            }
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "spanish::step_0");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_0_ENDINGS))
+                { return; }
+            const auto pronoun = stem<string_typeT, policyT>::find_attached_pronoun(text,
+                ATTACHED_PRONOUNS, PRONOUN_VERB_ENDINGS, stem<string_typeT, policyT>::get_rv());
+            if (pronoun.m_verb_ending_length == 0)
+                { return; }
+            const size_t verb_ending_start = text.length() - pronoun.m_pronoun_length - pronoun.m_verb_ending_length;
+            // yendo must follow a u (which doesn't need to be in RV)
+            if (pronoun.m_verb_ending_index == YENDO_INDEX &&
+                (verb_ending_start == 0 ||
+                 !stem<string_typeT, policyT>::is_either_case(text[verb_ending_start - 1],
+                    common_lang_constants::LOWER_U, common_lang_constants::UPPER_U)))
+                { return; }
 
-        //---------------------------------------------
-        bool step_0b(string_typeT& text, size_t suffix_length)
-            {
-            if ((text.length() >= suffix_length+5) &&
-                stem<string_typeT>::get_rv() <= (text.length()-(5+suffix_length)) &&
-                /*iendo*/
-                (stem<string_typeT>::is_either(text[text.length()-(5+suffix_length)],
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                stem<string_typeT>::is_either(text[text.length()-(4+suffix_length)],
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                stem<string_typeT>::is_either(text[text.length()-(3+suffix_length)],
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                stem<string_typeT>::is_either(text[text.length()-(2+suffix_length)],
-                    common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) &&
-                stem<string_typeT>::is_either(text[text.length()-(1+suffix_length)],
-                    common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) ) )
-                {
-                text.erase(text.length()-suffix_length);
-                stem<string_typeT>::update_r_sections(text);
-                return true;
-                }
-            else if ((text.length() >= suffix_length+4) &&
-                stem<string_typeT>::get_rv() <= (text.length()-(4+suffix_length)) &&
-                /*ando*/
-                (stem<string_typeT>::is_either(text[text.length()-(4+suffix_length)],
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                stem<string_typeT>::is_either(text[text.length()-(3+suffix_length)],
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                stem<string_typeT>::is_either(text[text.length()-(2+suffix_length)],
-                    common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) &&
-                stem<string_typeT>::is_either(text[text.length()-(1+suffix_length)],
-                    common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) ) )
-                {
-                text.erase(text.length()-suffix_length);
-                stem<string_typeT>::update_r_sections(text);
-                return true;
-                }
-            else if ((text.length() >= suffix_length+2) &&
-                stem<string_typeT>::get_rv() <= (text.length()-(2+suffix_length)) &&
-                /*ar*/
-                (stem<string_typeT>::is_either(text[text.length()-(2+suffix_length)],
-                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                stem<string_typeT>::is_either(text[text.length()-(1+suffix_length)],
-                    common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) ) )
-                {
-                text.erase(text.length()-suffix_length);
-                stem<string_typeT>::update_r_sections(text);
-                return true;
-                }
-            else if ((text.length() >= suffix_length+2) &&
-                stem<string_typeT>::get_rv() <= (text.length()-(2+suffix_length)) &&
-                /*er*/
-                (stem<string_typeT>::is_either(text[text.length()-(2+suffix_length)],
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                stem<string_typeT>::is_either(text[text.length()-(1+suffix_length)],
-                    common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) ) )
+            text.erase(text.length() - pronoun.m_pronoun_length);
+            // the accent on the verb is no longer needed once the pronoun is removed
+            if (pronoun.m_verb_ending_index < ACCENTED_VERB_ENDING_COUNT)
                 {
-                text.erase(text.length()-suffix_length);
-                stem<string_typeT>::update_r_sections(text);
-                return true;
-                }
-            else if ((text.length() >= suffix_length+2) &&
-                stem<string_typeT>::get_rv() <= (text.length()-(2+suffix_length)) &&
-                /*ir*/
-                (stem<string_typeT>::is_either(text[text.length()-(2+suffix_length)],
-                    common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                stem<string_typeT>::is_either(text[text.length()-(1+suffix_length)],
-                    common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) ) )
-                {
-                text.erase(text.length()-suffix_length);
-                stem<string_typeT>::update_r_sections(text);
-                return true;
+                for (size_t i = verb_ending_start; i < text.length(); ++i)
+                    {
+                    if (stem<string_typeT, policyT>::is_either_case(text[i],
+                        common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE))
+                        { text[i] = common_lang_constants::LOWER_A; }
+                    else if (stem<string_typeT, policyT>::is_either_case(text[i],
+                        common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE))
+                        { text[i] = common_lang_constants::LOWER_E; }
+                    else if (stem<string_typeT, policyT>::is_either_case(text[i],
+                        common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE))
+                        { text[i] = common_lang_constants::LOWER_I; }
+                    }
                 }
-            return false;
-            }
-
-        //---------------------------------------------
-        bool step_0c(string_typeT& text, size_t suffix_length)
-            {
-            if ((text.length() >= suffix_length+6) &&
-                stem<string_typeT>::get_rv() <= text.length()-(suffix_length+5) &&
-                /*uyendo*/
-                (stem<string_typeT>::is_either(text[text.length()-(6+suffix_length)],
-                    common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) &&
-                stem<string_typeT>::is_either(text[text.length()-(5+suffix_length)],
-                    common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y) &&
-                stem<string_typeT>::is_either(text[text.length()-(4+suffix_length)],
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                stem<string_typeT>::is_either(text[text.length()-(3+suffix_length)],
-                    common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                stem<string_typeT>::is_either(text[text.length()-(2+suffix_length)],
-                    common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) &&
-                stem<string_typeT>::is_either(text[text.length()-(1+suffix_length)],
-                    common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) ) )
-                {
-                text.erase(text.length()-suffix_length);
-                stem<string_typeT>::update_r_sections(text);
-                return true;
-                }
-            return false;
+            stem<string_typeT, policyT>::update_r_sections(text);
             }
         //---------------------------------------------
         void step_1(string_typeT& text)
             {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "spanish::step_1");
+            // nothing to remove here, so go straight to the next step
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_1_ENDINGS))
+                {
+                step_2a(text);
+                return;
+                }
             const size_t original_length = text.length();
-            if (stem<string_typeT>::delete_if_is_in_r2(text,
+            if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*imientos*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -444,7 +132,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*amientos*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -461,7 +149,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_r2(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r2(text,
                 /*uciones*/
                 common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                 common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
@@ -472,10 +160,10 @@ namespace stemming
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 text.erase(text.length()-6);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*amiento*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -491,7 +179,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*imiento*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -507,7 +195,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*aciones*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
@@ -519,7 +207,7 @@ namespace stemming
                 {
                 if (original_length > text.length() )
                     {
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ic*/
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_C, common_lang_constants::UPPER_C);
@@ -527,7 +215,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_r2(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r2(text,
                     /*logías*/
                     common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                     common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
@@ -537,10 +225,10 @@ namespace stemming
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
                 {
                 text.erase(text.length()-3);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_r2(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r2(text,
                 /*encias*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -552,10 +240,10 @@ namespace stemming
                 text.erase(text.length()-2);
                 text[text.length()-2] = common_lang_constants::LOWER_T;
                 text[text.length()-1] = common_lang_constants::LOWER_E;
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*idades*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
@@ -566,17 +254,17 @@ namespace stemming
                 {
                 if (original_length > text.length() )
                     {
-                    if (stem<string_typeT>::delete_if_is_in_r2(text,
+                    if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                             /*abil*/
                             common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                             common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                             common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                             common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) ||
-                        stem<string_typeT>::delete_if_is_in_r2(text,
+                        stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                             /*ic*/
                             common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                             common_lang_constants::LOWER_C, common_lang_constants::UPPER_C) ||
-                        stem<string_typeT>::delete_if_is_in_r2(text,
+                        stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                             /*iv*/
                             common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                             common_lang_constants::LOWER_V, common_lang_constants::UPPER_V) )
@@ -587,7 +275,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /*amente*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
@@ -598,12 +286,12 @@ namespace stemming
                 {
                 if (original_length > text.length() )
                     {
-                    if (stem<string_typeT>::delete_if_is_in_r2(text,
+                    if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*iv*/
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_V, common_lang_constants::UPPER_V) )
                         {
-                        stem<string_typeT>::delete_if_is_in_r2(text,
+                        stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                             /*at*/
                             common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                             common_lang_constants::LOWER_T, common_lang_constants::UPPER_T);
@@ -611,15 +299,15 @@ namespace stemming
                         }
                     else
                         {
-                        if (stem<string_typeT>::delete_if_is_in_r2(text,
+                        if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                                 /*os*/
                                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) ||
-                            stem<string_typeT>::delete_if_is_in_r2(text,
+                            stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                                 /*ic*/
                                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                                 common_lang_constants::LOWER_C, common_lang_constants::UPPER_C) ||
-                            stem<string_typeT>::delete_if_is_in_r2(text,
+                            stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                                 /*ad*/
                                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) )
@@ -631,7 +319,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                          /*adores*/
                          common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                          common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
@@ -639,7 +327,7 @@ namespace stemming
                          common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                          common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                          common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) ||
-                     stem<string_typeT>::delete_if_is_in_r2(text,
+                     stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                          /*adoras*/
                          common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                          common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
@@ -647,7 +335,7 @@ namespace stemming
                          common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                          common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                          common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) ||
-                     stem<string_typeT>::delete_if_is_in_r2(text,
+                     stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                          /*ancias*/
                          common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                          common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -655,7 +343,7 @@ namespace stemming
                          common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                          common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                          common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) ||
-                     stem<string_typeT>::delete_if_is_in_r2(text,
+                     stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                          /*acion*/
                          common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                          common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
@@ -665,7 +353,7 @@ namespace stemming
                 {
                 if (original_length > text.length() )
                     {
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ic*/
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_C, common_lang_constants::UPPER_C);
@@ -673,28 +361,28 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*adora*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
                         common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                         common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) ||
-                     stem<string_typeT>::delete_if_is_in_r2(text,
+                     stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ación*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_O_ACUTE, common_lang_constants::UPPER_O_ACUTE,
                         common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ||
-                     stem<string_typeT>::delete_if_is_in_r2(text,
+                     stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*antes*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                         common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) ||
-                     stem<string_typeT>::delete_if_is_in_r2(text,
+                     stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ancia*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -704,7 +392,7 @@ namespace stemming
                 {
                 if (original_length > text.length() )
                     {
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ic*/
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_C, common_lang_constants::UPPER_C);
@@ -712,7 +400,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ibles*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
@@ -726,7 +414,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*istas*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -740,7 +428,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ables*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
@@ -754,7 +442,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ismos*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -768,7 +456,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*anzas*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -782,7 +470,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_r2(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r2(text,
                 /*logía*/
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
@@ -791,10 +479,10 @@ namespace stemming
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) )
                 {
                 text.erase(text.length()-2);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_r2(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r2(text,
                 /*ución*/
                 common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                 common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
@@ -803,10 +491,10 @@ namespace stemming
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) )
                 {
                 text.erase(text.length()-4);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_r2(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r2(text,
                 /*ucion (misspelling of ución)*/
                 common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
                 common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
@@ -815,10 +503,10 @@ namespace stemming
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N))
                 {
                 text.erase(text.length() - 4);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
-            else if (stem<string_typeT>::is_suffix_in_r2(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r2(text,
                 /*encia*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -829,10 +517,10 @@ namespace stemming
                 text.erase(text.length()-1);
                 text[text.length()-2] = common_lang_constants::LOWER_T;
                 text[text.length()-1] = common_lang_constants::LOWER_E;
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*mente*/
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -842,19 +530,19 @@ namespace stemming
                 {
                 if (original_length > text.length() )
                     {
-                    if (stem<string_typeT>::delete_if_is_in_r2(text,
+                    if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                             /*ante*/
                             common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                             common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                             common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                             common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                        stem<string_typeT>::delete_if_is_in_r2(text,
+                        stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                             /*able*/
                             common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                             common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                             common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                             common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) ||
-                        stem<string_typeT>::delete_if_is_in_r2(text,
+                        stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                             /*ible*/
                             common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                             common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
@@ -867,7 +555,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*anza*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -880,7 +568,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*icos*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
@@ -893,7 +581,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*icas*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
@@ -906,7 +594,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ismo*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -919,7 +607,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*able*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
@@ -932,7 +620,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ible*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
@@ -945,7 +633,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ista*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -958,7 +646,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*osos*/
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -971,7 +659,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*osas*/
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -984,7 +672,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ivas*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -993,7 +681,7 @@ namespace stemming
                 {
                 if (original_length > text.length() )
                     {
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*at*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T);
@@ -1001,7 +689,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ivos*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1010,7 +698,7 @@ namespace stemming
                 {
                 if (original_length > text.length() )
                     {
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*at*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T);
@@ -1018,13 +706,13 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ador*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
                         common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                         common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) ||
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ante*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
@@ -1033,7 +721,7 @@ namespace stemming
                 {
                 if (original_length > text.length() )
                     {
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*ic*/
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                         common_lang_constants::LOWER_C, common_lang_constants::UPPER_C);
@@ -1041,7 +729,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*idad*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
@@ -1050,17 +738,17 @@ namespace stemming
                 {
                 if (original_length > text.length() )
                     {
-                    if (stem<string_typeT>::delete_if_is_in_r2(text,
+                    if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                             /*abil*/
                             common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                             common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                             common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                             common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) ||
-                        stem<string_typeT>::delete_if_is_in_r2(text,
+                        stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                             /*ic*/
                             common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                             common_lang_constants::LOWER_C, common_lang_constants::UPPER_C) ||
-                        stem<string_typeT>::delete_if_is_in_r2(text,
+                        stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                             /*iv*/
                             common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                             common_lang_constants::LOWER_V, common_lang_constants::UPPER_V) )
@@ -1071,7 +759,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ico*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
@@ -1083,7 +771,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ica*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_C, common_lang_constants::UPPER_C,
@@ -1095,7 +783,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*oso*/
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1107,7 +795,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*osa*/
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1119,7 +807,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*iva*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1127,7 +815,7 @@ namespace stemming
                 {
                 if (original_length > text.length() )
                     {
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*at*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T);
@@ -1135,7 +823,7 @@ namespace stemming
                     }
                 step_2a(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r2(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                 /*ivo*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_V, common_lang_constants::UPPER_V,
@@ -1143,7 +831,7 @@ namespace stemming
                 {
                 if (original_length > text.length() )
                     {
-                    stem<string_typeT>::delete_if_is_in_r2(text,
+                    stem<string_typeT, policyT>::delete_if_is_in_r2(text,
                         /*at*/
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T);
@@ -1160,8 +848,31 @@ namespace stemming
         //---------------------------------------------
         void step_2a(string_typeT& text)
             {
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "spanish::step_2a");
+            // light stemming only removes the plural endings of step 2b
+            if constexpr (policyT::light_stemming)
+                {
+                if (!stem<string_typeT, policyT>::delete_if_is_in_rv(text,
+                    /*as*/
+                    common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
+                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
+                    {
+                    stem<string_typeT, policyT>::delete_if_is_in_rv(text,
+                        /*es*/
+                        common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
+                        common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false);
+                    }
+                return;
+                }
+            // nothing to remove here, so go straight to the next step
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_2A_ENDINGS))
+                {
+                step_2b(text);
+                return;
+                }
             const size_t original_length = text.length();
-            if (stem<string_typeT>::is_suffix_in_rv(text,
+            if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*yeron*/
                 common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -1169,16 +880,16 @@ namespace stemming
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N))
                 {
-                if (stem<string_typeT>::is_either(text[text.length()-6],
+                if (stem<string_typeT, policyT>::is_either_case(text[text.length()-6],
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) )
                     {
                     text.erase(text.length()-5);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     return;
                     }
                 step_2b(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*yendo*/
                 common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -1187,16 +898,16 @@ namespace stemming
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O))
                 {
                 if (text.length() >= 6 &&
-                    stem<string_typeT>::is_either(text[text.length()-6],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-6],
                         common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) )
                     {
                     text.erase(text.length()-5);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     return;
                     }
                 step_2b(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*yamos*/
                 common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
@@ -1205,16 +916,16 @@ namespace stemming
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S))
                 {
                 if (text.length() >= 6 &&
-                    stem<string_typeT>::is_either(text[text.length()-6],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-6],
                         common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) )
                     {
                     text.erase(text.length()-5);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     return;
                     }
                 step_2b(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*yais*/
                 common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
@@ -1222,135 +933,135 @@ namespace stemming
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S))
                 {
                 if (text.length() >= 5 &&
-                    stem<string_typeT>::is_either(text[text.length()-5],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-5],
                         common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) )
                     {
                     text.erase(text.length()-4);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     return;
                     }
                 step_2b(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*yan*/
                 common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N))
                 {
                 if (text.length() >= 4 &&
-                    stem<string_typeT>::is_either(text[text.length()-4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4],
                         common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) )
                     {
                     text.erase(text.length()-3);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     return;
                     }
                 step_2b(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*yen*/
                 common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N))
                 {
                 if (text.length() >= 4 &&
-                    stem<string_typeT>::is_either(text[text.length()-4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4],
                         common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) )
                     {
                     text.erase(text.length()-3);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     return;
                     }
                 step_2b(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*yas*/
                 common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S))
                 {
                 if (text.length() >= 4 &&
-                    stem<string_typeT>::is_either(text[text.length()-4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4],
                         common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) )
                     {
                     text.erase(text.length()-3);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     return;
                     }
                 step_2b(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*yes*/
                 common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S))
                 {
                 if (text.length() >= 4 &&
-                    stem<string_typeT>::is_either(text[text.length()-4],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4],
                         common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) )
                     {
                     text.erase(text.length()-3);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     return;
                     }
                 step_2b(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*ya*/
                 common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A))
                 {
                 if (text.length() >= 3 &&
-                    stem<string_typeT>::is_either(text[text.length()-3],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3],
                         common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) )
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     return;
                     }
                 step_2b(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*ye*/
                 common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E))
                 {
                 if (text.length() >= 3 &&
-                    stem<string_typeT>::is_either(text[text.length()-3],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3],
                         common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) )
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     return;
                     }
                 step_2b(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*yo*/
                 common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O))
                 {
                 if (text.length() >= 3 &&
-                    stem<string_typeT>::is_either(text[text.length()-3],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3],
                         common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) )
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     return;
                     }
                 step_2b(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_rv(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_rv(text,
                 /*yó*/
                 common_lang_constants::LOWER_Y, common_lang_constants::UPPER_Y,
                 common_lang_constants::LOWER_O_ACUTE, common_lang_constants::UPPER_O_ACUTE))
                 {
                 if (text.length() >= 3 &&
-                    stem<string_typeT>::is_either(text[text.length()-3],
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3],
                         common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) )
                     {
                     text.erase(text.length()-2);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     return;
                     }
                 step_2b(text);
@@ -1364,7 +1075,11 @@ namespace stemming
         //---------------------------------------------
         void step_2b(string_typeT& text)
             {
-            if (stem<string_typeT>::delete_if_is_in_rv(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "spanish::step_2b");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_2B_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*aríamos*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1374,7 +1089,7 @@ namespace stemming
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*eríamos*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1384,7 +1099,7 @@ namespace stemming
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*iríamos*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1394,7 +1109,7 @@ namespace stemming
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*iéramos*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE,
@@ -1404,7 +1119,7 @@ namespace stemming
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*iésemos*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE,
@@ -1414,7 +1129,7 @@ namespace stemming
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*aríais*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1423,7 +1138,7 @@ namespace stemming
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*aremos*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1432,7 +1147,7 @@ namespace stemming
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*eríais*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1441,7 +1156,7 @@ namespace stemming
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*eremos*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1450,7 +1165,7 @@ namespace stemming
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*iríais*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1459,7 +1174,7 @@ namespace stemming
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*iremos*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1468,7 +1183,7 @@ namespace stemming
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ierais*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -1477,7 +1192,7 @@ namespace stemming
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ieseis*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -1486,7 +1201,7 @@ namespace stemming
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*asteis*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1495,7 +1210,7 @@ namespace stemming
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*isteis*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1504,7 +1219,7 @@ namespace stemming
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ábamos*/
                 common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
                 common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
@@ -1513,7 +1228,7 @@ namespace stemming
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*áramos*/
                 common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1522,7 +1237,7 @@ namespace stemming
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ásemos*/
                 common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1531,7 +1246,7 @@ namespace stemming
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*arían*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1539,7 +1254,7 @@ namespace stemming
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*arías*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1547,7 +1262,7 @@ namespace stemming
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*aréis*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1555,7 +1270,7 @@ namespace stemming
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*erían*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1563,7 +1278,7 @@ namespace stemming
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*erías*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1571,7 +1286,7 @@ namespace stemming
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*eréis*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1579,7 +1294,7 @@ namespace stemming
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*irían*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1587,7 +1302,7 @@ namespace stemming
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*irías*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1595,7 +1310,7 @@ namespace stemming
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*iréis*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1603,7 +1318,7 @@ namespace stemming
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ieran*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -1611,7 +1326,7 @@ namespace stemming
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*iesen*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -1619,7 +1334,7 @@ namespace stemming
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ieron*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -1627,7 +1342,7 @@ namespace stemming
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*iendo*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -1635,7 +1350,7 @@ namespace stemming
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ieras*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -1643,7 +1358,7 @@ namespace stemming
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ieses*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
@@ -1651,7 +1366,7 @@ namespace stemming
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*abais*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
@@ -1659,7 +1374,7 @@ namespace stemming
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*arais*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
@@ -1667,7 +1382,7 @@ namespace stemming
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*aseis*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
@@ -1675,7 +1390,7 @@ namespace stemming
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*íamos*/
                 common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
@@ -1683,409 +1398,409 @@ namespace stemming
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*emos*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 {
-                if (stem<string_typeT>::is_suffix(text,
+                if (stem<string_typeT, policyT>::is_suffix(text,
                     /*gu*/
                     common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) )
                     {
                     text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*arán*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*arás*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*aría*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*erán*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*erás*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ería*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*irán*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*irás*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*iría*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*iera*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*iese*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*aste*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*iste*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*aban*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*aran*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*asen*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*aron*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ando*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*abas*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*adas*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*idas*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*aras*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ases*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*íais*/
                 common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ados*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*idos*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*amos*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*imos*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_M, common_lang_constants::UPPER_M,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ará*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*aré*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*erá*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*eré*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*irá*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*iré*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*aba*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_B, common_lang_constants::UPPER_B,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ada*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ida*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ara*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ase*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ían*/
                 common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ado*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ido*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
                 common_lang_constants::LOWER_O, common_lang_constants::UPPER_O, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ías*/
                 common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*áis*/
                 common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE,
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*éis*/
                 common_lang_constants::LOWER_E_ACUTE, common_lang_constants::UPPER_E_ACUTE,
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 {
-                if (stem<string_typeT>::is_suffix(text,
+                if (stem<string_typeT, policyT>::is_suffix(text,
                     /*gu*/
                     common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) )
                     {
                     text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ía*/
                 common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ad*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ed*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*id*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*an*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ió*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_O_ACUTE, common_lang_constants::UPPER_O_ACUTE, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ar*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*er*/
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ir*/
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*as*/
                 common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*ís*/
                 common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*en*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
                 {
-                if (stem<string_typeT>::is_suffix(text,
+                if (stem<string_typeT, policyT>::is_suffix(text,
                     /*gu*/
                     common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) )
                     {
                     text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                 /*es*/
                     common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 {
-                if (stem<string_typeT>::is_suffix(text,
+                if (stem<string_typeT, policyT>::is_suffix(text,
                     /*gu*/
                     common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
                     common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) )
                     {
                     text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
+                    stem<string_typeT, policyT>::update_r_sections(text);
                     }
                 return;
                 }
@@ -2093,30 +1808,34 @@ namespace stemming
          //---------------------------------------------
         void step_3(string_typeT& text)
             {
-            if (stem<string_typeT>::delete_if_is_in_rv(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "spanish::step_3");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_3_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*os*/common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
                     common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*a*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*o*/common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*á*/common_lang_constants::LOWER_A_ACUTE, common_lang_constants::UPPER_A_ACUTE) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*í*/common_lang_constants::LOWER_I_ACUTE, common_lang_constants::UPPER_I_ACUTE) ||
-                stem<string_typeT>::delete_if_is_in_rv(text,
+                stem<string_typeT, policyT>::delete_if_is_in_rv(text,
                     /*ó*/common_lang_constants::LOWER_O_ACUTE, common_lang_constants::UPPER_O_ACUTE) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_rv(text,/*é*/common_lang_constants::LOWER_E_ACUTE,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_rv(text,/*é*/common_lang_constants::LOWER_E_ACUTE,
                         common_lang_constants::UPPER_E_ACUTE) ||
-                    stem<string_typeT>::delete_if_is_in_rv(text,/*e*/common_lang_constants::LOWER_E,
+                    stem<string_typeT, policyT>::delete_if_is_in_rv(text,/*e*/common_lang_constants::LOWER_E,
                         common_lang_constants::UPPER_E) )
                 {
-                if (stem<string_typeT>::is_suffix_in_rv(text,/*u*/common_lang_constants::LOWER_U,
+                if (stem<string_typeT, policyT>::is_suffix_in_rv(text,/*u*/common_lang_constants::LOWER_U,
                     common_lang_constants::UPPER_U))
                     {
                     if (text.length() >= 2 &&
-                        stem<string_typeT>::is_either(text[text.length()-2],
+                        stem<string_typeT, policyT>::is_either_case(text[text.length()-2],
                             common_lang_constants::LOWER_G,
                             common_lang_constants::UPPER_G) )
                         { text.erase(text.length()-1); }
@@ -2124,6 +1843,24 @@ namespace stemming
                 return;
                 }
             }
+
+        // the pronouns (and the gerunds and infinitives in front of them) removed by step 0,
+        // with the endings whose accent is removed along with the pronoun listed first
+        static constexpr suffix_trie<25> ATTACHED_PRONOUNS{ L"selos", L"selas", L"sela", L"selo",
+            L"las", L"les", L"los", L"nos", L"la", L"le", L"lo", L"me", L"se" };
+        static constexpr suffix_trie<18> PRONOUN_VERB_ENDINGS{ L"iéndo", L"ándo", L"ár", L"ér", L"ír",
+            L"iendo", L"ando", L"ar", L"er", L"ir", L"yendo" };
+        static constexpr size_t ACCENTED_VERB_ENDING_COUNT{ 5 };
+        static constexpr size_t YENDO_INDEX{ 10 };
+
+        // the characters that the suffixes of each step can end with
+        static constexpr character_bitmap STEP_0_ENDINGS{ ATTACHED_PRONOUNS.get_last_characters() };
+        static constexpr character_bitmap STEP_1_ENDINGS{ L"acdelnorstv" };
+        static constexpr character_bitmap STEP_2A_ENDINGS{ L"aenosó" };
+        static constexpr character_bitmap STEP_2B_ENDINGS{ L"adenorsuáéó" };
+        static constexpr character_bitmap STEP_3_ENDINGS{ L"aeosuáéíó" };
+        static constexpr character_bitmap ALL_STEP_ENDINGS{ STEP_0_ENDINGS | STEP_1_ENDINGS |
+            STEP_2A_ENDINGS | STEP_2B_ENDINGS | STEP_3_ENDINGS };
         };
     }
 
@@ -16,6 +16,9 @@
 #include <string_view>
 #include <array>
 #include <cassert>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
 #include "common_lang_constants.h"
 
 /// @brief Namespace for stemming classes.
@@ -116,9 +119,9 @@ namespace stemming
 
     static const wchar_t FINNISH_VOWELS[] = { 97, 101, 105, 111, 117, 121, 0xE4, 0xF6, 65,
         69, 73, 79, 85, 89, 0xC4, 0xD6, 0 };
-    static const wchar_t FINNISH_VOWELS_NO_Y[] = { 97, 101, 105, 111, 117, 0xE4, 0xF6, 65,
+    static constexpr wchar_t FINNISH_VOWELS_NO_Y[] = { 97, 101, 105, 111, 117, 0xE4, 0xF6, 65,
         69, 73, 79, 85, 0xC4, 0xD6, 0 };
-    static const wchar_t FINNISH_VOWELS_SIMPLE[] = { 97, 101, 105, 0xE4, 65, 69, 73, 0xC4, 0 };
+    static constexpr wchar_t FINNISH_VOWELS_SIMPLE[] = { 97, 101, 105, 0xE4, 65, 69, 73, 0xC4, 0 };
     static constexpr wchar_t FINNISH_CONSONANTS[] =
         { L'b', L'c', L'd', L'f', L'g', L'h', L'j', L'k', L'l', L'm', L'n', L'p', L'q', L'r', L's',
           L't', L'v', L'w', L'x', L'z', L'B', L'C', L'D', L'F', L'G', L'H', L'J', L'K', L'L', L'M',
@@ -155,7 +158,7 @@ namespace stemming
         0xF9, 65, 69, 73, 79, 85, 0xC0,
         0xC8, 0xCC, 0xD2,
         0xD9, 0 };
-    static const wchar_t ITALIAN_VOWELS_SIMPLE[] = { 97, 101, 105, 111, 0xE0,
+    static constexpr wchar_t ITALIAN_VOWELS_SIMPLE[] = { 97, 101, 105, 111, 0xE0,
         0xE8, 0xEC, 0xF2,
         65, 69, 73, 79, 0xC0, 0xC8,
         0xCC, 0xD2, 0 };
@@ -185,6 +188,521 @@ namespace stemming
             ch;
         }
 
+    /// @private
+    /// @internal Latin-1 lowercasing table used by tolower_latin1_cyrillic().
+    inline constexpr std::array<wchar_t, 256> LATIN1_LOWER_TABLE = []() constexpr
+        {
+        std::array<wchar_t, 256> table{};
+        for (size_t i = 0; i < table.size(); ++i)
+            {
+            const auto ch = static_cast<wchar_t>(i);
+            table[i] = ((ch >= L'A' && ch <= L'Z') ||
+                        (ch >= 0xC0 && ch <= 0xD6) ||
+                        (ch >= 0xD8 && ch <= 0xDE)) ?
+                static_cast<wchar_t>(ch + 32) : ch;
+            }
+        return table;
+        }();
+
+    /** @returns @c true if @c ch is a Latin-1 character.
+        @details @c wchar_t is signed on some platforms, so this compares the code unit as unsigned
+            (a negative one would otherwise pass a plain @c ch < 256 and index outside of a table).
+        @param ch The character to review.*/
+    [[nodiscard]]
+    inline constexpr bool is_latin1(const wchar_t ch) noexcept
+        { return static_cast<std::make_unsigned_t<wchar_t>>(ch) < 256; }
+
+    /** @brief Lowercases a Latin-1 or Cyrillic letter.
+        @details Latin-1 characters are looked up in a table and Cyrillic
+            letters are converted with range arithmetic; anything else is returned unchanged.
+        @param ch The character to convert.
+        @returns The lowercased character.*/
+    [[nodiscard]]
+    inline constexpr wchar_t tolower_latin1_cyrillic(const wchar_t ch) noexcept
+        {
+        return
+            is_latin1(ch) ? LATIN1_LOWER_TABLE[static_cast<size_t>(ch)] :
+            // А-Я
+            (ch >= 0x0410 && ch <= 0x042F) ? (ch + 0x20) :
+            // Ѐ-Џ (includes Ё)
+            (ch >= 0x0400 && ch <= 0x040F) ? (ch + 0x50) :
+            ch;
+        }
+
+    /** @brief Compile-time set of the characters that a word can end with
+            for a suffix step to do anything.
+        @details Covers Latin-1 (which includes the hash characters) and Cyrillic;
+            any other character is never in the set.\n
+            Letters are added in both cases, so only the lowercased versions
+            of the letters need to be listed.
+        @par Example:
+        @code
+        // step 1a of the English stemmer only removes suffixes ending with 's' or 'd'
+        constexpr character_bitmap STEP_1A_ENDINGS{ L"sd" };
+        static_assert(STEP_1A_ENDINGS.contains(L'S'));
+        @endcode*/
+    class character_bitmap
+        {
+    public:
+        /// @brief Constructor.
+        /// @param chars The (lowercased) characters to include.
+        explicit constexpr character_bitmap(const std::wstring_view chars) noexcept
+            {
+            for (const auto ch : chars)
+                {
+                set(ch);
+                set(to_upper(ch));
+                }
+            }
+
+        /// @brief Constructor.
+        /// @param chars The (lowercased) characters to include.
+        /// @details Useful for including the hash characters.
+        constexpr character_bitmap(const std::initializer_list<wchar_t> chars) noexcept
+            {
+            for (const auto ch : chars)
+                {
+                set(ch);
+                set(to_upper(ch));
+                }
+            }
+
+        /// @returns @c true if @c ch is in the set.
+        /// @param ch The character to look up.
+        [[nodiscard]]
+        constexpr bool contains(const wchar_t ch) const noexcept
+            {
+            const size_t index{ to_index(ch) };
+            return (index < BIT_COUNT) &&
+                (m_bits[index / 64] & (uint64_t{ 1 } << (index % 64))) != 0;
+            }
+
+        /// @returns The union of this set and @c that.
+        /// @param that The set to combine with.
+        [[nodiscard]]
+        constexpr character_bitmap operator|(const character_bitmap& that) const noexcept
+            {
+            character_bitmap combined{ *this };
+            for (size_t i = 0; i < m_bits.size(); ++i)
+                { combined.m_bits[i] |= that.m_bits[i]; }
+            return combined;
+            }
+    private:
+        // Latin-1, followed by the Cyrillic block
+        static constexpr size_t BIT_COUNT{ 512 };
+
+        [[nodiscard]]
+        static constexpr size_t to_index(const wchar_t ch) noexcept
+            {
+            return is_latin1(ch) ? static_cast<size_t>(ch) :
+                (ch >= 0x0400 && ch < 0x0500) ? static_cast<size_t>(ch - 0x0400) + 256 :
+                BIT_COUNT;
+            }
+
+        [[nodiscard]]
+        static constexpr wchar_t to_upper(const wchar_t ch) noexcept
+            {
+            return ((ch >= L'a' && ch <= L'z') ||
+                    (ch >= 0xE0 && ch <= 0xFE && ch != 0xF7) ||
+                    (ch >= 0x0430 && ch <= 0x044F)) ? (ch - 0x20) :
+                (ch >= 0x0450 && ch <= 0x045F) ? (ch - 0x50) :
+                ch;
+            }
+
+        constexpr void set(const wchar_t ch) noexcept
+            {
+            const size_t index{ to_index(ch) };
+            if (index < BIT_COUNT)
+                { m_bits[index / 64] |= (uint64_t{ 1 } << (index % 64)); }
+            }
+
+        std::array<uint64_t, BIT_COUNT / 64> m_bits{};
+        };
+
+    /** @brief Compile-time trie of lowercased strings, used to find which of them
+            a word begins with in one forward walk over the word.
+        @details None of the strings may be the start of another one.
+        @tparam node_countT The number of nodes to allocate, which must be at least the
+            total number of characters in the strings, plus one (for the root).
+        @par Example:
+        @code
+        constexpr prefix_trie<8> PREFIXES{ L"past", L"gen" };
+        static_assert(PREFIXES.match_prefix<false>(std::wstring_view{ L"Pasture" }) == 4);
+        @endcode*/
+    template<size_t node_countT>
+    class prefix_trie
+        {
+    public:
+        /// @brief Constructor.
+        /// @param words The (lowercased) strings to include.
+        consteval prefix_trie(const std::initializer_list<std::wstring_view> words)
+            {
+            for (const auto word : words)
+                {
+                size_t current{ 0 };
+                for (const auto ch : word)
+                    { current = add_child(current, ch); }
+                m_nodes[current].m_word_length = word.length();
+                }
+            }
+
+        /// @returns The length of the string in the trie that @c text begins with,
+        ///     or zero if it doesn't begin with any of them.
+        /// @param text The text to review.
+        /// @tparam is_lowercasedT @c true if @c text is known to be lowercased,
+        ///     which skips lowercasing each character before it is compared.
+        template<bool is_lowercasedT, typename string_typeT>
+        [[nodiscard]]
+        constexpr size_t match_prefix(const string_typeT& text) const noexcept
+            {
+            size_t current{ 0 };
+            for (const auto ch : text)
+                {
+                current = find_child(current,
+                    is_lowercasedT ? static_cast<wchar_t>(ch) : tolower_latin1_cyrillic(ch));
+                if (current == 0)
+                    { return 0; }
+                if (m_nodes[current].m_word_length != 0)
+                    { return m_nodes[current].m_word_length; }
+                }
+            return 0;
+            }
+    private:
+        struct trie_node
+            {
+            wchar_t m_character{ 0 };
+            // the first child and the next sibling; zero (the root) if none
+            size_t m_first_child{ 0 };
+            size_t m_next_sibling{ 0 };
+            // non-zero if a string ends here
+            size_t m_word_length{ 0 };
+            };
+
+        [[nodiscard]]
+        constexpr size_t find_child(const size_t parent, const wchar_t ch) const noexcept
+            {
+            for (size_t child = m_nodes[parent].m_first_child;
+                 child != 0;
+                 child = m_nodes[child].m_next_sibling)
+                {
+                if (m_nodes[child].m_character == ch)
+                    { return child; }
+                }
+            return 0;
+            }
+
+        constexpr size_t add_child(const size_t parent, const wchar_t ch)
+            {
+            if (const size_t existing = find_child(parent, ch); existing != 0)
+                { return existing; }
+            // out of bounds (and thus a compile error) if node_countT is too small
+            trie_node& newNode = m_nodes.at(m_node_count);
+            newNode.m_character = ch;
+            newNode.m_next_sibling = m_nodes[parent].m_first_child;
+            m_nodes[parent].m_first_child = m_node_count;
+            return m_node_count++;
+            }
+
+        std::array<trie_node, node_countT> m_nodes{};
+        size_t m_node_count{ 1 };
+        };
+
+    /** @brief Compile-time trie of lowercased strings, stored back to front, used to find
+            the longest of them that a word (or the start of a word) ends with in one
+            backward walk over the word.
+        @details Unlike prefix_trie, strings may end with other ones (e.g., "selos" and "los").
+        @tparam node_countT The number of nodes to allocate, which must be at least the
+            total number of characters in the strings, plus one (for the root).
+        @par Example:
+        @code
+        constexpr suffix_trie<6> PRONOUNS{ L"los", L"selos" };
+        static_assert(PRONOUNS.match_suffix<false>(std::wstring_view{ L"DÁNDOSELOS" }, 10, 0).m_length == 5);
+        // only the pronouns that start in the region (here, the last four letters) are matched
+        static_assert(PRONOUNS.match_suffix<false>(std::wstring_view{ L"dándoselos" }, 10, 6).m_length == 3);
+        @endcode*/
+    template<size_t node_countT>
+    class suffix_trie
+        {
+    public:
+        /// @brief The string that was matched.
+        struct match
+            {
+            /// The length of the string, or zero if none matched.
+            size_t m_length{ 0 };
+            /// The string's position in the list passed to the constructor.
+            size_t m_index{ 0 };
+            };
+
+        /// @brief Constructor.
+        /// @param words The (lowercased) strings to include.
+        consteval suffix_trie(const std::initializer_list<std::wstring_view> words)
+            {
+            size_t index{ 0 };
+            for (const auto word : words)
+                {
+                size_t current{ 0 };
+                for (auto ch = word.crbegin(); ch != word.crend(); ++ch)
+                    { current = add_child(current, *ch); }
+                m_nodes[current].m_word_length = word.length();
+                m_nodes[current].m_word_index = index++;
+                }
+            }
+
+        /// @returns The longest string in the trie that the first @c end characters
+        ///     of @c text end with and that begins at or after @c region_start
+        ///     (e.g., RV), or a zero-length match if there isn't one.
+        /// @param text The text to review.
+        /// @param end The number of characters at the start of @c text to review.
+        /// @param region_start The earliest position that a match can start at.
+        /// @tparam is_lowercasedT @c true if @c text is known to be lowercased,
+        ///     which skips lowercasing each character before it is compared.
+        template<bool is_lowercasedT, typename string_typeT>
+        [[nodiscard]]
+        constexpr match match_suffix(const string_typeT& text, const size_t end,
+                                     const size_t region_start) const noexcept
+            {
+            match longest;
+            size_t current{ 0 };
+            for (size_t i = end; i > region_start; --i)
+                {
+                current = find_child(current,
+                    is_lowercasedT ? static_cast<wchar_t>(text[i - 1]) : tolower_latin1_cyrillic(text[i - 1]));
+                if (current == 0)
+                    { break; }
+                if (m_nodes[current].m_word_length != 0)
+                    { longest = { m_nodes[current].m_word_length, m_nodes[current].m_word_index }; }
+                }
+            return longest;
+            }
+
+        /// @returns The characters that the strings end with (in both cases), so that
+        ///     a step that searches the trie can skip words that can't match.
+        [[nodiscard]]
+        constexpr character_bitmap get_last_characters() const noexcept
+            {
+            // the strings are stored back to front, so these are the root's children
+            std::array<wchar_t, node_countT> lastCharacters{};
+            size_t count{ 0 };
+            for (size_t child = m_nodes[0].m_first_child;
+                 child != 0;
+                 child = m_nodes[child].m_next_sibling)
+                { lastCharacters[count++] = m_nodes[child].m_character; }
+            return character_bitmap{ std::wstring_view{ lastCharacters.data(), count } };
+            }
+    private:
+        struct trie_node
+            {
+            wchar_t m_character{ 0 };
+            // the first child and the next sibling; zero (the root) if none
+            size_t m_first_child{ 0 };
+            size_t m_next_sibling{ 0 };
+            // non-zero if a string ends here
+            size_t m_word_length{ 0 };
+            size_t m_word_index{ 0 };
+            };
+
+        [[nodiscard]]
+        constexpr size_t find_child(const size_t parent, const wchar_t ch) const noexcept
+            {
+            for (size_t child = m_nodes[parent].m_first_child;
+                 child != 0;
+                 child = m_nodes[child].m_next_sibling)
+                {
+                if (m_nodes[child].m_character == ch)
+                    { return child; }
+                }
+            return 0;
+            }
+
+        constexpr size_t add_child(const size_t parent, const wchar_t ch)
+            {
+            if (const size_t existing = find_child(parent, ch); existing != 0)
+                { return existing; }
+            // out of bounds (and thus a compile error) if node_countT is too small
+            trie_node& newNode = m_nodes.at(m_node_count);
+            newNode.m_character = ch;
+            newNode.m_next_sibling = m_nodes[parent].m_first_child;
+            m_nodes[parent].m_first_child = m_node_count;
+            return m_node_count++;
+            }
+
+        std::array<trie_node, node_countT> m_nodes{};
+        size_t m_node_count{ 1 };
+        };
+
+    /** @brief A suffix of up to eight lowercased ASCII letters, packed into an integer
+            (with its last letter in the lowest byte).
+        @details This is built at compile time from a string literal, so comparing it
+            against a packed_tail is just a mask and a comparison.
+        @sa packed_tail.*/
+    class packed_suffix
+        {
+    public:
+        /// @brief Constructor.
+        /// @param suffix The (lowercased) suffix.
+        /// @note This is implicit so that string literals can be passed to packed_tail::ends_with().
+        template<size_t N>
+        consteval packed_suffix(const char (&suffix)[N]) noexcept
+            {
+            static_assert(N >= 2 && N <= 9, "Packed suffixes must be one to eight characters.");
+            for (size_t i = 0; i < N - 1; ++i)
+                {
+                m_value |= static_cast<uint64_t>(static_cast<unsigned char>(suffix[N - 2 - i])) << (8 * i);
+                }
+            m_mask = (N == 9) ? ~uint64_t{ 0 } : ((uint64_t{ 1 } << (8 * (N - 1))) - 1);
+            }
+
+        /// @returns The packed letters.
+        [[nodiscard]]
+        constexpr uint64_t get_value() const noexcept
+            { return m_value; }
+
+        /// @returns The mask covering the suffix's bytes.
+        [[nodiscard]]
+        constexpr uint64_t get_mask() const noexcept
+            { return m_mask; }
+    private:
+        uint64_t m_value{ 0 };
+        uint64_t m_mask{ 0 };
+        };
+
+    /** @brief The last eight characters of a word, lowercased and packed into an integer
+            (with the last character in the lowest byte), so that a suffix of up to eight
+            letters can be checked with one comparison.
+        @details Characters which aren't ASCII are packed as zero, so they never match a suffix.
+        @par Example:
+        @code
+        const auto tail = packed_tail::pack<false>(std::wstring{ L"RELATIONAL" });
+        tail.ends_with("ational"); // true
+        @endcode*/
+    class packed_tail
+        {
+    public:
+        /// @returns The packed end of @c text.
+        /// @param text The word to pack.
+        /// @tparam is_asciiT @c true if @c text is known to only have ASCII characters,
+        ///     which removes the check for non-ASCII characters.
+        template<bool is_asciiT, typename string_typeT>
+        [[nodiscard]]
+        static constexpr packed_tail pack(const string_typeT& text) noexcept
+            {
+            packed_tail tail;
+            const size_t length = std::min<size_t>(text.length(), 8);
+            for (size_t i = 0; i < length; ++i)
+                {
+                const auto ch = static_cast<uint32_t>(text[text.length() - 1 - i]);
+                // setting the 0x20 bit lowercases an ASCII letter and can't turn anything else into one
+                const uint64_t packedChar = (is_asciiT || ch < 0x80) ? (ch | 0x20) : 0;
+                tail.m_value |= packedChar << (8 * i);
+                }
+            return tail;
+            }
+
+        /// @returns @c true if the packed word ends with @c suffix.
+        /// @param suffix The suffix to compare against.
+        [[nodiscard]]
+        constexpr bool ends_with(const packed_suffix& suffix) const noexcept
+            { return (m_value & suffix.get_mask()) == suffix.get_value(); }
+    private:
+        uint64_t m_value{ 0 };
+        };
+
+    /** @brief The default stemming policy.
+        @details Stemming is case insensitive and the case of the
+            original text is preserved in the stem.\n
+            To write a custom policy, derive from this class and
+            redeclare the flags that should be different.
+        @sa lowercase_stem_policy, prenormalized_stem_policy.*/
+    struct default_stem_policy
+        {
+        /// @brief Whether text is lowercased when it enters the stemmer,
+        ///     which lets the suffix functions compare against only
+        ///     the lowercased version of a letter.
+        static constexpr bool fold_case{ false };
+        /// @brief Whether the caller guarantees that text is already lowercased.
+        /// @details Suffixes are compared against only the lowercased version of a letter
+        ///     (like @c fold_case), but the text is not lowercased by the stemmer.
+        /// @warning Uppercased letters in the text will not be stemmed correctly.
+        static constexpr bool assume_lowercase{ false };
+        /// @brief Whether the caller guarantees that text has no full-width characters,
+        ///     which removes the full-width to narrow conversion.
+        static constexpr bool assume_no_fullwidth{ false };
+        /// @brief Whether the removal of trailing apostrophes and possessive "'s" is skipped.
+        static constexpr bool skip_possessive{ false };
+        /// @brief Whether the removal of leading elisions (e.g., "l'" and "qu'" in French) is skipped.
+        static constexpr bool skip_elisions{ false };
+        /// @brief Whether only inflectional endings (e.g., plurals and common verb endings)
+        ///     are removed, instead of running the full algorithm.
+        /// @sa light_stem_policy.
+        static constexpr bool light_stemming{ false };
+        /// @brief Whether each step's entries, matches, and cycles are recorded
+        ///     into thread_statistics().
+        /// @details Only set this by deriving from statistics_stem_policy
+        ///     (from "stemming_statistics.h"), which provides the recording.
+        static constexpr bool collect_statistics{ false };
+        /// @brief Whether each step runs even if the word doesn't end with
+        ///     a letter that any of the step's suffixes end with.
+        /// @details This only makes stemming slower; it is meant for testing that
+        ///     each step's set of final letters covers all of its suffixes.
+        static constexpr bool skip_ending_checks{ false };
+        };
+
+    /** @brief Policy that lowercases text once when it enters the stemmer.
+        @details This removes the upper/lowercase comparisons from the suffix checks
+            and the stem is returned lowercased.
+        @par Example:
+        @code
+        stemming::english_stem<std::wstring, stemming::lowercase_stem_policy> StemEnglish;
+        std::wstring word(L"Documentation");
+        StemEnglish(word); // word is now "document"
+        @endcode*/
+    struct lowercase_stem_policy : public default_stem_policy
+        {
+        /// @brief Text is lowercased on entry.
+        static constexpr bool fold_case{ true };
+        };
+
+    /** @brief Policy for text that a tokenizer has already normalized.
+        @details The text is assumed to be lowercased, without full-width characters,
+            possessives, or elisions; the passes which handle those are removed
+            from the stemmers at compile time.
+        @par Example:
+        @code
+        stemming::french_stem<std::wstring, stemming::prenormalized_stem_policy> StemFrench;
+        std::wstring word(L"continuellement");
+        StemFrench(word); // word is now "continuel"
+        @endcode*/
+    struct prenormalized_stem_policy : public default_stem_policy
+        {
+        /// @brief Text is already lowercased.
+        static constexpr bool assume_lowercase{ true };
+        /// @brief Text does not have full-width characters.
+        static constexpr bool assume_no_fullwidth{ true };
+        /// @brief Possessives are already removed.
+        static constexpr bool skip_possessive{ true };
+        /// @brief Elisions are already removed.
+        static constexpr bool skip_elisions{ true };
+        };
+
+    /** @brief Policy that only removes inflectional endings, such as plurals
+            and common verb endings.
+        @details Each stemmer runs just its inflectional steps (e.g., steps 1a-1c in English,
+            steps 1 and 2 in German, and step 1 plus the residual suffixes in the Romance languages)
+            and skips the derivational ones. This skips work that the full algorithm does,
+            but conflates fewer forms of a word; it is meant for workloads such as
+            query-time autocompletion and near-duplicate detection.
+        @par Example:
+        @code
+        stemming::english_stem<std::wstring, stemming::light_stem_policy> StemEnglish;
+        std::wstring word(L"connections");
+        StemEnglish(word); // word is now "connection"
+        @endcode*/
+    struct light_stem_policy : public default_stem_policy
+        {
+        /// @brief Only inflectional endings are removed.
+        static constexpr bool light_stemming{ true };
+        };
+
     /** @brief The base class for language-specific stemmers.
         @details The template argument for the stemmers are the type
         of `std::basic_string` that you are trying to stem,
@@ -201,13 +719,21 @@ namespace stemming
         stemming::english_stem<myString> StemEnglish;
         StemEnglish(word);
         @endcode
+
+        The second template argument is the stemming policy
+        (e.g., @c lowercase_stem_policy), which is @c default_stem_policy by default.
     */
-    template <typename string_typeT = std::wstring>
+    template <typename string_typeT = std::wstring, typename policyT = default_stem_policy>
     class stem
         {
     public:
         /// @brief The string type that this class will accept.
         using string_type = string_typeT;
+        /// @brief The stemming policy that this class uses.
+        using policy_type = policyT;
+        /// @brief A view of the string type that this class accepts.
+        using string_view_type = std::basic_string_view<typename string_typeT::value_type,
+                                                        typename string_typeT::traits_type>;
         /// @brief The main interface for stemming a word.
         /// @param[in,out] text The text to stem.
         virtual void operator()(string_typeT& text) = 0;
@@ -294,7 +820,7 @@ namespace stemming
                 return;
                 }
             // if second letter is a consonant
-            if (!stem<string_typeT>::is_one_of(text[1], vowel_list) )
+            if (!stem<string_typeT, policyT>::is_one_of(text[1], vowel_list) )
                 {
                 const size_t start = text.find_first_of(vowel_list, 2);
                 if (start == string_typeT::npos)
@@ -309,8 +835,8 @@ namespace stemming
                     }
                 }
             // if first two letters are vowels
-            else if (stem<string_typeT>::is_one_of(text[0], vowel_list) &&
-                     stem<string_typeT>::is_one_of(text[1], vowel_list))
+            else if (stem<string_typeT, policyT>::is_one_of(text[0], vowel_list) &&
+                     stem<string_typeT, policyT>::is_one_of(text[1], vowel_list))
                 {
                 const size_t start = text.find_first_not_of(vowel_list, 2);
                 if (start == string_typeT::npos)
@@ -325,8 +851,8 @@ namespace stemming
                     }
                 }
             // consonant/vowel at beginning
-            else if (!stem<string_typeT>::is_one_of(text[0], vowel_list) &&
-                     stem<string_typeT>::is_one_of(text[1], vowel_list))
+            else if (!stem<string_typeT, policyT>::is_one_of(text[0], vowel_list) &&
+                     stem<string_typeT, policyT>::is_one_of(text[1], vowel_list))
                 {
                 m_rv = 3;
                 }
@@ -336,6 +862,43 @@ namespace stemming
                 }
             }
 
+        /** @returns @c true if @c text begins with par, col, tap, or ni[vowel],
+                which RV (French stemmer) always goes right after.
+            @param text The string to review.
+            @param vowel_list The list of vowels by the stemmer's language.*/
+        [[nodiscard]]
+        bool has_french_rv_prefix(const string_typeT& text,
+                                  const wchar_t* vowel_list) const
+            {
+            return (text.length() >= 3 &&
+                ((stem<string_typeT, policyT>::is_either_case(text[0], common_lang_constants::LOWER_P,
+                                                common_lang_constants::UPPER_P) &&
+                stem<string_typeT, policyT>::is_either_case(text[1], common_lang_constants::LOWER_A,
+                                              common_lang_constants::UPPER_A) &&
+                stem<string_typeT, policyT>::is_either_case(text[2], common_lang_constants::LOWER_R,
+                                              common_lang_constants::UPPER_R)) || // par
+
+                (stem<string_typeT, policyT>::is_either_case(text[0], common_lang_constants::LOWER_C,
+                                               common_lang_constants::UPPER_C) &&
+                stem<string_typeT, policyT>::is_either_case(text[1], common_lang_constants::LOWER_O,
+                                              common_lang_constants::UPPER_O) &&
+                stem<string_typeT, policyT>::is_either_case(text[2], common_lang_constants::LOWER_L,
+                                              common_lang_constants::UPPER_L)) || // col
+
+                (stem<string_typeT, policyT>::is_either_case(text[0], common_lang_constants::LOWER_T,
+                                               common_lang_constants::UPPER_T) &&
+                stem<string_typeT, policyT>::is_either_case(text[1], common_lang_constants::LOWER_A,
+                                              common_lang_constants::UPPER_A) &&
+                stem<string_typeT, policyT>::is_either_case(text[2], common_lang_constants::LOWER_P,
+                                              common_lang_constants::UPPER_P)) || // tap
+
+                (stem<string_typeT, policyT>::is_either_case(text[0], common_lang_constants::LOWER_N,
+                                               common_lang_constants::UPPER_N) &&
+                 stem<string_typeT, policyT>::is_either_case(text[1], common_lang_constants::LOWER_I,
+                                              common_lang_constants::UPPER_I) &&
+                 stem<string_typeT, policyT>::is_one_of(text[2], vowel_list)))); // ni[vowel]
+            }
+
         /* @brief Finds the start of RV (French stemmer).
            @param text The string to review.
            @param vowel_list The list of vowels by the stemmer's language.
@@ -355,41 +918,14 @@ namespace stemming
                 }
             /* Exceptions: If the word begins with these then RV goes right after them,
                whether it be a letter or simply the end of the word.*/
-            if (text.length() >= 3 &&
-                ((stem<string_typeT>::is_either(text[0], common_lang_constants::LOWER_P,
-                                                common_lang_constants::UPPER_P) &&
-                stem<string_typeT>::is_either(text[1], common_lang_constants::LOWER_A,
-                                              common_lang_constants::UPPER_A) &&
-                stem<string_typeT>::is_either(text[2], common_lang_constants::LOWER_R,
-                                              common_lang_constants::UPPER_R)) || // par
-
-                (stem<string_typeT>::is_either(text[0], common_lang_constants::LOWER_C,
-                                               common_lang_constants::UPPER_C) &&
-                stem<string_typeT>::is_either(text[1], common_lang_constants::LOWER_O,
-                                              common_lang_constants::UPPER_O) &&
-                stem<string_typeT>::is_either(text[2], common_lang_constants::LOWER_L,
-                                              common_lang_constants::UPPER_L)) || // col
-
-                (stem<string_typeT>::is_either(text[0], common_lang_constants::LOWER_T,
-                                               common_lang_constants::UPPER_T) &&
-                stem<string_typeT>::is_either(text[1], common_lang_constants::LOWER_A,
-                                              common_lang_constants::UPPER_A) &&
-                stem<string_typeT>::is_either(text[2], common_lang_constants::LOWER_P,
-                                              common_lang_constants::UPPER_P)) ||
-
-                (stem<string_typeT>::is_either(text[0], common_lang_constants::LOWER_N,
-                                               common_lang_constants::UPPER_N) &&
-                 stem<string_typeT>::is_either(text[1], common_lang_constants::LOWER_I,
-                                              common_lang_constants::UPPER_I) &&
-                 stem<string_typeT>::is_one_of(text[2], vowel_list))) // ni[vowel]
-                )
+            if (has_french_rv_prefix(text, vowel_list))
                 {
                 m_rv = 3;
                 return;
                 }
             // if first two letters are vowels
-            if (stem<string_typeT>::is_one_of(text[0], vowel_list) &&
-                stem<string_typeT>::is_one_of(text[1], vowel_list))
+            if (stem<string_typeT, policyT>::is_one_of(text[0], vowel_list) &&
+                stem<string_typeT, policyT>::is_one_of(text[1], vowel_list))
                 {
                 m_rv = 3;
                 }
@@ -456,10 +992,197 @@ namespace stemming
                 true : false;
             }
 
+        /** @brief Converts full-width characters to their narrow versions and,
+                if the policy folds case, lowercases the text (all in one pass).
+            @details Either conversion is removed if the policy assumes that the
+                text is already in that form.
+            @param[in,out] text The string to normalize.*/
+        void normalize_input(string_typeT& text) const
+            {
+            constexpr bool lowercase_text{ policyT::fold_case && !policyT::assume_lowercase };
+            if constexpr (lowercase_text && !policyT::assume_no_fullwidth)
+                {
+                std::transform(text.cbegin(), text.cend(), text.begin(),
+                    [](const auto& ch) noexcept
+                    { return tolower_latin1_cyrillic(full_width_to_narrow(ch)); });
+                }
+            else if constexpr (lowercase_text)
+                { std::transform(text.cbegin(), text.cend(), text.begin(), tolower_latin1_cyrillic); }
+            else if constexpr (!policyT::assume_no_fullwidth)
+                { std::transform(text.cbegin(), text.cend(), text.begin(), full_width_to_narrow); }
+            }
+
+        /// @brief An empty stand-in for a step recorder, used when the policy does not collect statistics.
+        struct no_step_recorder
+            {};
+
+        /** @brief Starts recording a run of a step, if the policy collects statistics.
+            @details Call this at the top of the step and keep the result until the step returns:
+                @code
+                [[maybe_unused]] const auto recorder =
+                    stem<string_typeT, policyT>::record_step(text, "english::step_1a");
+                @endcode
+                With policies that don't collect statistics, this compiles away to nothing.
+            @param text The word being stemmed.
+            @param name The step's name.
+            @returns The recorder, which records the step when it is destroyed.*/
+        [[nodiscard]]
+        static auto record_step([[maybe_unused]] const string_typeT& text,
+                                [[maybe_unused]] const std::string_view name)
+            {
+            if constexpr (policyT::collect_statistics)
+                { return policyT::template record_step<string_typeT>(text, name); }
+            else
+                { return no_step_recorder{}; }
+            }
+
+        /// @brief Counts a named event (e.g., a branch within a step), if the policy collects statistics.
+        /// @param name The event's name.
+        static void record_event([[maybe_unused]] const std::string_view name)
+            {
+            if constexpr (policyT::collect_statistics)
+                { policyT::record_event(name); }
+            }
+
+        /** @brief Counts a suffix comparison for the current step, if the policy collects statistics.
+            @details The suffix functions (e.g., is_suffix() and delete_if_is_in_r1()) call this,
+                so that the order and hit rate of each step's suffix chain can be profiled.
+            @param text The word being stemmed.
+            @param suffix The lowercased letters of the suffix being compared.*/
+        static void record_suffix_test([[maybe_unused]] const string_typeT& text,
+                                       [[maybe_unused]] const std::initializer_list<wchar_t> suffix)
+            {
+            if constexpr (policyT::collect_statistics)
+                {
+                bool matched{ text.length() >= suffix.size() };
+                for (size_t i = 0; matched && i < suffix.size(); ++i)
+                    {
+                    const wchar_t ch = text[text.length() - suffix.size() + i];
+                    matched = (ch == suffix.begin()[i] || tolower_latin1_cyrillic(ch) == suffix.begin()[i]);
+                    }
+                policyT::template record_suffix_test<string_typeT>(
+                    std::wstring_view{ suffix.begin(), suffix.size() }, matched);
+                }
+            }
+
+        /// @returns @c true if the policy guarantees that text is lowercased
+        ///     by the time that the suffixes are compared.
+        [[nodiscard]]
+        static constexpr bool is_lowercased_text() noexcept
+            { return (policyT::fold_case || policyT::assume_lowercase); }
+
+        /** @brief Determines if a word ends with one of the characters that a
+                suffix step needs, which lets the step be skipped in O(1) if not.
+            @param text The string to review.
+            @param endings The characters that the step's suffixes can end with.
+            @returns @c true if the last character of @c text is in @c endings
+                (or if the policy skips this check).*/
+        [[nodiscard]]
+        static constexpr bool is_last_char_in(const string_typeT& text,
+                                              const character_bitmap& endings) noexcept
+            {
+            if constexpr (policyT::skip_ending_checks)
+                { return !text.empty(); }
+            else
+                { return !text.empty() && endings.contains(text.back()); }
+            }
+
+        /** @brief Determines if a string only has ASCII characters.
+            @details The characters are OR'ed together and checked once at the end,
+                which compilers can vectorize.
+            @param text The string to review.
+            @returns @c true if @c text is all ASCII.*/
+        [[nodiscard]]
+        static constexpr bool is_ascii(const string_typeT& text) noexcept
+            {
+            uint32_t combined{ 0 };
+            for (const auto ch : text)
+                { combined |= static_cast<uint32_t>(ch); }
+            return combined < 0x80;
+            }
+
+        /** @brief Determines which of a set of prefixes a word begins with.
+            @param text The string to review.
+            @param prefixes The prefixes to look for.
+            @returns The length of the prefix that @c text begins with,
+                or zero if it doesn't begin with any of them.*/
+        template<size_t node_countT>
+        [[nodiscard]]
+        static constexpr size_t find_prefix(const string_typeT& text,
+                                            const prefix_trie<node_countT>& prefixes) noexcept
+            { return prefixes.template match_prefix<is_lowercased_text()>(text); }
+
+        /// @brief A pronoun attached to the end of a verb (Spanish and Italian stemmers).
+        struct attached_pronoun
+            {
+            /// The length of the pronoun, or zero if there isn't one.
+            size_t m_pronoun_length{ 0 };
+            /// The length of the verb ending in front of the pronoun, or zero if there isn't one.
+            size_t m_verb_ending_length{ 0 };
+            /// The verb ending's position in its trie's list.
+            size_t m_verb_ending_index{ 0 };
+            };
+
+        /** @brief Finds the longest pronoun attached to the end of a word and the verb ending
+                (e.g., a gerund or infinitive) in front of it, in one backward walk over the word.
+            @param text The string to review.
+            @param pronouns The pronouns to look for.
+            @param verb_endings The verb endings that the pronoun must follow,
+                which must be in RV.
+            @param pronoun_region_start The earliest position the pronoun can start at
+                (e.g., RV, or zero if it can be anywhere).
+            @returns The pronoun and verb ending that were found.\n
+                The pronoun is still returned if it doesn't follow any of the verb endings.*/
+        template<size_t pronoun_node_countT, size_t verb_ending_node_countT>
+        [[nodiscard]]
+        attached_pronoun find_attached_pronoun(const string_typeT& text,
+                                               const suffix_trie<pronoun_node_countT>& pronouns,
+                                               const suffix_trie<verb_ending_node_countT>& verb_endings,
+                                               const size_t pronoun_region_start) const noexcept
+            {
+            const auto pronoun =
+                pronouns.template match_suffix<is_lowercased_text()>(text, text.length(), pronoun_region_start);
+            if (pronoun.m_length == 0)
+                { return {}; }
+            const auto verb_ending = verb_endings.template match_suffix<is_lowercased_text()>(
+                text, text.length() - pronoun.m_length, get_rv());
+            return { pronoun.m_length, verb_ending.m_length, verb_ending.m_index };
+            }
+
+        /** @brief Finds the longest suffix in R1 from a table of suffix classes
+                and deletes it if it is in the first class.
+            @details This is the main suffix step of the Scandinavian stemmers, where
+                most suffixes are simply deleted and a few (e.g., an "s" that must follow
+                a valid letter) need a check of their own.
+            @param[in,out] text The string to stem.
+            @param suffixes The suffixes to look for. The ones that are simply deleted
+                must come first, followed by the ones that the caller handles.
+            @param delete_count The number of suffixes at the start of @c suffixes
+                that are deleted.
+            @returns The suffix that was found (a zero-length match if none are in R1).\n
+                Compare its index against @c delete_count to see if it was deleted.*/
+        template<size_t node_countT>
+        typename suffix_trie<node_countT>::match
+            delete_longest_suffix_in_r1(string_typeT& text, const suffix_trie<node_countT>& suffixes,
+                                        const size_t delete_count)
+            {
+            const auto suffix =
+                suffixes.template match_suffix<is_lowercased_text()>(text, text.length(), get_r1());
+            if (suffix.m_length != 0 && suffix.m_index < delete_count)
+                {
+                text.erase(text.length() - suffix.m_length);
+                update_r_sections(text);
+                }
+            return suffix;
+            }
+
         /// @brief Removes possessive suffix (apostrophe and "'s") from the end of a string.
+        /// @details This is a no-op if the policy skips possessives.
         /// @param[in,out] text The string to trim.
         void remove_possessive_suffix(string_typeT& text) const
             {
+            if constexpr (policyT::skip_possessive)
+                { return; }
             // handle trash like "there's'"
             while (text.length() >= 1 &&
                 is_apostrophe(text.back()))
@@ -469,7 +1192,7 @@ namespace stemming
 
             if (text.length() >= 2 &&
                 is_apostrophe(text[text.length()-2]) &&
-                stem<string_typeT>::is_either(text.back(), common_lang_constants::LOWER_S,
+                stem<string_typeT, policyT>::is_either_case(text.back(), common_lang_constants::LOWER_S,
                                                            common_lang_constants::UPPER_S) )
                 { text.erase(text.length()-2); }
 
@@ -489,9 +1212,10 @@ namespace stemming
         inline static bool is_suffix(const string_typeT& text,
                     const wchar_t suffix1L, const wchar_t suffix1U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L });
             if (text.length() < 1)
                 { return false; }
-            return stem<string_typeT>::is_either(text[text.length()-1], suffix1L, suffix1U);
+            return stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix1L, suffix1U);
             }
         /// @brief is_suffix for two characters.
         /// @param text The string being reviewed.
@@ -505,10 +1229,11 @@ namespace stemming
                     const wchar_t suffix1L, const wchar_t suffix1U,
                     const wchar_t suffix2L, const wchar_t suffix2U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L });
             if (text.length() < 2)
                 { return false; }
-            return stem<string_typeT>::is_either(text[text.length()-2], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix2L, suffix2U);
+            return stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix2L, suffix2U);
             }
 
         /// @brief is_suffix for three characters.
@@ -526,11 +1251,12 @@ namespace stemming
                     const wchar_t suffix2L, const wchar_t suffix2U,
                     const wchar_t suffix3L, const wchar_t suffix3U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L });
             if (text.length() < 3)
                 { return false; }
-            return stem<string_typeT>::is_either(text[text.length()-3], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix3L, suffix3U);
+            return stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix3L, suffix3U);
             }
         /// @brief is_suffix for four characters.
         /// @param text The string being reviewed.
@@ -550,12 +1276,13 @@ namespace stemming
                     const wchar_t suffix3L, const wchar_t suffix3U,
                     const wchar_t suffix4L, const wchar_t suffix4U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L });
             if (text.length() < 4)
                 { return false; }
-            return stem<string_typeT>::is_either(text[text.length()-4], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix3L, suffix3U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix4L, suffix4U);
+            return stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix3L, suffix3U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix4L, suffix4U);
             }
         /// @brief is_suffix for five characters.
         /// @param text The string being reviewed.
@@ -578,13 +1305,15 @@ namespace stemming
                     const wchar_t suffix4L, const wchar_t suffix4U,
                     const wchar_t suffix5L, const wchar_t suffix5U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L });
             if (text.length() < 5)
                 { return false; }
-            return stem<string_typeT>::is_either(text[text.length()-5], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-4], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], suffix3L, suffix3U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix4L, suffix4U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix5L, suffix5U);
+            return stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix3L, suffix3U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix4L, suffix4U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix5L, suffix5U);
             }
         /// @brief is_suffix for six characters.
         /// @param text The string being reviewed.
@@ -610,14 +1339,16 @@ namespace stemming
                     const wchar_t suffix5L, const wchar_t suffix5U,
                     const wchar_t suffix6L, const wchar_t suffix6U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L, suffix6L });
             if (text.length() < 6)
                 { return false; }
-            return stem<string_typeT>::is_either(text[text.length()-6], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-5], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-4], suffix3L, suffix3U) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], suffix4L, suffix4U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix5L, suffix5U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix6L, suffix6U);
+            return stem<string_typeT, policyT>::is_either_case(text[text.length()-6], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix3L, suffix3U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix4L, suffix4U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix5L, suffix5U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix6L, suffix6U);
             }
         /// @brief is_suffix for seven characters.
         /// @param text The string being reviewed.
@@ -646,15 +1377,17 @@ namespace stemming
                     const wchar_t suffix6L, const wchar_t suffix6U,
                     const wchar_t suffix7L, const wchar_t suffix7U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L, suffix6L, suffix7L });
             if (text.length() < 7)
                 { return false; }
-            return stem<string_typeT>::is_either(text[text.length()-7], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-6], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-5], suffix3L, suffix3U) &&
-                    stem<string_typeT>::is_either(text[text.length()-4], suffix4L, suffix4U) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], suffix5L, suffix5U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix6L, suffix6U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix7L, suffix7U);
+            return stem<string_typeT, policyT>::is_either_case(text[text.length()-7], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-6], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix3L, suffix3U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix4L, suffix4U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix5L, suffix5U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix6L, suffix6U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix7L, suffix7U);
             }
         /// @brief is_suffix for eight characters.
         /// @param text The string being reviewed.
@@ -686,16 +1419,18 @@ namespace stemming
                     const wchar_t suffix7L, const wchar_t suffix7U,
                     const wchar_t suffix8L, const wchar_t suffix8U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L, suffix6L, suffix7L, suffix8L });
             if (text.length() < 8)
                 { return false; }
-            return stem<string_typeT>::is_either(text[text.length()-8], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-7], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-6], suffix3L, suffix3U) &&
-                    stem<string_typeT>::is_either(text[text.length()-5], suffix4L, suffix4U) &&
-                    stem<string_typeT>::is_either(text[text.length()-4], suffix5L, suffix5U) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], suffix6L, suffix6U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix7L, suffix7U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix8L, suffix8U);
+            return stem<string_typeT, policyT>::is_either_case(text[text.length()-8], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-7], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-6], suffix3L, suffix3U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix4L, suffix4U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix5L, suffix5U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix6L, suffix6U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix7L, suffix7U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix8L, suffix8U);
             }
         /// @brief is_suffix for nine characters.
         /// @param text The string being reviewed.
@@ -730,17 +1465,20 @@ namespace stemming
                     const wchar_t suffix8L, const wchar_t suffix8U,
                     const wchar_t suffix9L, const wchar_t suffix9U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L, suffix6L, suffix7L, suffix8L,
+                                                                    suffix9L });
             if (text.length() < 9)
                 { return false; }
-            return stem<string_typeT>::is_either(text[text.length()-9], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-8], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-7], suffix3L, suffix3U) &&
-                    stem<string_typeT>::is_either(text[text.length()-6], suffix4L, suffix4U) &&
-                    stem<string_typeT>::is_either(text[text.length()-5], suffix5L, suffix5U) &&
-                    stem<string_typeT>::is_either(text[text.length()-4], suffix6L, suffix6U) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], suffix7L, suffix7U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix8L, suffix8U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix9L, suffix9U);
+            return stem<string_typeT, policyT>::is_either_case(text[text.length()-9], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-8], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-7], suffix3L, suffix3U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-6], suffix4L, suffix4U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix5L, suffix5U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix6L, suffix6U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix7L, suffix7U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix8L, suffix8U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix9L, suffix9U);
             }
 
         /// @brief Comparison for two characters.
@@ -759,8 +1497,8 @@ namespace stemming
             {
             if ((start_index+2) >= text.length())
                 { return false; }
-            return (stem<string_typeT>::is_either(text[start_index], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[start_index+1], suffix2L, suffix2U));
+            return (stem<string_typeT, policyT>::is_either_case(text[start_index], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[start_index+1], suffix2L, suffix2U));
             }
         /// @brief Comparison for three characters.
         /// @param text The string being reviewed.
@@ -781,9 +1519,9 @@ namespace stemming
             {
             if ((start_index+3) >= text.length())
                 { return false; }
-            return (stem<string_typeT>::is_either(text[start_index], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[start_index+1], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[start_index+2], suffix3L, suffix3U));
+            return (stem<string_typeT, policyT>::is_either_case(text[start_index], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[start_index+1], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[start_index+2], suffix3L, suffix3U));
             }
 
         // RV suffix functions
@@ -797,9 +1535,10 @@ namespace stemming
         inline bool is_suffix_in_rv(const string_typeT& text,
                     const wchar_t suffix1L, const wchar_t suffix1U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L });
             if (text.length() < 1)
                 { return false; }
-            return (stem<string_typeT>::is_either(text[text.length()-1], suffix1L, suffix1U) &&
+            return (stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix1L, suffix1U) &&
                     (get_rv() <= text.length()-1) );
             }
         /// @brief RV suffix comparison for two characters.
@@ -814,10 +1553,11 @@ namespace stemming
                     const wchar_t suffix1L, const wchar_t suffix1U,
                     const wchar_t suffix2L, const wchar_t suffix2U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L });
             if (text.length() < 2)
                 { return false; }
-            return ((stem<string_typeT>::is_either(text[text.length()-2], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix2L, suffix2U) ) &&
+            return ((stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix2L, suffix2U) ) &&
                     (get_rv() <= text.length()-2) );
             }
         /// @brief RV suffix comparison for three characters.
@@ -835,11 +1575,12 @@ namespace stemming
                     const wchar_t suffix2L, const wchar_t suffix2U,
                     const wchar_t suffix3L, const wchar_t suffix3U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L });
             if (text.length() < 3)
                 { return false; }
-            return ((stem<string_typeT>::is_either(text[text.length()-3], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix3L, suffix3U) ) &&
+            return ((stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix3L, suffix3U) ) &&
                     (get_rv() <= text.length()-3) );
             }
         /// @brief RV suffix comparison for four characters.
@@ -860,12 +1601,13 @@ namespace stemming
                     const wchar_t suffix3L, const wchar_t suffix3U,
                     const wchar_t suffix4L, const wchar_t suffix4U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L });
             if (text.length() < 4)
                 { return false; }
-            return ((stem<string_typeT>::is_either(text[text.length()-4], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix3L, suffix3U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix4L, suffix4U) ) &&
+            return ((stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix3L, suffix3U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix4L, suffix4U) ) &&
                     (get_rv() <= text.length()-4) );
             }
         /// @brief RV suffix comparison for five characters.
@@ -889,13 +1631,15 @@ namespace stemming
                     const wchar_t suffix4L, const wchar_t suffix4U,
                     const wchar_t suffix5L, const wchar_t suffix5U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L });
             if (text.length() < 5)
                 { return false; }
-            return ((stem<string_typeT>::is_either(text[text.length()-5], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-4], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], suffix3L, suffix3U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix4L, suffix4U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix5L, suffix5U) ) &&
+            return ((stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix3L, suffix3U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix4L, suffix4U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix5L, suffix5U) ) &&
                     (get_rv() <= text.length()-5) );
             }
         /// @brief RV suffix comparison for six characters.
@@ -922,14 +1666,16 @@ namespace stemming
                     const wchar_t suffix5L, const wchar_t suffix5U,
                     const wchar_t suffix6L, const wchar_t suffix6U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L, suffix6L });
             if (text.length() < 6)
                 { return false; }
-            return ((stem<string_typeT>::is_either(text[text.length()-6], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-5], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-4], suffix3L, suffix3U) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], suffix4L, suffix4U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix5L, suffix5U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix6L, suffix6U) ) &&
+            return ((stem<string_typeT, policyT>::is_either_case(text[text.length()-6], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix3L, suffix3U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix4L, suffix4U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix5L, suffix5U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix6L, suffix6U) ) &&
                     (get_rv() <= text.length()-6) );
             }
         /// @brief RV suffix comparison for seven characters.
@@ -959,15 +1705,17 @@ namespace stemming
                     const wchar_t suffix6L, const wchar_t suffix6U,
                     const wchar_t suffix7L, const wchar_t suffix7U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L, suffix6L, suffix7L });
             if (text.length() < 7)
                 { return false; }
-            return ((stem<string_typeT>::is_either(text[text.length()-7], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-6], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-5], suffix3L, suffix3U) &&
-                    stem<string_typeT>::is_either(text[text.length()-4], suffix4L, suffix4U) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], suffix5L, suffix5U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix6L, suffix6U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix7L, suffix7U) ) &&
+            return ((stem<string_typeT, policyT>::is_either_case(text[text.length()-7], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-6], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix3L, suffix3U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix4L, suffix4U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix5L, suffix5U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix6L, suffix6U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix7L, suffix7U) ) &&
                     (get_rv() <= text.length()-7) );
             }
         /// @brief RV suffix comparison for eight characters.
@@ -1000,16 +1748,18 @@ namespace stemming
                     const wchar_t suffix7L, const wchar_t suffix7U,
                     const wchar_t suffix8L, const wchar_t suffix8U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L, suffix6L, suffix7L, suffix8L });
             if (text.length() < 8)
                 { return false; }
-            return ((stem<string_typeT>::is_either(text[text.length()-8], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-7], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-6], suffix3L, suffix3U) &&
-                    stem<string_typeT>::is_either(text[text.length()-5], suffix4L, suffix4U) &&
-                    stem<string_typeT>::is_either(text[text.length()-4], suffix5L, suffix5U) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], suffix6L, suffix6U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix7L, suffix7U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix8L, suffix8U) ) &&
+            return ((stem<string_typeT, policyT>::is_either_case(text[text.length()-8], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-7], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-6], suffix3L, suffix3U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix4L, suffix4U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix5L, suffix5U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix6L, suffix6U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix7L, suffix7U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix8L, suffix8U) ) &&
                     (get_rv() <= text.length()-8) );
             }
 
@@ -1024,9 +1774,10 @@ namespace stemming
         inline bool is_suffix_in_r1(const string_typeT& text,
                     const wchar_t suffix1L, const wchar_t suffix1U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L });
             if (text.length() < 1)
                 { return false; }
-            return (stem<string_typeT>::is_either(text[text.length()-1], suffix1L, suffix1U) &&
+            return (stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix1L, suffix1U) &&
                     (get_r1() <= text.length()-1) );
             }
         /// @brief 1 suffix comparison for two characters.
@@ -1041,10 +1792,11 @@ namespace stemming
                     const wchar_t suffix1L, const wchar_t suffix1U,
                     const wchar_t suffix2L, const wchar_t suffix2U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L });
             if (text.length() < 2)
                 { return false; }
-            return ((stem<string_typeT>::is_either(text[text.length()-2], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix2L, suffix2U) ) &&
+            return ((stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix2L, suffix2U) ) &&
                     (get_r1() <= text.length()-2) );
             }
         /// @brief R1 suffix comparison for three characters.
@@ -1062,11 +1814,12 @@ namespace stemming
                     const wchar_t suffix2L, const wchar_t suffix2U,
                     const wchar_t suffix3L, const wchar_t suffix3U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L });
             if (text.length() < 3)
                 { return false; }
-            return ((stem<string_typeT>::is_either(text[text.length()-3], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix3L, suffix3U) ) &&
+            return ((stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix3L, suffix3U) ) &&
                     (get_r1() <= text.length()-3) );
             }
         /// @brief R1 suffix comparison for four characters.
@@ -1087,12 +1840,13 @@ namespace stemming
                     const wchar_t suffix3L, const wchar_t suffix3U,
                     const wchar_t suffix4L, const wchar_t suffix4U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L });
             if (text.length() < 4)
                 { return false; }
-            return ((stem<string_typeT>::is_either(text[text.length()-4], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix3L, suffix3U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix4L, suffix4U) ) &&
+            return ((stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix3L, suffix3U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix4L, suffix4U) ) &&
                     (get_r1() <= text.length()-4) );
             }
         /// @brief R1 suffix comparison for five characters.
@@ -1116,13 +1870,15 @@ namespace stemming
                     const wchar_t suffix4L, const wchar_t suffix4U,
                     const wchar_t suffix5L, const wchar_t suffix5U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L });
             if (text.length() < 5)
                 { return false; }
-            return ((stem<string_typeT>::is_either(text[text.length()-5], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-4], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], suffix3L, suffix3U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix4L, suffix4U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix5L, suffix5U) ) &&
+            return ((stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix3L, suffix3U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix4L, suffix4U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix5L, suffix5U) ) &&
                     (get_r1() <= text.length()-5) );
             }
         /// @brief R1 suffix comparison for six characters.
@@ -1149,14 +1905,16 @@ namespace stemming
                     const wchar_t suffix5L, const wchar_t suffix5U,
                     const wchar_t suffix6L, const wchar_t suffix6U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L, suffix6L });
             if (text.length() < 6)
                 { return false; }
-            return ((stem<string_typeT>::is_either(text[text.length()-6], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-5], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-4], suffix3L, suffix3U) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], suffix4L, suffix4U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix5L, suffix5U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix6L, suffix6U) ) &&
+            return ((stem<string_typeT, policyT>::is_either_case(text[text.length()-6], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix3L, suffix3U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix4L, suffix4U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix5L, suffix5U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix6L, suffix6U) ) &&
                     (get_r1() <= text.length()-6) );
             }
 
@@ -1171,9 +1929,10 @@ namespace stemming
         inline bool is_suffix_in_r2(const string_typeT& text,
                     const wchar_t suffix1L, const wchar_t suffix1U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L });
             if (text.length() < 1)
                 { return false; }
-            return (stem<string_typeT>::is_either(text[text.length()-1], suffix1L, suffix1U) &&
+            return (stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix1L, suffix1U) &&
                     (get_r2() <= text.length()-1) );
             }
         /// @brief R2 suffix comparison for two characters.
@@ -1188,10 +1947,11 @@ namespace stemming
                     const wchar_t suffix1L, const wchar_t suffix1U,
                     const wchar_t suffix2L, const wchar_t suffix2U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L });
             if (text.length() < 2)
                 { return false; }
-            return ((stem<string_typeT>::is_either(text[text.length()-2], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix2L, suffix2U) ) &&
+            return ((stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix2L, suffix2U) ) &&
                     (get_r2() <= text.length()-2) );
             }
         /// @brief R2 suffix comparison for three characters.
@@ -1209,11 +1969,12 @@ namespace stemming
                     const wchar_t suffix2L, const wchar_t suffix2U,
                     const wchar_t suffix3L, const wchar_t suffix3U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L });
             if (text.length() < 3)
                 { return false; }
-            return ((stem<string_typeT>::is_either(text[text.length()-3], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix3L, suffix3U) ) &&
+            return ((stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix3L, suffix3U) ) &&
                     (get_r2() <= text.length()-3) );
             }
         /// @brief R2 suffix comparison for four characters.
@@ -1234,12 +1995,13 @@ namespace stemming
                     const wchar_t suffix3L, const wchar_t suffix3U,
                     const wchar_t suffix4L, const wchar_t suffix4U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L });
             if (text.length() < 4)
                 { return false; }
-            return ((stem<string_typeT>::is_either(text[text.length()-4], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix3L, suffix3U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix4L, suffix4U) ) &&
+            return ((stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix3L, suffix3U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix4L, suffix4U) ) &&
                     (get_r2() <= text.length()-4) );
             }
         /// @brief R2 suffix comparison for five characters.
@@ -1263,13 +2025,15 @@ namespace stemming
                     const wchar_t suffix4L, const wchar_t suffix4U,
                     const wchar_t suffix5L, const wchar_t suffix5U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L });
             if (text.length() < 5)
                 { return false; }
-            return ((stem<string_typeT>::is_either(text[text.length()-5], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-4], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], suffix3L, suffix3U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix4L, suffix4U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix5L, suffix5U) ) &&
+            return ((stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix3L, suffix3U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix4L, suffix4U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix5L, suffix5U) ) &&
                     (get_r2() <= text.length()-5) );
             }
         /// @brief R2 suffix comparison for six characters.
@@ -1296,14 +2060,16 @@ namespace stemming
                     const wchar_t suffix5L, const wchar_t suffix5U,
                     const wchar_t suffix6L, const wchar_t suffix6U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L, suffix6L });
             if (text.length() < 6)
                 { return false; }
-            return ((stem<string_typeT>::is_either(text[text.length()-6], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-5], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-4], suffix3L, suffix3U) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], suffix4L, suffix4U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix5L, suffix5U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix6L, suffix6U) ) &&
+            return ((stem<string_typeT, policyT>::is_either_case(text[text.length()-6], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix3L, suffix3U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix4L, suffix4U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix5L, suffix5U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix6L, suffix6U) ) &&
                     (get_r2() <= text.length()-6) );
             }
         /// @brief R2 suffix comparison for seven characters.
@@ -1333,15 +2099,17 @@ namespace stemming
                     const wchar_t suffix6L, const wchar_t suffix6U,
                     const wchar_t suffix7L, const wchar_t suffix7U) noexcept
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L, suffix6L, suffix7L });
             if (text.length() < 7)
                 { return false; }
-            return ((stem<string_typeT>::is_either(text[text.length()-7], suffix1L, suffix1U) &&
-                    stem<string_typeT>::is_either(text[text.length()-6], suffix2L, suffix2U) &&
-                    stem<string_typeT>::is_either(text[text.length()-5], suffix3L, suffix3U) &&
-                    stem<string_typeT>::is_either(text[text.length()-4], suffix4L, suffix4U) &&
-                    stem<string_typeT>::is_either(text[text.length()-3], suffix5L, suffix5U) &&
-                    stem<string_typeT>::is_either(text[text.length()-2], suffix6L, suffix6U) &&
-                    stem<string_typeT>::is_either(text[text.length()-1], suffix7L, suffix7U) ) &&
+            return ((stem<string_typeT, policyT>::is_either_case(text[text.length()-7], suffix1L, suffix1U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-6], suffix2L, suffix2U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix3L, suffix3U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix4L, suffix4U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix5L, suffix5U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix6L, suffix6U) &&
+                    stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix7L, suffix7U) ) &&
                     (get_r2() <= text.length()-7) );
             }
 
@@ -1357,12 +2125,13 @@ namespace stemming
                     const wchar_t suffix1L, const wchar_t suffix1U,
                     const bool success_on_find = true)
             {
-            assert(suffix1L == stem<string_typeT>::tolower_western(suffix1U) );
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L });
+            assert(suffix1L == tolower_western(suffix1U) );
             if (text.length() < 1)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-1], suffix1L, suffix1U))
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix1L, suffix1U))
                 {
                 if (get_r1() <= text.length()-1)
                     {
@@ -1390,12 +2159,13 @@ namespace stemming
                     const wchar_t suffix2L, const wchar_t suffix2U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L });
             if (text.length() < 2)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-2], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix2L, suffix2U))
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix2L, suffix2U))
                 {
                 if (get_r1() <= text.length()-2)
                     {
@@ -1426,13 +2196,14 @@ namespace stemming
                     const wchar_t suffix3L, const wchar_t suffix3U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L });
             if (text.length() < 3)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-3], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-2], suffix2L, suffix2U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix3L, suffix3U) )
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix2L, suffix2U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix3L, suffix3U) )
                 {
                 if (get_r1() <= text.length()-3)
                     {
@@ -1466,14 +2237,15 @@ namespace stemming
                     const wchar_t suffix4L, const wchar_t suffix4U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L });
             if (text.length() < 4)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-4], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-3], suffix2L, suffix2U) &&
-                stem<string_typeT>::is_either(text[text.length()-2], suffix3L, suffix3U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix4L, suffix4U) )
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix2L, suffix2U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix3L, suffix3U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix4L, suffix4U) )
                 {
                 if (get_r1() <= text.length()-4)
                     {
@@ -1510,15 +2282,17 @@ namespace stemming
                     const wchar_t suffix5L, const wchar_t suffix5U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L });
             if (text.length() < 5)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-5], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-4], suffix2L, suffix2U) &&
-                stem<string_typeT>::is_either(text[text.length()-3], suffix3L, suffix3U) &&
-                stem<string_typeT>::is_either(text[text.length()-2], suffix4L, suffix4U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix5L, suffix5U) )
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix2L, suffix2U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix3L, suffix3U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix4L, suffix4U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix5L, suffix5U) )
                 {
                 if (get_r1() <= text.length()-5)
                     {
@@ -1558,16 +2332,18 @@ namespace stemming
                     const wchar_t suffix6L, const wchar_t suffix6U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L, suffix6L });
             if (text.length() < 6)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-6], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-5], suffix2L, suffix2U) &&
-                stem<string_typeT>::is_either(text[text.length()-4], suffix3L, suffix3U) &&
-                stem<string_typeT>::is_either(text[text.length()-3], suffix4L, suffix4U) &&
-                stem<string_typeT>::is_either(text[text.length()-2], suffix5L, suffix5U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix6L, suffix6U) )
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-6], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix2L, suffix2U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix3L, suffix3U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix4L, suffix4U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix5L, suffix5U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix6L, suffix6U) )
                 {
                 if (get_r1() <= text.length()-6)
                     {
@@ -1610,17 +2386,19 @@ namespace stemming
                     const wchar_t suffix7L, const wchar_t suffix7U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L, suffix6L, suffix7L });
             if (text.length() < 7)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-7], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-6], suffix2L, suffix2U) &&
-                stem<string_typeT>::is_either(text[text.length()-5], suffix3L, suffix3U) &&
-                stem<string_typeT>::is_either(text[text.length()-4], suffix4L, suffix4U) &&
-                stem<string_typeT>::is_either(text[text.length()-3], suffix5L, suffix5U) &&
-                stem<string_typeT>::is_either(text[text.length()-2], suffix6L, suffix6U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix7L, suffix7U) )
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-7], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-6], suffix2L, suffix2U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix3L, suffix3U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix4L, suffix4U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix5L, suffix5U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix6L, suffix6U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix7L, suffix7U) )
                 {
                 if (get_r1() <= text.length()-7)
                     {
@@ -1648,9 +2426,10 @@ namespace stemming
                     const wchar_t suffix1L, const wchar_t suffix1U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L });
             if (text.length() < 1)
                 { return false; }
-            else if (stem<string_typeT>::is_either(text[text.length()-1], suffix1L, suffix1U))
+            else if (stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix1L, suffix1U))
                 {
                 if (get_r2() <= text.length()-1)
                     {
@@ -1676,12 +2455,13 @@ namespace stemming
                     const wchar_t suffix2L, const wchar_t suffix2U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L });
             if (text.length() < 2)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-2], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix2L, suffix2U))
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix2L, suffix2U))
                 {
                 if (get_r2() <= text.length()-2)
                     {
@@ -1712,13 +2492,14 @@ namespace stemming
                     const wchar_t suffix3L, const wchar_t suffix3U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L });
             if (text.length() < 3)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-3], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-2], suffix2L, suffix2U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix3L, suffix3U) )
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix2L, suffix2U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix3L, suffix3U) )
                 {
                 if (get_r2() <= text.length()-3)
                     {
@@ -1752,14 +2533,15 @@ namespace stemming
                     const wchar_t suffix4L, const wchar_t suffix4U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L });
             if (text.length() < 4)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-4], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-3], suffix2L, suffix2U) &&
-                stem<string_typeT>::is_either(text[text.length()-2], suffix3L, suffix3U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix4L, suffix4U) )
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix2L, suffix2U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix3L, suffix3U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix4L, suffix4U) )
                 {
                 if (get_r2() <= text.length()-4)
                     {
@@ -1796,15 +2578,17 @@ namespace stemming
                     const wchar_t suffix5L, const wchar_t suffix5U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L });
             if (text.length() < 5)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-5], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-4], suffix2L, suffix2U) &&
-                stem<string_typeT>::is_either(text[text.length()-3], suffix3L, suffix3U) &&
-                stem<string_typeT>::is_either(text[text.length()-2], suffix4L, suffix4U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix5L, suffix5U) )
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix2L, suffix2U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix3L, suffix3U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix4L, suffix4U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix5L, suffix5U) )
                 {
                 if (get_r2() <= text.length()-5)
                     {
@@ -1844,16 +2628,18 @@ namespace stemming
                     const wchar_t suffix6L, const wchar_t suffix6U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L, suffix6L });
             if (text.length() < 6)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-6], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-5], suffix2L, suffix2U) &&
-                stem<string_typeT>::is_either(text[text.length()-4], suffix3L, suffix3U) &&
-                stem<string_typeT>::is_either(text[text.length()-3], suffix4L, suffix4U) &&
-                stem<string_typeT>::is_either(text[text.length()-2], suffix5L, suffix5U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix6L, suffix6U) )
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-6], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix2L, suffix2U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix3L, suffix3U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix4L, suffix4U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix5L, suffix5U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix6L, suffix6U) )
                 {
                 if (get_r2() <= text.length()-6)
                     {
@@ -1896,17 +2682,19 @@ namespace stemming
                     const wchar_t suffix7L, const wchar_t suffix7U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L, suffix6L, suffix7L });
             if (text.length() < 7)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-7], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-6], suffix2L, suffix2U) &&
-                stem<string_typeT>::is_either(text[text.length()-5], suffix3L, suffix3U) &&
-                stem<string_typeT>::is_either(text[text.length()-4], suffix4L, suffix4U) &&
-                stem<string_typeT>::is_either(text[text.length()-3], suffix5L, suffix5U) &&
-                stem<string_typeT>::is_either(text[text.length()-2], suffix6L, suffix6U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix7L, suffix7U) )
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-7], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-6], suffix2L, suffix2U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix3L, suffix3U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix4L, suffix4U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix5L, suffix5U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix6L, suffix6U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix7L, suffix7U) )
                 {
                 if (get_r2() <= text.length()-7)
                     {
@@ -1952,18 +2740,20 @@ namespace stemming
                     const wchar_t suffix8L, const wchar_t suffix8U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L, suffix6L, suffix7L, suffix8L });
             if (text.length() < 8)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-8], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-7], suffix2L, suffix2U) &&
-                stem<string_typeT>::is_either(text[text.length()-6], suffix3L, suffix3U) &&
-                stem<string_typeT>::is_either(text[text.length()-5], suffix4L, suffix4U) &&
-                stem<string_typeT>::is_either(text[text.length()-4], suffix5L, suffix5U) &&
-                stem<string_typeT>::is_either(text[text.length()-3], suffix6L, suffix6U) &&
-                stem<string_typeT>::is_either(text[text.length()-2], suffix7L, suffix7U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix8L, suffix8U) )
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-8], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-7], suffix2L, suffix2U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-6], suffix3L, suffix3U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix4L, suffix4U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix5L, suffix5U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix6L, suffix6U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix7L, suffix7U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix8L, suffix8U) )
                 {
                 if (get_r2() <= text.length()-8)
                     {
@@ -1991,11 +2781,12 @@ namespace stemming
                     const wchar_t suffix1L, const wchar_t suffix1U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L });
             if (text.length() < 1)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-1], suffix1L, suffix1U))
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix1L, suffix1U))
                 {
                 if (get_rv() <= text.length()-1)
                     {
@@ -2023,12 +2814,13 @@ namespace stemming
                     const wchar_t suffix2L, const wchar_t suffix2U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L });
             if (text.length() < 2)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-2], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix2L, suffix2U))
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix2L, suffix2U))
                 {
                 if (get_rv() <= text.length()-2)
                     {
@@ -2059,13 +2851,14 @@ namespace stemming
                     const wchar_t suffix3L, const wchar_t suffix3U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L });
             if (text.length() < 3)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-3], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-2], suffix2L, suffix2U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix3L, suffix3U) )
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix2L, suffix2U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix3L, suffix3U) )
                 {
                 if (get_rv() <= text.length()-3)
                     {
@@ -2099,14 +2892,15 @@ namespace stemming
                     const wchar_t suffix4L, const wchar_t suffix4U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L });
             if (text.length() < 4)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-4], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-3], suffix2L, suffix2U) &&
-                stem<string_typeT>::is_either(text[text.length()-2], suffix3L, suffix3U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix4L, suffix4U) )
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix2L, suffix2U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix3L, suffix3U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix4L, suffix4U) )
                 {
                 if (get_rv() <= text.length()-4)
                     {
@@ -2143,15 +2937,17 @@ namespace stemming
                     const wchar_t suffix5L, const wchar_t suffix5U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L });
             if (text.length() < 5)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-5], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-4], suffix2L, suffix2U) &&
-                stem<string_typeT>::is_either(text[text.length()-3], suffix3L, suffix3U) &&
-                stem<string_typeT>::is_either(text[text.length()-2], suffix4L, suffix4U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix5L, suffix5U) )
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix2L, suffix2U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix3L, suffix3U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix4L, suffix4U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix5L, suffix5U) )
                 {
                 if (get_rv() <= text.length()-5)
                     {
@@ -2191,16 +2987,18 @@ namespace stemming
                     const wchar_t suffix6L, const wchar_t suffix6U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L, suffix6L });
             if (text.length() < 6)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-6], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-5], suffix2L, suffix2U) &&
-                stem<string_typeT>::is_either(text[text.length()-4], suffix3L, suffix3U) &&
-                stem<string_typeT>::is_either(text[text.length()-3], suffix4L, suffix4U) &&
-                stem<string_typeT>::is_either(text[text.length()-2], suffix5L, suffix5U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix6L, suffix6U) )
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-6], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix2L, suffix2U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix3L, suffix3U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix4L, suffix4U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix5L, suffix5U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix6L, suffix6U) )
                 {
                 if (get_rv() <= text.length()-6)
                     {
@@ -2243,17 +3041,19 @@ namespace stemming
                     const wchar_t suffix7L, const wchar_t suffix7U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L, suffix6L, suffix7L });
             if (text.length() < 7)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-7], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-6], suffix2L, suffix2U) &&
-                stem<string_typeT>::is_either(text[text.length()-5], suffix3L, suffix3U) &&
-                stem<string_typeT>::is_either(text[text.length()-4], suffix4L, suffix4U) &&
-                stem<string_typeT>::is_either(text[text.length()-3], suffix5L, suffix5U) &&
-                stem<string_typeT>::is_either(text[text.length()-2], suffix6L, suffix6U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix7L, suffix7U) )
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-7], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-6], suffix2L, suffix2U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix3L, suffix3U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix4L, suffix4U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix5L, suffix5U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix6L, suffix6U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix7L, suffix7U) )
                 {
                 if (get_rv() <= text.length()-7)
                     {
@@ -2299,18 +3099,20 @@ namespace stemming
                     const wchar_t suffix8L, const wchar_t suffix8U,
                     const bool success_on_find = true)
             {
+            stem<string_typeT, policyT>::record_suffix_test(text, { suffix1L, suffix2L, suffix3L, suffix4L,
+                                                                    suffix5L, suffix6L, suffix7L, suffix8L });
             if (text.length() < 8)
                 {
                 return false;
                 }
-            if (stem<string_typeT>::is_either(text[text.length()-8], suffix1L, suffix1U) &&
-                stem<string_typeT>::is_either(text[text.length()-7], suffix2L, suffix2U) &&
-                stem<string_typeT>::is_either(text[text.length()-6], suffix3L, suffix3U) &&
-                stem<string_typeT>::is_either(text[text.length()-5], suffix4L, suffix4U) &&
-                stem<string_typeT>::is_either(text[text.length()-4], suffix5L, suffix5U) &&
-                stem<string_typeT>::is_either(text[text.length()-3], suffix6L, suffix6U) &&
-                stem<string_typeT>::is_either(text[text.length()-2], suffix7L, suffix7U) &&
-                stem<string_typeT>::is_either(text[text.length()-1], suffix8L, suffix8U) )
+            if (stem<string_typeT, policyT>::is_either_case(text[text.length()-8], suffix1L, suffix1U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-7], suffix2L, suffix2U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-6], suffix3L, suffix3U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-5], suffix4L, suffix4U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-4], suffix5L, suffix5U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-3], suffix6L, suffix6U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-2], suffix7L, suffix7U) &&
+                stem<string_typeT, policyT>::is_either_case(text[text.length()-1], suffix8L, suffix8U) )
                 {
                 if (get_rv() <= text.length()-8)
                     {
@@ -2389,77 +3191,6 @@ namespace stemming
                 });
             }
 
-        /// @brief Hashes initial y, y after a vowel, and i between vowels into hashed character.
-        /// @param text The string to update.
-        /// @param vowel_string The list of vowels used by the stemmer's language.
-        void hash_dutch_yi(string_typeT& text,
-                    const wchar_t* vowel_string)
-            {
-            // need at least 2 letters for hashing
-            if (text.length() < 2)
-                { return; }
-
-            if (text[0] == common_lang_constants::LOWER_Y)
-                {
-                text[0] = LOWER_Y_HASH;
-                }
-            else if (text[0] == common_lang_constants::UPPER_Y)
-                {
-                text[0] = UPPER_Y_HASH;
-                }
-            bool in_vowel_block = stem<string_typeT>::is_one_of(text[0], vowel_string);
-
-            size_t i = 1;
-            for (i = 1; i < text.length()-1; ++i)
-                {
-                if (in_vowel_block &&
-                    text[i] == common_lang_constants::LOWER_I &&
-                    stem<string_typeT>::is_one_of(text[i+1], vowel_string) )
-                    {
-                    text[i] = LOWER_I_HASH;
-                    in_vowel_block = false;
-                    }
-                else if (in_vowel_block &&
-                    text[i] == common_lang_constants::UPPER_I &&
-                    stem<string_typeT>::is_one_of(text[i+1], vowel_string) )
-                    {
-                    text[i] = UPPER_I_HASH;
-                    in_vowel_block = false;
-                    }
-                else if (in_vowel_block &&
-                    text[i] == common_lang_constants::LOWER_Y)
-                    {
-                    text[i] = LOWER_Y_HASH;
-                    in_vowel_block = false;
-                    }
-                else if (in_vowel_block &&
-                    text[i] == common_lang_constants::UPPER_Y)
-                    {
-                    text[i] = UPPER_Y_HASH;
-                    in_vowel_block = false;
-                    }
-                else if (stem<string_typeT>::is_one_of(text[i], vowel_string) )
-                    {
-                    in_vowel_block = true;
-                    }
-                else
-                    {
-                    in_vowel_block = false;
-                    }
-                }
-            // check the last letter
-            if (in_vowel_block &&
-                text[i] == common_lang_constants::LOWER_Y)
-                {
-                text[i] = LOWER_Y_HASH;
-                }
-            else if (in_vowel_block &&
-                text[i] == common_lang_constants::UPPER_Y)
-                {
-                text[i] = UPPER_Y_HASH;
-                }
-            }
-
         /// @brief Unhashes y and i in a string.
         /// @param text The string to update.
         inline void unhash_dutch_yi(string_typeT& text)
@@ -2479,72 +3210,6 @@ namespace stemming
                 });
             }
 
-        /// @brief Hash 'u' and 'y' between vowels.
-        /// @param text The string to update.
-        /// @param vowel_string The list of vowels used by the stemmer's language.
-        void hash_german_yu(string_typeT& text,
-                    const wchar_t* vowel_string)
-            {
-            // need at least 2 letters for hashing
-            if (text.length() < 2)
-                { return; }
-
-            bool in_vowel_block = stem<string_typeT>::is_one_of(text[0], vowel_string);
-
-            for (size_t i = 1; i < text.length()-1; ++i)
-                {
-                if (in_vowel_block &&
-                    stem<string_typeT>::is_one_of(text[i], vowel_string) &&
-                    stem<string_typeT>::is_one_of(text[i+1], vowel_string) )
-                    {
-                    if (text[i] == common_lang_constants::LOWER_Y)
-                        {
-                        text[i] = LOWER_Y_HASH;
-                        }
-                    else if (text[i] == common_lang_constants::UPPER_Y)
-                        {
-                        text[i] = UPPER_Y_HASH;
-                        }
-                    else if (text[i] == common_lang_constants::LOWER_U)
-                        {
-                        text[i] = LOWER_U_HASH;
-                        }
-                    else if (text[i] == common_lang_constants::UPPER_U)
-                        {
-                        text[i] = UPPER_U_HASH;
-                        }
-                    }
-                else if (stem<string_typeT>::is_one_of(text[i], vowel_string) )
-                    {
-                    in_vowel_block = true;
-                    }
-                else
-                    {
-                    in_vowel_block = false;
-                    }
-                }
-            // hashable values must be between vowels, so don't bother looking at last letter
-            }
-
-        /// @brief Unhashes y and u in a string.
-        /// @param text The string to update.
-        inline void unhash_german_yu(string_typeT& text)
-            {
-            std::transform(text.cbegin(), text.cend(), text.begin(),
-                [](const auto& ch) noexcept
-                {
-                return (ch == LOWER_Y_HASH) ?
-                    common_lang_constants::LOWER_Y :
-                    (ch == UPPER_Y_HASH) ?
-                    common_lang_constants::UPPER_Y :
-                    (ch == LOWER_U_HASH) ?
-                    common_lang_constants::LOWER_U :
-                    (ch == UPPER_U_HASH) ?
-                    common_lang_constants::UPPER_U :
-                    ch;
-                });
-            }
-
         /** @brief Hashes the following:\n
              ï -> [control character]i\n
              ë -> [control character]i
@@ -2619,8 +3284,8 @@ namespace stemming
             for (i = 0; i < text.length()-1; ++i)
                 {
                 if (in_vowel_block &&
-                    stem<string_typeT>::is_one_of(text[i], vowel_string) &&
-                    stem<string_typeT>::is_one_of(text[i+1], vowel_string) )
+                    stem<string_typeT, policyT>::is_one_of(text[i], vowel_string) &&
+                    stem<string_typeT, policyT>::is_one_of(text[i+1], vowel_string) )
                     {
                     if (text[i] == common_lang_constants::LOWER_Y)
                         {
@@ -2668,26 +3333,26 @@ namespace stemming
                     }
                 // if just following letter is a vowel then examine for 'y'
                 else if (text[i] == common_lang_constants::LOWER_Y &&
-                        stem<string_typeT>::is_one_of(text[i+1], vowel_string) &&
-                        stem<string_typeT>::is_neither(text[i+1], common_lang_constants::LOWER_Y,
+                        stem<string_typeT, policyT>::is_one_of(text[i+1], vowel_string) &&
+                        stem<string_typeT, policyT>::is_neither(text[i+1], common_lang_constants::LOWER_Y,
                                                        common_lang_constants::UPPER_Y) )
                     {
                     text[i] = LOWER_Y_HASH;
                     in_vowel_block = false;
                     }
                 else if (text[i] == common_lang_constants::UPPER_Y &&
-                        stem<string_typeT>::is_one_of(text[i+1], vowel_string) &&
-                        stem<string_typeT>::is_neither(text[i+1], common_lang_constants::LOWER_Y,
+                        stem<string_typeT, policyT>::is_one_of(text[i+1], vowel_string) &&
+                        stem<string_typeT, policyT>::is_neither(text[i+1], common_lang_constants::LOWER_Y,
                                                        common_lang_constants::UPPER_Y) )
                     {
                     text[i] = UPPER_Y_HASH;
                     in_vowel_block = false;
                     }
-                else if (stem<string_typeT>::is_one_of(text[i], vowel_string) )
+                else if (stem<string_typeT, policyT>::is_one_of(text[i], vowel_string) )
                     {
                     if (text[i] == common_lang_constants::LOWER_U &&
                         (i > 0) &&
-                        stem<string_typeT>::is_either(text[i-1], common_lang_constants::LOWER_Q,
+                        stem<string_typeT, policyT>::is_either_case(text[i-1], common_lang_constants::LOWER_Q,
                                                       common_lang_constants::UPPER_Q) )
                         {
                         text[i] = LOWER_U_HASH;
@@ -2695,7 +3360,7 @@ namespace stemming
                         }
                     else if (text[i] == common_lang_constants::UPPER_U &&
                         (i > 0) &&
-                        stem<string_typeT>::is_either(text[i-1], common_lang_constants::LOWER_Q,
+                        stem<string_typeT, policyT>::is_either_case(text[i-1], common_lang_constants::LOWER_Q,
                                                       common_lang_constants::UPPER_Q) )
                         {
                         text[i] = UPPER_U_HASH;
@@ -2714,26 +3379,26 @@ namespace stemming
             // verify that the last letter
             if (text[i] == common_lang_constants::LOWER_Y &&
                 (i > 0) &&
-                stem<string_typeT>::is_one_of(text[i-1], vowel_string)    )
+                stem<string_typeT, policyT>::is_one_of(text[i-1], vowel_string)    )
                 {
                 text[i] = LOWER_Y_HASH;
                 }
             else if (text[i] == common_lang_constants::UPPER_Y &&
                     (i > 0) &&
-                    stem<string_typeT>::is_one_of(text[i-1], vowel_string) )
+                    stem<string_typeT, policyT>::is_one_of(text[i-1], vowel_string) )
                 {
                 text[i] = UPPER_Y_HASH;
                 }
             else if (text[i] == common_lang_constants::LOWER_U &&
                     (i > 0) &&
-                    stem<string_typeT>::is_either(text[i-1], common_lang_constants::LOWER_Q,
+                    stem<string_typeT, policyT>::is_either_case(text[i-1], common_lang_constants::LOWER_Q,
                                                   common_lang_constants::UPPER_Q) )
                 {
                 text[i] = LOWER_U_HASH;
                 }
             else if (text[i] == common_lang_constants::UPPER_U &&
                     (i > 0) &&
-                    stem<string_typeT>::is_either(text[i-1], common_lang_constants::LOWER_Q,
+                    stem<string_typeT, policyT>::is_either_case(text[i-1], common_lang_constants::LOWER_Q,
                                                   common_lang_constants::UPPER_Q) )
                 {
                 text[i] = UPPER_U_HASH;
@@ -2744,12 +3409,12 @@ namespace stemming
         /// @param text The string to update.
         void unhash_french_yui(string_typeT& text)
             {
-            stem<string_typeT>::replace_all(text, LOWER_Y_HASH, common_lang_constants::LOWER_Y);
-            stem<string_typeT>::replace_all(text, UPPER_Y_HASH, common_lang_constants::UPPER_Y);
-            stem<string_typeT>::replace_all(text, LOWER_U_HASH, common_lang_constants::LOWER_U);
-            stem<string_typeT>::replace_all(text, UPPER_U_HASH, common_lang_constants::UPPER_U);
-            stem<string_typeT>::replace_all(text, LOWER_I_HASH, common_lang_constants::LOWER_I);
-            stem<string_typeT>::replace_all(text, UPPER_I_HASH, common_lang_constants::UPPER_I);
+            stem<string_typeT, policyT>::replace_all(text, LOWER_Y_HASH, common_lang_constants::LOWER_Y);
+            stem<string_typeT, policyT>::replace_all(text, UPPER_Y_HASH, common_lang_constants::UPPER_Y);
+            stem<string_typeT, policyT>::replace_all(text, LOWER_U_HASH, common_lang_constants::LOWER_U);
+            stem<string_typeT, policyT>::replace_all(text, UPPER_U_HASH, common_lang_constants::UPPER_U);
+            stem<string_typeT, policyT>::replace_all(text, LOWER_I_HASH, common_lang_constants::LOWER_I);
+            stem<string_typeT, policyT>::replace_all(text, UPPER_I_HASH, common_lang_constants::UPPER_I);
             }
 
         /// @brief Hashes Y and y in a string.
@@ -2772,7 +3437,7 @@ namespace stemming
                 text[0] = UPPER_Y_HASH;
                 }
 
-            bool in_vowel_block = stem<string_typeT>::is_one_of(text[0], vowel_string);
+            bool in_vowel_block = stem<string_typeT, policyT>::is_one_of(text[0], vowel_string);
 
             for (size_t i = 1; i < text.length(); ++i)
                 {
@@ -2789,7 +3454,7 @@ namespace stemming
                     text[i] = UPPER_Y_HASH;
                     in_vowel_block = false;
                     }
-                else if (stem<string_typeT>::is_one_of(text[i], vowel_string) )
+                else if (stem<string_typeT, policyT>::is_one_of(text[i], vowel_string) )
                     {
                     in_vowel_block = true;
                     }
@@ -2826,7 +3491,7 @@ namespace stemming
             if (text.length() < 2)
                 { return; }
 
-            bool in_vowel_block = stem<string_typeT>::is_one_of(text[0], vowel_string);
+            bool in_vowel_block = stem<string_typeT, policyT>::is_one_of(text[0], vowel_string);
             constexpr static std::array<wchar_t, 4> uiValues =
                 {
                 common_lang_constants::LOWER_U,
@@ -2841,7 +3506,7 @@ namespace stemming
                 // u or i in between vowels
                 if (in_vowel_block &&
                     std::find(uiValues.cbegin(), uiValues.cend(), text[i]) != uiValues.cend() &&
-                    stem<string_typeT>::is_one_of(text[i+1], vowel_string) )
+                    stem<string_typeT, policyT>::is_one_of(text[i+1], vowel_string) )
                     {
                     if (text[i] == common_lang_constants::LOWER_I )
                         {
@@ -2860,13 +3525,13 @@ namespace stemming
                         text[i] = UPPER_U_HASH;
                         }
                     }
-                else if (stem<string_typeT>::is_one_of(text[i], vowel_string) )
+                else if (stem<string_typeT, policyT>::is_one_of(text[i], vowel_string) )
                     {
                     /* u after q should be encrypted and not be
                        treated as a vowel*/
                     if (text[i] == common_lang_constants::LOWER_U &&
                         (i > 0) &&
-                        stem<string_typeT>::is_either(text[i-1], common_lang_constants::LOWER_Q,
+                        stem<string_typeT, policyT>::is_either_case(text[i-1], common_lang_constants::LOWER_Q,
                                                       common_lang_constants::UPPER_Q) )
                         {
                         text[i] = LOWER_U_HASH;
@@ -2874,7 +3539,7 @@ namespace stemming
                         }
                     else if (text[i] == common_lang_constants::UPPER_U &&
                         (i > 0) &&
-                        stem<string_typeT>::is_either(text[i-1], common_lang_constants::LOWER_Q,
+                        stem<string_typeT, policyT>::is_either_case(text[i-1], common_lang_constants::LOWER_Q,
                                                       common_lang_constants::UPPER_Q) )
                         {
                         text[i] = UPPER_U_HASH;
@@ -2894,14 +3559,14 @@ namespace stemming
             // verify the last letter
             if (text[i] == common_lang_constants::LOWER_U &&
                 (i > 0) &&
-                stem<string_typeT>::is_either(text[i-1], common_lang_constants::LOWER_Q,
+                stem<string_typeT, policyT>::is_either_case(text[i-1], common_lang_constants::LOWER_Q,
                                               common_lang_constants::UPPER_Q) )
                 {
                 text[i] = LOWER_U_HASH;
                 }
             else if (text[i] == common_lang_constants::UPPER_U &&
                 (i > 0) &&
-                stem<string_typeT>::is_either(text[i-1], common_lang_constants::LOWER_Q,
+                stem<string_typeT, policyT>::is_either_case(text[i-1], common_lang_constants::LOWER_Q,
                                               common_lang_constants::UPPER_Q) )
                 {
                 text[i] = UPPER_U_HASH;
@@ -2927,104 +3592,6 @@ namespace stemming
                 });
             }
 
-        /// @brief Encodes Dutch umlauts (diaerises) in a string.
-        /// @param text The string to update.
-        void remove_dutch_umlauts(string_typeT& text)
-            {
-            for (size_t i = 0; i < text.length(); ++i)
-                {
-                if (text[i] == 0xC4)
-                    {
-                    text[i] = common_lang_constants::UPPER_A;
-                    }
-                else if (text[i] == 0xCB)
-                    {
-                    text[i] = common_lang_constants::UPPER_E;
-                    }
-                else if (text[i] == 0xCF)
-                    {
-                    text[i] = common_lang_constants::UPPER_I;
-                    }
-                else if (text[i] == 0xD6)
-                    {
-                    text[i] = common_lang_constants::UPPER_O;
-                    }
-                else if (text[i] == 0xDC)
-                    {
-                    text[i] = common_lang_constants::UPPER_U;
-                    }
-                else if (text[i] == 0xE4)
-                    {
-                    text[i] = common_lang_constants::LOWER_A;
-                    }
-                else if (text[i] == 0xEB)
-                    {
-                    text[i] = common_lang_constants::LOWER_E;
-                    }
-                else if (text[i] == 0xEF)
-                    {
-                    text[i] = common_lang_constants::LOWER_I;
-                    }
-                else if (text[i] == 0xF6)
-                    {
-                    text[i] = common_lang_constants::LOWER_O;
-                    }
-                else if (text[i] == 0xFC)
-                    {
-                    text[i] = common_lang_constants::LOWER_U;
-                    }
-                }
-            }
-
-        /// @brief Encodes Dutch acutes in a string.
-        /// @param text The string to update.
-        void remove_dutch_acutes(string_typeT& text)
-            {
-            for (size_t i = 0; i < text.length(); ++i)
-                {
-                if (text[i] == 0xC1)
-                    {
-                    text[i] = common_lang_constants::UPPER_A;
-                    }
-                else if (text[i] == 0xC9)
-                    {
-                    text[i] = common_lang_constants::UPPER_E;
-                    }
-                else if (text[i] == 0xCD)
-                    {
-                    text[i] = common_lang_constants::UPPER_I;
-                    }
-                else if (text[i] == 0xD3)
-                    {
-                    text[i] = common_lang_constants::UPPER_O;
-                    }
-                else if (text[i] == 0xDA)
-                    {
-                    text[i] = common_lang_constants::UPPER_U;
-                    }
-                else if (text[i] == 0xE1)
-                    {
-                    text[i] = common_lang_constants::LOWER_A;
-                    }
-                else if (text[i] == 0xE9)
-                    {
-                    text[i] = common_lang_constants::LOWER_E;
-                    }
-                else if (text[i] == 0xED)
-                    {
-                    text[i] = common_lang_constants::LOWER_I;
-                    }
-                else if (text[i] == 0xF3)
-                    {
-                    text[i] = common_lang_constants::LOWER_O;
-                    }
-                else if (text[i] == 0xFA)
-                    {
-                    text[i] = common_lang_constants::LOWER_U;
-                    }
-                }
-            }
-
         /// @brief Encodes Spanish acutes in a string.
         /// @param text The string to update.
         void remove_spanish_acutes(string_typeT& text)
@@ -3183,11 +3750,13 @@ namespace stemming
             }
 
         /** @brief Replace all instances of a substring in a string.
+            @details No temporary strings are constructed, so the only allocation
+                that can happen is @c text growing beyond its capacity.
             @param text The text to replace items in.
             @param textToReplace The text to replace.
             @param replacementText The text to replace @c textToReplace with.*/
-        static void replace_all(string_typeT& text, const string_typeT& textToReplace,
-                                const string_typeT& replacementText)
+        static void replace_all(string_typeT& text, const string_view_type textToReplace,
+                                const string_view_type replacementText)
             {
             size_t start = 0;
             while (start != string_typeT::npos)
@@ -3200,6 +3769,43 @@ namespace stemming
                 }
             }
 
+        /** @brief Replace all instances of a character in a string with a substring.
+            @param text The text to replace items in.
+            @param charToReplace The character to replace.
+            @param replacementText The text to replace @c charToReplace with.*/
+        static void replace_all(string_typeT& text, const wchar_t charToReplace,
+                                const string_view_type replacementText)
+            {
+            size_t start = 0;
+            while (start != string_typeT::npos)
+                {
+                start = text.find(charToReplace, start);
+                if (start == string_typeT::npos)
+                    { return; }
+                text.replace(start, 1, replacementText);
+                start += replacementText.length();
+                }
+            }
+
+        /** @brief Replace all instances of a substring in a string with a character.
+            @details Because the text can only shrink, this never allocates.
+            @param text The text to replace items in.
+            @param textToReplace The text to replace.
+            @param replacementChar The character to replace @c textToReplace with.*/
+        static void replace_all(string_typeT& text, const string_view_type textToReplace,
+                                const wchar_t replacementChar)
+            {
+            size_t start = 0;
+            while (start != string_typeT::npos)
+                {
+                start = text.find(textToReplace, start);
+                if (start == string_typeT::npos)
+                    { return; }
+                text.replace(start, textToReplace.length(), 1, replacementChar);
+                ++start;
+                }
+            }
+
         /// @brief Determines if a given value is either of two other given values.
         /// @param value The value to compare with.
         /// @param first The first value to compare against.
@@ -3210,6 +3816,23 @@ namespace stemming
         static inline constexpr bool is_either(const T value, const T first, const T second) noexcept
             { return (value == first || value == second); }
 
+        /** @brief Determines if a character is the given letter, in either case.
+            @details If the policy folds case (or assumes lowercased input), then the text
+                is already lowercased and only the lowercased version of the letter is compared.
+            @param ch The character to compare with.
+            @param lower The lowercased version of the letter.
+            @param upper The uppercased version of the letter.
+            @returns @c true if the character is the letter.*/
+        [[nodiscard]]
+        static inline constexpr bool is_either_case(const wchar_t ch, const wchar_t lower,
+                                                    const wchar_t upper) noexcept
+            {
+            if constexpr (is_lowercased_text())
+                { return (ch == lower); }
+            else
+                { return (ch == lower || ch == upper); }
+            }
+
         /// @brief Determines if a given value is neither of two other given values.
         /// @param value The value to compare with.
         /// @param first The first value to compare against.
@@ -3232,16 +3855,20 @@ namespace stemming
     //------------------------------------------------------
     /** A non-operational stemmer that is used in place of regular stemmers when
         you don't want the system to actually stem anything.*/
-    template <typename string_typeT = std::wstring>
-    class no_op_stem final : public stem<string_typeT>
+    template <typename string_typeT = std::wstring, typename policyT = default_stem_policy>
+    class no_op_stem final : public stem<string_typeT, policyT>
         {
     public:
         /// @brief The string type that this class will accept.
         using string_type = string_typeT;
         /// @brief No-op stemming of declared string type.
+        /// @details If the policy folds case, then the text is still lowercased.
         /// @param[in,out] text The text to stem.
         void operator()([[maybe_unused]] string_typeT&  text) final
-            {}
+            {
+            if constexpr (policyT::fold_case)
+                { stem<string_typeT, policyT>::normalize_input(text); }
+            }
         /// @returns The stemmer's language.
         [[nodiscard]]
         stemming_type get_language() const noexcept final
@@ -0,0 +1,417 @@
+/** @addtogroup Stemming
+    @brief Library for stemming words down to their root words.
+    @date 2004-2025
+    @copyright Oleander Software, Ltd.
+    @author Blake Madden
+    @details This program is free software; you can redistribute it and/or modify
+     it under the terms of the BSD License.
+
+    SPDX-License-Identifier: BSD-3-Clause
+* @{*/
+
+#ifndef OLEAN_STEMMING_STATISTICS_H
+#define OLEAN_STEMMING_STATISTICS_H
+
+#include "stemming.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <string_view>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+#endif
+
+namespace stemming
+    {
+    /** @returns A running count of CPU cycles (the time-stamp counter) on x86,
+            or of nanoseconds on other processors.*/
+    [[nodiscard]]
+    inline uint64_t read_cycle_counter() noexcept
+        {
+    #if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+        return __builtin_ia32_rdtsc();
+    #elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        return __rdtsc();
+    #else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    #endif
+        }
+
+    /// @brief Counters for one stemming step.
+    struct step_statistics
+        {
+        /// @brief The largest number of removed letters that has its own histogram bucket.
+        static constexpr size_t MAX_REMOVED_LENGTH{ 15 };
+
+        /// @brief The number of times that the step was run.
+        uint64_t m_entries{ 0 };
+        /// @brief The number of times that the step changed the word.
+        uint64_t m_matches{ 0 };
+        /// @brief The cycles spent in the step (not including any step that it calls).
+        /// @sa read_cycle_counter().
+        uint64_t m_cycles{ 0 };
+        /// @brief How many of the step's matches removed 0 (i.e., only replaced letters),
+        ///     1, 2, ... letters from the word, with longer suffixes in the last bucket.
+        std::array<uint64_t, MAX_REMOVED_LENGTH + 1> m_removed_lengths{};
+
+        /// @brief Adds another set of counters for the same step to this one.
+        /// @param that The counters to add.
+        void merge(const step_statistics& that) noexcept
+            {
+            m_entries += that.m_entries;
+            m_matches += that.m_matches;
+            m_cycles += that.m_cycles;
+            for (size_t i = 0; i < m_removed_lengths.size(); ++i)
+                { m_removed_lengths[i] += that.m_removed_lengths[i]; }
+            }
+        };
+
+    /// @brief Counters for one suffix that a step compares against the end of the word.
+    struct suffix_statistics
+        {
+        /// @brief The number of times that the suffix was compared.
+        uint64_t m_tests{ 0 };
+        /// @brief The number of times that the word ended with the suffix
+        ///     (whether or not it was in the required region).
+        uint64_t m_matches{ 0 };
+        /// @brief The total number of suffixes that the step had already compared
+        ///     (in the same run) before this one; divided by @c m_tests, this is
+        ///     the suffix's average position in the step's chain of comparisons.
+        uint64_t m_preceding_tests{ 0 };
+
+        /// @brief Adds another set of counters for the same suffix to this one.
+        /// @param that The counters to add.
+        void merge(const suffix_statistics& that) noexcept
+            {
+            m_tests += that.m_tests;
+            m_matches += that.m_matches;
+            m_preceding_tests += that.m_preceding_tests;
+            }
+        };
+
+    /** @brief Per-step counters (and named events) collected by stemmers whose
+            policy sets @c collect_statistics.
+        @details Each thread collects into its own object (see thread_statistics()),
+            so no locking is needed; merge() them together once the threads are done.
+        @par Example:
+        @code
+        stemming::english_stem<std::wstring, stemming::statistics_stem_policy> StemEnglish;
+        std::wstring word(L"hopping");
+        StemEnglish(word);
+        stemming::thread_statistics().dump(std::cout);
+        @endcode*/
+    class stemming_statistics
+        {
+    public:
+        /// @returns The counters for a step, which are added if not collected yet.
+        /// @param name The step's name (e.g., "english::step_1b").
+        [[nodiscard]]
+        step_statistics& get_step(const std::string_view name)
+            {
+            auto step = m_steps.find(name);
+            if (step == m_steps.end())
+                { step = m_steps.emplace(std::string{ name }, step_statistics{}).first; }
+            return step->second;
+            }
+
+        /// @brief Counts an occurrence of a named event (e.g., a branch within a step).
+        /// @param name The event's name.
+        void count_event(const std::string_view name)
+            {
+            auto event = m_events.find(name);
+            if (event == m_events.end())
+                { event = m_events.emplace(std::string{ name }, 0).first; }
+            ++event->second;
+            }
+
+        /** @brief Counts a comparison of a suffix against the end of a word.
+            @param step The name of the step making the comparison.
+            @param suffix The (lowercased) suffix.
+            @param position The number of suffixes that the step already compared in this run.
+            @param matched Whether the word ended with the suffix.*/
+        void count_suffix_test(const std::string_view step, const std::wstring_view suffix,
+                               const size_t position, const bool matched)
+            {
+            auto stepSuffixes = m_suffixes.find(step);
+            if (stepSuffixes == m_suffixes.end())
+                { stepSuffixes = m_suffixes.emplace(std::string{ step }, suffix_map{}).first; }
+            auto counters = stepSuffixes->second.find(suffix);
+            if (counters == stepSuffixes->second.end())
+                { counters = stepSuffixes->second.emplace(std::wstring{ suffix }, suffix_statistics{}).first; }
+            ++counters->second.m_tests;
+            counters->second.m_matches += matched ? 1 : 0;
+            counters->second.m_preceding_tests += position;
+            }
+
+        /// @returns The counters of each step, by step name.
+        [[nodiscard]]
+        const std::map<std::string, step_statistics, std::less<>>& get_steps() const noexcept
+            { return m_steps; }
+
+        /// @returns The number of times that each event occurred, by event name.
+        [[nodiscard]]
+        const std::map<std::string, uint64_t, std::less<>>& get_events() const noexcept
+            { return m_events; }
+
+        /// @returns The counters of each suffix that was compared, by step name and then suffix.
+        [[nodiscard]]
+        const std::map<std::string, std::map<std::wstring, suffix_statistics, std::less<>>, std::less<>>&
+            get_suffixes() const noexcept
+            { return m_suffixes; }
+
+        /// @brief Adds another thread's statistics to these.
+        /// @param that The statistics to add.
+        void merge(const stemming_statistics& that)
+            {
+            for (const auto& [name, step] : that.m_steps)
+                { get_step(name).merge(step); }
+            for (const auto& [name, count] : that.m_events)
+                { m_events[name] += count; }
+            for (const auto& [step, suffixes] : that.m_suffixes)
+                {
+                for (const auto& [suffix, counters] : suffixes)
+                    { m_suffixes[step][suffix].merge(counters); }
+                }
+            }
+
+        /// @brief Removes all collected statistics.
+        void clear() noexcept
+            {
+            m_steps.clear();
+            m_events.clear();
+            m_suffixes.clear();
+            }
+
+        /** @brief Writes the statistics as CSV: a table of the steps
+                (entries, matches, cycles, and the removed-length histogram),
+                a table of the events, and a table of the suffix comparisons
+                (with the suffixes encoded as UTF-8), separated by blank lines.
+            @param output The stream to write to.*/
+        void dump(std::ostream& output) const
+            {
+            output << "step,entries,matches,cycles";
+            for (size_t i = 0; i <= step_statistics::MAX_REMOVED_LENGTH; ++i)
+                {
+                output << ",removed_" << i <<
+                    (i == step_statistics::MAX_REMOVED_LENGTH ? "+" : "");
+                }
+            output << "\n";
+            for (const auto& [name, step] : m_steps)
+                {
+                output << name << ',' << step.m_entries << ',' << step.m_matches << ',' << step.m_cycles;
+                for (const auto count : step.m_removed_lengths)
+                    { output << ',' << count; }
+                output << "\n";
+                }
+            output << "\nevent,count\n";
+            for (const auto& [name, count] : m_events)
+                { output << name << ',' << count << "\n"; }
+            output << "\nstep,suffix,tests,matches,preceding_tests\n";
+            for (const auto& [step, suffixes] : m_suffixes)
+                {
+                for (const auto& [suffix, counters] : suffixes)
+                    {
+                    output << step << ',';
+                    write_utf8(output, suffix);
+                    output << ',' << counters.m_tests << ',' << counters.m_matches << ',' <<
+                        counters.m_preceding_tests << "\n";
+                    }
+                }
+            }
+
+        /// @brief Writes wide text to a narrow stream as UTF-8.
+        /// @param output The stream to write to.
+        /// @param text The text to write.
+        static void write_utf8(std::ostream& output, const std::wstring_view text)
+            {
+            for (const auto ch : text)
+                {
+                const auto codePoint = static_cast<uint32_t>(ch);
+                if (codePoint < 0x80)
+                    { output.put(static_cast<char>(codePoint)); }
+                else if (codePoint < 0x800)
+                    {
+                    output.put(static_cast<char>(0xC0 | (codePoint >> 6)));
+                    output.put(static_cast<char>(0x80 | (codePoint & 0x3F)));
+                    }
+                else if (codePoint < 0x10000)
+                    {
+                    output.put(static_cast<char>(0xE0 | (codePoint >> 12)));
+                    output.put(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                    output.put(static_cast<char>(0x80 | (codePoint & 0x3F)));
+                    }
+                else
+                    {
+                    output.put(static_cast<char>(0xF0 | (codePoint >> 18)));
+                    output.put(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+                    output.put(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                    output.put(static_cast<char>(0x80 | (codePoint & 0x3F)));
+                    }
+                }
+            }
+    private:
+        using suffix_map = std::map<std::wstring, suffix_statistics, std::less<>>;
+        std::map<std::string, step_statistics, std::less<>> m_steps;
+        std::map<std::string, uint64_t, std::less<>> m_events;
+        std::map<std::string, suffix_map, std::less<>> m_suffixes;
+        };
+
+    /// @returns The statistics collected by the stemmers on the calling thread.
+    [[nodiscard]]
+    inline stemming_statistics& thread_statistics() noexcept
+        {
+        thread_local stemming_statistics statistics;
+        return statistics;
+        }
+
+    /** @brief Records a run of a step into thread_statistics(), from its construction
+            to its destruction.
+        @details The step counts as a match if the word is different when the step finishes.\n
+            If another step is recorded while this one is running (i.e., one step calls another),
+            then this one is paused until it finishes, so that the cycles and changes made
+            by the called step are only counted once (by that step).*/
+    template<typename string_typeT>
+    class step_recorder
+        {
+    public:
+        /// @brief Starts recording a step.
+        /// @param text The word being stemmed.
+        /// @param name The step's name.
+        step_recorder(const string_typeT& text, const std::string_view name) :
+            m_text(text), m_name(name), m_parent(current())
+            {
+            if (m_parent != nullptr)
+                { m_parent->pause(); }
+            current() = this;
+            resume();
+            }
+        /// @private
+        step_recorder(const step_recorder&) = delete;
+        /// @private
+        step_recorder& operator=(const step_recorder&) = delete;
+        /// @returns The step being recorded on this thread, or null if none is.
+        [[nodiscard]]
+        static step_recorder* get_current() noexcept
+            { return current(); }
+
+        /// @returns The step's name.
+        [[nodiscard]]
+        std::string_view get_name() const noexcept
+            { return m_name; }
+
+        /// @brief Counts a suffix comparison made by the step.
+        /// @returns The number of suffixes that the step compared before this one.
+        size_t next_suffix_position() noexcept
+            { return m_suffix_tests++; }
+
+        /// @brief Stops recording and adds the step's counters to the thread's statistics.
+        ~step_recorder()
+            {
+            pause();
+            auto& step = thread_statistics().get_step(m_name);
+            ++step.m_entries;
+            step.m_cycles += m_cycles;
+            if (m_matched)
+                {
+                ++step.m_matches;
+                ++step.m_removed_lengths[std::min(m_removed, step_statistics::MAX_REMOVED_LENGTH)];
+                }
+            current() = m_parent;
+            if (m_parent != nullptr)
+                { m_parent->resume(); }
+            }
+    private:
+        /// @brief Stops the clock and notes if the word changed since it was started.
+        void pause() noexcept
+            {
+            m_cycles += read_cycle_counter() - m_start;
+            if (m_text != m_previous_text)
+                {
+                m_matched = true;
+                if (m_text.length() < m_previous_text.length())
+                    { m_removed += m_previous_text.length() - m_text.length(); }
+                }
+            }
+
+        /// @brief Copies the word and starts the clock.
+        void resume()
+            {
+            m_previous_text.assign(m_text);
+            m_start = read_cycle_counter();
+            }
+
+        /// @returns The step being recorded on this thread.
+        [[nodiscard]]
+        static step_recorder*& current() noexcept
+            {
+            thread_local step_recorder* recorder{ nullptr };
+            return recorder;
+            }
+
+        const string_typeT& m_text;
+        // the word when the step was started (or resumed)
+        string_typeT m_previous_text;
+        std::string_view m_name;
+        step_recorder* m_parent{ nullptr };
+        uint64_t m_start{ 0 };
+        uint64_t m_cycles{ 0 };
+        size_t m_removed{ 0 };
+        size_t m_suffix_tests{ 0 };
+        bool m_matched{ false };
+        };
+
+    /** @brief Policy that records how often each step runs and changes the word,
+            and the cycles spent in it, into thread_statistics().
+        @details This is meant for profiling; with the other policies,
+            the recording is removed at compile time (and this header isn't needed).\n
+            To combine this with other flags, derive from this policy.
+        @par Example:
+        @code
+        #include "english_stem.h"
+        #include "stemming_statistics.h"
+
+        stemming::english_stem<std::wstring, stemming::statistics_stem_policy> StemEnglish;
+        for (auto& word : words)
+            { StemEnglish(word); }
+        stemming::thread_statistics().dump(std::cout);
+        @endcode*/
+    struct statistics_stem_policy : public default_stem_policy
+        {
+        /// @brief Each step's statistics are recorded.
+        static constexpr bool collect_statistics{ true };
+
+        /// @returns A recorder for a run of a step, which records the step when it is destroyed.
+        /// @param text The word being stemmed.
+        /// @param name The step's name.
+        template<typename string_typeT>
+        [[nodiscard]]
+        static step_recorder<string_typeT> record_step(const string_typeT& text, const std::string_view name)
+            { return step_recorder<string_typeT>{ text, name }; }
+
+        /// @brief Counts a named event.
+        /// @param name The event's name.
+        static void record_event(const std::string_view name)
+            { thread_statistics().count_event(name); }
+
+        /// @brief Counts a suffix comparison for the step being recorded.
+        /// @param suffix The lowercased suffix.
+        /// @param matched Whether the word ended with the suffix.
+        template<typename string_typeT>
+        static void record_suffix_test(const std::wstring_view suffix, const bool matched)
+            {
+            auto* const step = step_recorder<string_typeT>::get_current();
+            thread_statistics().count_suffix_test(step != nullptr ? step->get_name() : std::string_view{},
+                suffix, step != nullptr ? step->next_suffix_position() : 0, matched);
+            }
+        };
+    }
+
+/** @}*/
+
+#endif // OLEAN_STEMMING_STATISTICS_H
@@ -20,8 +20,8 @@ namespace stemming
     @brief Swedish stemmer.
     */
     //------------------------------------------------------
-    template <typename string_typeT = std::wstring>
-    class swedish_stem final : public stem<string_typeT>
+    template <typename string_typeT = std::wstring, typename policyT = default_stem_policy>
+    class swedish_stem final : public stem<string_typeT, policyT>
         {
     public:
         /** @brief Stems a Swedish word.
@@ -29,28 +29,33 @@ namespace stemming
         void operator()(string_typeT& text) final
             {
             // reset internal data
-            stem<string_typeT>::reset_r_values();
+            stem<string_typeT, policyT>::reset_r_values();
 
-            std::transform(text.begin(), text.end(), text.begin(), full_width_to_narrow);
-            stem<string_typeT>::remove_possessive_suffix(text);
+            stem<string_typeT, policyT>::normalize_input(text);
+            stem<string_typeT, policyT>::remove_possessive_suffix(text);
 
             if (text.length() < 3)
                 { return; }
+            // a word (or number) that doesn't end with a letter from any of the suffixes is left as-is
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, ALL_STEP_ENDINGS))
+                { return; }
 
             // see where the R1 section begins
             // R1 is the first consonant after the first vowel
-            stem<string_typeT>::find_r1(text, SWEDISH_VOWELS);
-            if (stem<string_typeT>::get_r1() == text.length())
+            stem<string_typeT, policyT>::find_r1(text, SWEDISH_VOWELS);
+            if (stem<string_typeT, policyT>::get_r1() == text.length())
                 { return; }
 
             // R1 must have at least 3 characters in front of it
-            if (stem<string_typeT>::get_r1() < 3)
-                { stem<string_typeT>::set_r1(3); }
+            if (stem<string_typeT, policyT>::get_r1() < 3)
+                { stem<string_typeT, policyT>::set_r1(3); }
             // Swedish does not use R2
 
             step_1(text);
             step_2(text);
-            step_3(text);
+            // step 3 removes derivational suffixes
+            if constexpr (!policyT::light_stemming)
+                { step_3(text); }
             }
 
         /// @returns The stemmer's language.
@@ -61,282 +66,94 @@ namespace stemming
         //---------------------------------------------
         void step_1(string_typeT& text)
             {
-            if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*heterna*/common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*hetens*/common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*arna*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*erna*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*orna*/common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ande*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*arne*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*aste*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*anden*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*heten*/common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*heter*/common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*arnas*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ernas*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ornas*/common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*arens*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*andet*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*andes*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*aren*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*erns*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ades*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*are*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ade*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*het*/common_lang_constants::LOWER_H, common_lang_constants::UPPER_H,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ast*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ens*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ern*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
-                { return; }
-            else if (delete_if_valid_et_ending(text))
-                {
-                return;
-                }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*at*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*es*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*or*/common_lang_constants::LOWER_O, common_lang_constants::UPPER_O,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ad*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_D, common_lang_constants::UPPER_D, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*as*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*ar*/common_lang_constants::LOWER_A, common_lang_constants::UPPER_A,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*er*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_R, common_lang_constants::UPPER_R, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                /*en*/common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_N, common_lang_constants::UPPER_N, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                common_lang_constants::LOWER_A, common_lang_constants::UPPER_A, false) )
-                { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E, false) )
-                { return; }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
-                common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) )
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "swedish::step_1");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_1_ENDINGS))
+                { return; }
+            const auto suffix =
+                stem<string_typeT, policyT>::delete_longest_suffix_in_r1(text, STEP_1_SUFFIXES,
+                                                                         STEP_1_DELETED_SUFFIX_COUNT);
+            if (suffix.m_length == 0 || suffix.m_index < STEP_1_DELETED_SUFFIX_COUNT)
+                { return; }
+            // et and ets are only deleted if they follow a valid et-ending
+            if (suffix.m_index <= STEP_1_DELETED_SUFFIX_COUNT + 1 &&
+                delete_if_valid_et_ending(text, suffix.m_length))
+                { return; }
+            // s (including the one ending an ets that was kept) is only deleted if it follows a valid s-ending
+            if (suffix.m_index != STEP_1_DELETED_SUFFIX_COUNT &&
+                text.length() >= 2 &&
+                stem<string_typeT, policyT>::is_one_of(text[text.length()-2],
+                L"bcdfghjklmnoprtvyBCDFGHJKLMNOPRTVY") )
                 {
-                if (text.length() >= 2 &&
-                    stem<string_typeT>::is_one_of(text[text.length()-2],
-                    L"bcdfghjklmnoprtvyBCDFGHJKLMNOPRTVY") )
-                    {
-                    text.erase(text.length()-1);
-                    stem<string_typeT>::update_r_sections(text);
-                    }
-                return;
+                text.erase(text.length()-1);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
             }
         //---------------------------------------------
         void step_2(string_typeT& text)
             {
-            if (stem<string_typeT>::is_suffix_in_r1(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "swedish::step_2");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_2_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /*dd*/common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /*gd*/common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
                 common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /*nn*/common_lang_constants::LOWER_N, common_lang_constants::UPPER_N,
                 common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /*dt*/common_lang_constants::LOWER_D, common_lang_constants::UPPER_D,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /*gt*/common_lang_constants::LOWER_G, common_lang_constants::UPPER_G,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /*kt*/common_lang_constants::LOWER_K, common_lang_constants::UPPER_K,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
+            else if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /*tt*/common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
             }
         //---------------------------------------------
         void step_3(string_typeT& text)
             {
-            if (stem<string_typeT>::is_suffix_in_r1(text,
+            [[maybe_unused]] const auto recorder =
+                stem<string_typeT, policyT>::record_step(text, "swedish::step_3");
+            if (!stem<string_typeT, policyT>::is_last_char_in(text, STEP_3_ENDINGS))
+                { return; }
+            if (stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /* fullt */
                 common_lang_constants::LOWER_F, common_lang_constants::UPPER_F,
                 common_lang_constants::LOWER_U, common_lang_constants::UPPER_U,
@@ -345,49 +162,49 @@ namespace stemming
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
             else if (text.length() >= 4 &&
-                (stem<string_typeT>::is_either(text[text.length() - 4],
+                (stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                     common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) ||
-                 stem<string_typeT>::is_either(text[text.length() - 4],
+                 stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                      common_lang_constants::LOWER_K, common_lang_constants::UPPER_K) ||
-                 stem<string_typeT>::is_either(text[text.length() - 4],
+                 stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                      common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) ||
-                 stem<string_typeT>::is_either(text[text.length() - 4],
+                 stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                      common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) ||
-                 stem<string_typeT>::is_either(text[text.length() - 4],
+                 stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                      common_lang_constants::LOWER_P, common_lang_constants::UPPER_P) ||
-                 stem<string_typeT>::is_either(text[text.length() - 4],
+                 stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                      common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) ||
-                 stem<string_typeT>::is_either(text[text.length() - 4],
+                 stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                      common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) ||
-                 stem<string_typeT>::is_either(text[text.length() - 4],
+                 stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                      common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) ||
-                 stem<string_typeT>::is_either(text[text.length() - 4],
+                 stem<string_typeT, policyT>::is_either_case(text[text.length() - 4],
                      common_lang_constants::LOWER_V, common_lang_constants::UPPER_V)) &&
-                stem<string_typeT>::is_suffix_in_r1(text,
+                stem<string_typeT, policyT>::is_suffix_in_r1(text,
                 /* öst (with valid character in front of it) */
                 common_lang_constants::LOWER_O_UMLAUTS, common_lang_constants::UPPER_O_UMLAUTS,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S,
                 common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) )
                 {
                 text.erase(text.length()-1);
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /* lig */
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_G, common_lang_constants::UPPER_G, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /* els */
                 common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
                 common_lang_constants::LOWER_L, common_lang_constants::UPPER_L,
                 common_lang_constants::LOWER_S, common_lang_constants::UPPER_S, false) )
                 { return; }
-            else if (stem<string_typeT>::delete_if_is_in_r1(text,
+            else if (stem<string_typeT, policyT>::delete_if_is_in_r1(text,
                 /* ig */
                 common_lang_constants::LOWER_I, common_lang_constants::UPPER_I,
                 common_lang_constants::LOWER_G, common_lang_constants::UPPER_G, false) )
@@ -396,7 +213,7 @@ namespace stemming
 
         //---------------------------------------------
         [[nodiscard]]
-        bool delete_if_valid_et_ending(string_typeT& text)
+        bool delete_if_valid_et_ending(string_typeT& text, const size_t suffix_length)
             {
             /* Define a valid et-ending as at least one letter followed by a vowel followed by a non-vowel,
                which is not among any of the following:
@@ -415,217 +232,217 @@ namespace stemming
                     }
                 // suffix exceptions
                 if (textView.length() >= 1 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_H, common_lang_constants::UPPER_H))
                     {
                     return false;
                     }
                 else if (textView.length() >= 4 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 4],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 4],
                         common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_K, common_lang_constants::UPPER_K))
                     {
                     return false;
                     }
                 else if (textView.length() >= 4 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 4],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 4],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))
                     {
                     return false;
                     }
                 else if (textView.length() >= 4 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 4],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 4],
                         common_lang_constants::LOWER_K, common_lang_constants::UPPER_K) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_V, common_lang_constants::UPPER_V) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))
                     {
                     return false;
                     }
                 else if (textView.length() >= 4 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 4],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 4],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_V, common_lang_constants::UPPER_V) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))
                     {
                     return false;
                     }
                 else if (textView.length() >= 4 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 4],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 4],
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_L, common_lang_constants::UPPER_L) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))
                     {
                     return false;
                     }
                 else if (textView.length() >= 3 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_P, common_lang_constants::UPPER_P) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_K, common_lang_constants::UPPER_K))
                     {
                     return false;
                     }
                 else if (textView.length() >= 3 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_K, common_lang_constants::UPPER_K))
                     {
                     return false;
                     }
                 else if (textView.length() >= 3 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_K, common_lang_constants::UPPER_K) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_O, common_lang_constants::UPPER_O) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_M, common_lang_constants::UPPER_M))
                     {
                     return false;
                     }
                 else if (textView.length() >= 3 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_X, common_lang_constants::UPPER_X) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))
                     {
                     return false;
                     }
                 else if (textView.length() >= 3 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_S, common_lang_constants::UPPER_S) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))
                     {
                     return false;
                     }
                 else if (textView.length() >= 3 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))
                     {
                     return false;
                     }
                 else if (textView.length() >= 3 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_N, common_lang_constants::UPPER_N) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))
                     {
                     return false;
                     }
                 else if (textView.length() >= 3 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_D, common_lang_constants::UPPER_D) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))
                     {
                     return false;
                     }
                 else if (textView.length() >= 3 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_R, common_lang_constants::UPPER_R) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))
                     {
                     return false;
                     }
                 else if (textView.length() >= 3 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_P, common_lang_constants::UPPER_P) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))
                     {
                     return false;
                     }
                 else if (textView.length() >= 3 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_M, common_lang_constants::UPPER_M) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))
                     {
                     return false;
                     }
                 else if (textView.length() >= 3 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_C, common_lang_constants::UPPER_C) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))
                     {
                     return false;
                     }
                 else if (textView.length() >= 3 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_E, common_lang_constants::UPPER_E) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))
                     {
                     return false;
                     }
                 else if (textView.length() >= 3 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_U, common_lang_constants::UPPER_U) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_I, common_lang_constants::UPPER_I) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))
                     {
                     return false;
                     }
                 else if (textView.length() >= 3 &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 3],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 3],
                         common_lang_constants::LOWER_F, common_lang_constants::UPPER_F) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 2],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 2],
                         common_lang_constants::LOWER_A, common_lang_constants::UPPER_A) &&
-                    stem<string_typeT>::is_either(textView[textView.length() - 1],
+                    stem<string_typeT, policyT>::is_either_case(textView[textView.length() - 1],
                         common_lang_constants::LOWER_B, common_lang_constants::UPPER_B))
                     {
                     return false;
@@ -634,24 +451,7 @@ namespace stemming
                 return true;
                 };
 
-            
-            if (stem<string_typeT>::is_suffix_in_r1(text,
-                common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                common_lang_constants::LOWER_T, common_lang_constants::UPPER_T))
-                {
-                textView.remove_suffix(2);
-                }
-            else if (stem<string_typeT>::is_suffix_in_r1(text,
-                    common_lang_constants::LOWER_E, common_lang_constants::UPPER_E,
-                    common_lang_constants::LOWER_T, common_lang_constants::UPPER_T,
-                    common_lang_constants::LOWER_S, common_lang_constants::UPPER_S))
-                {
-                textView.remove_suffix(3);
-                }
-            else
-                {
-                return false;
-                }
+            textView.remove_suffix(suffix_length);
 
             if (textView.length() < 3)
                 {
@@ -669,7 +469,7 @@ namespace stemming
             if (isValidEtEnding())
                 {
                 text.erase(text.length() - (text.length() - textView.length()));
-                stem<string_typeT>::update_r_sections(text);
+                stem<string_typeT, policyT>::update_r_sections(text);
                 return true;
                 }
             else
@@ -677,6 +477,23 @@ namespace stemming
                 return false;
                 }
             }
+
+        // step 1's suffixes: the ones that are simply deleted, followed by
+        // the ones that need a check of their own
+        static constexpr suffix_trie<76> STEP_1_SUFFIXES{
+            L"heterna", L"hetens", L"arna", L"erna", L"orna", L"ande", L"arne", L"aste", L"anden",
+            L"heten", L"heter", L"arnas", L"ernas", L"ornas", L"arens", L"andet", L"andes", L"aren",
+            L"erns", L"ades", L"are", L"ade", L"het", L"ast", L"ens", L"ern", L"at", L"es", L"or",
+            L"ad", L"as", L"ar", L"er", L"en", L"a", L"e",
+            L"et", L"ets", L"s" };
+        static constexpr size_t STEP_1_DELETED_SUFFIX_COUNT{ 36 };
+
+        // the characters that the suffixes of each step can end with
+        static constexpr character_bitmap STEP_1_ENDINGS{ STEP_1_SUFFIXES.get_last_characters() };
+        static constexpr character_bitmap STEP_2_ENDINGS{ L"dnt" };
+        static constexpr character_bitmap STEP_3_ENDINGS{ L"gst" };
+        static constexpr character_bitmap ALL_STEP_ENDINGS{
+            STEP_1_ENDINGS | STEP_2_ENDINGS | STEP_3_ENDINGS };
         };
     }
 
@@ -0,0 +1,155 @@
+// Verifies that the stemmers do not allocate any memory when the
+// string being stemmed already has enough capacity.
+// This is its own test runner because it replaces the global operator new.
+
+#include <catch2/catch_test_macros.hpp>
+#include "../src/danish_stem.h"
+#include "../src/dutch_stem.h"
+#include "../src/english_stem.h"
+#include "../src/finnish_stem.h"
+#include "../src/french_stem.h"
+#include "../src/german_stem.h"
+#include "../src/italian_stem.h"
+#include "../src/norwegian_stem.h"
+#include "../src/portuguese_stem.h"
+#include "../src/russian_stem.h"
+#include "../src/spanish_stem.h"
+#include "../src/swedish_stem.h"
+#include "utfcpp/source/utf8.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cwctype>
+#include <fstream>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace
+    {
+    size_t allocationCount{ 0 };
+    }
+
+// GCC doesn't see that operator delete is paired with the replaced operator new
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size)
+    {
+    ++allocationCount;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+        { return ptr; }
+    throw std::bad_alloc{};
+    }
+
+void* operator new[](std::size_t size)
+    { return ::operator new(size); }
+
+void operator delete(void* ptr) noexcept
+    { std::free(ptr); }
+
+void operator delete[](void* ptr) noexcept
+    { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept
+    { std::free(ptr); }
+
+void operator delete[](void* ptr, std::size_t) noexcept
+    { std::free(ptr); }
+
+// Extra room reserved for the stemmers that temporarily lengthen the text
+// (e.g., hashing the diaereses in French).
+constexpr size_t WORK_BUFFER_PADDING{ 16 };
+
+template<typename Tstemmer>
+void TestAllocations(const std::string_view dictionaryPath, Tstemmer& stemmer)
+    {
+    std::ifstream dictFile(dictionaryPath.data());
+    if (!dictFile.is_open())
+        { FAIL("Dictionary file failed to load."); }
+
+    std::string line;
+    std::wstring word;
+    size_t lineNumber{ 0 };
+    size_t failedWords{ 0 };
+    while (std::getline(dictFile, line))
+        {
+        const auto utf16line = utf8::utf8to16(line);
+        word.clear();
+        std::for_each(utf16line.cbegin(), utf16line.cend(),
+            [&word](const auto ch)
+            { word.append(1, static_cast<wchar_t>(ch)); });
+
+        for (const bool uppercase : { false, true })
+            {
+            // a fresh buffer for each word, so that only the padding is available to grow into
+            std::wstring buffer;
+            buffer.reserve(word.length() + WORK_BUFFER_PADDING);
+            buffer.assign(word);
+            if (uppercase)
+                {
+                std::transform(buffer.cbegin(), buffer.cend(), buffer.begin(),
+                    [](const auto& ch)
+                    { return std::towupper(ch); });
+                }
+
+            const size_t allocationsBefore{ allocationCount };
+            stemmer(buffer);
+            if (allocationCount != allocationsBefore)
+                {
+                UNSCOPED_INFO("Allocation on line #" << lineNumber <<
+                              (uppercase ? " (uppercased)" : ""));
+                ++failedWords;
+                }
+            }
+        ++lineNumber;
+        }
+    CHECK(failedWords == 0);
+    }
+
+template<typename policyT>
+void TestAllLanguages()
+    {
+    stemming::danish_stem<std::wstring, policyT> danishStemmer;
+    TestAllocations("danish/voc.txt", danishStemmer);
+    stemming::dutch_porter_stem<std::wstring, policyT> dutchStemmer;
+    TestAllocations("dutch_porter/voc.txt", dutchStemmer);
+    stemming::english_stem<std::wstring, policyT> englishStemmer;
+    TestAllocations("english/voc.txt", englishStemmer);
+    stemming::finnish_stem<std::wstring, policyT> finnishStemmer;
+    TestAllocations("finnish/voc.txt", finnishStemmer);
+    stemming::french_stem<std::wstring, policyT> frenchStemmer;
+    TestAllocations("french/voc.txt", frenchStemmer);
+    stemming::german_stem<std::wstring, policyT> germanStemmer;
+    TestAllocations("german/voc.txt", germanStemmer);
+    germanStemmer.should_transliterate_umlauts(false);
+    TestAllocations("german/voc.txt", germanStemmer);
+    stemming::italian_stem<std::wstring, policyT> italianStemmer;
+    TestAllocations("italian/voc.txt", italianStemmer);
+    stemming::norwegian_stem<std::wstring, policyT> norwegianStemmer;
+    TestAllocations("norwegian/voc.txt", norwegianStemmer);
+    stemming::portuguese_stem<std::wstring, policyT> portugueseStemmer;
+    TestAllocations("portuguese/voc.txt", portugueseStemmer);
+    stemming::russian_stem<std::wstring, policyT> russianStemmer;
+    TestAllocations("russian/voc.txt", russianStemmer);
+    stemming::spanish_stem<std::wstring, policyT> spanishStemmer;
+    TestAllocations("spanish/voc.txt", spanishStemmer);
+    stemming::swedish_stem<std::wstring, policyT> swedishStemmer;
+    TestAllocations("swedish/voc.txt", swedishStemmer);
+    }
+
+TEST_CASE("Allocation counter", "[allocations]")
+    {
+    const size_t allocationsBefore{ allocationCount };
+    void* ptr = ::operator new(1024);
+    CHECK(allocationCount == allocationsBefore + 1);
+    ::operator delete(ptr);
+    }
+
+TEST_CASE("No allocations", "[allocations]")
+    {
+    SECTION("Default policy")
+        { TestAllLanguages<stemming::default_stem_policy>(); }
+    SECTION("Lowercase policy")
+        { TestAllLanguages<stemming::lowercase_stem_policy>(); }
+    }
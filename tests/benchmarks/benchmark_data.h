@@ -0,0 +1,378 @@
+// Word lists fed to the benchmarks. Each language's vocabulary is loaded once,
+// and the mixed-case, uppercase, and Zipf-weighted variants are derived from it.
+// The Snowball vocabularies are distinct words in alphabetical order, which is unlike real
+// text (and flatters the branch predictors and caches), so GenerateWorkload() draws streams
+// of tokens from them with Zipf-distributed frequencies, along with optional case noise,
+// possessives and elisions, and long outliers; InterleaveLanguages() mixes such streams.
+// Everything here is deterministic (no std::distribution or std::shuffle, whose
+// output varies between standard libraries), so results are comparable between
+// machines and releases.
+
+#ifndef OLEAN_BENCHMARK_DATA_H
+#define OLEAN_BENCHMARK_DATA_H
+
+#include "../utfcpp/source/utf8.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cwctype>
+#include <fstream>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// number of words drawn for the Zipf-weighted streams
+constexpr size_t ZIPF_STREAM_LENGTH{ 100'000 };
+
+/// @brief A list of words to stem, along with its size when encoded as UTF-8.
+struct benchmark_words
+    {
+    std::vector<std::wstring> m_words;
+    size_t m_utf8_bytes{ 0 };
+    };
+
+/// @returns The number of bytes that @c word takes up when encoded as UTF-8.
+[[nodiscard]]
+inline size_t Utf8Length(const std::wstring& word)
+    {
+    size_t length{ 0 };
+    for (const auto ch : word)
+        {
+        const auto codePoint = static_cast<uint32_t>(ch);
+        length += (codePoint < 0x80) ? 1 : (codePoint < 0x800) ? 2 : (codePoint < 0x10000) ? 3 : 4;
+        }
+    return length;
+    }
+
+/// @returns The words in @c words, with their UTF-8 size.
+[[nodiscard]]
+inline benchmark_words MakeBenchmarkWords(std::vector<std::wstring> words)
+    {
+    benchmark_words list;
+    list.m_words = std::move(words);
+    for (const auto& word : list.m_words)
+        { list.m_utf8_bytes += Utf8Length(word); }
+    return list;
+    }
+
+/// @brief Loads a Snowball vocabulary file (one UTF-8 word per line).
+/// @returns The words, or an empty list if the file could not be read.
+[[nodiscard]]
+inline benchmark_words LoadBenchmarkVocabulary(const std::string_view path)
+    {
+    std::vector<std::wstring> words;
+    std::ifstream file(path.data());
+    std::string line;
+    while (std::getline(file, line))
+        {
+        const auto utf16line = utf8::utf8to16(line);
+        words.emplace_back(utf16line.cbegin(), utf16line.cend());
+        }
+    return MakeBenchmarkWords(std::move(words));
+    }
+
+/// @brief Capitalizes every other word (as at the start of a sentence or in a title)
+///     and fully uppercases every seventh one (as with acronyms or headings).
+[[nodiscard]]
+inline benchmark_words ToMixedCase(const benchmark_words& vocabulary)
+    {
+    std::vector<std::wstring> words{ vocabulary.m_words };
+    for (size_t i = 0; i < words.size(); ++i)
+        {
+        if (words[i].empty())
+            { continue; }
+        if (i % 7 == 0)
+            {
+            std::transform(words[i].cbegin(), words[i].cend(), words[i].begin(),
+                [](const auto ch) { return static_cast<wchar_t>(std::towupper(ch)); });
+            }
+        else if (i % 2 == 0)
+            { words[i][0] = static_cast<wchar_t>(std::towupper(words[i][0])); }
+        }
+    return MakeBenchmarkWords(std::move(words));
+    }
+
+/// @brief Uppercases every word (the same transformation that the uppercase unit tests use).
+[[nodiscard]]
+inline benchmark_words ToUppercase(const benchmark_words& vocabulary)
+    {
+    std::vector<std::wstring> words{ vocabulary.m_words };
+    for (auto& word : words)
+        {
+        std::transform(word.cbegin(), word.cend(), word.begin(),
+            [](const auto ch) { return static_cast<wchar_t>(std::towupper(ch)); });
+        }
+    return MakeBenchmarkWords(std::move(words));
+    }
+
+/// @brief Builds words that push the stemmers into their slowest paths, from the longest words
+///     in a vocabulary: each word doubled (as with long compounds), with its last four letters
+///     repeated (stacking suffixes for the steps' long cascades of comparisons), and
+///     as uppercased full-width letters (so that every normalization pass has work to do).
+/// @param vocabulary The words to build from.
+/// @param longestCount How many of the longest words to build from.
+[[nodiscard]]
+inline benchmark_words MakeLongWords(const benchmark_words& vocabulary, const size_t longestCount = 256)
+    {
+    std::vector<std::wstring> longest{ vocabulary.m_words };
+    // longest first, with ties in file order so that the list is the same everywhere
+    std::stable_sort(longest.begin(), longest.end(),
+        [](const auto& first, const auto& second) { return first.length() > second.length(); });
+    longest.resize(std::min(longest.size(), longestCount));
+
+    std::vector<std::wstring> words;
+    words.reserve(longest.size() * 3);
+    for (const auto& word : longest)
+        {
+        words.push_back(word + word);
+
+        const auto ending = word.substr(word.length() - std::min<size_t>(word.length(), 4));
+        words.push_back(word + ending + ending + ending);
+
+        std::wstring fullWidth;
+        for (const auto ch : word)
+            {
+            const auto upper = static_cast<wchar_t>(std::towupper(ch));
+            fullWidth += (upper >= L'A' && upper <= L'Z') ? static_cast<wchar_t>(upper + 0xFEE0) : upper;
+            }
+        words.push_back(std::move(fullWidth));
+        }
+    return MakeBenchmarkWords(std::move(words));
+    }
+
+/// @brief The possessives and elisions that running text in a language has (and its stemmer removes).
+struct token_affixes
+    {
+    std::vector<std::wstring> m_prefixes;
+    std::vector<std::wstring> m_suffixes;
+    };
+
+/// @returns The possessives (e.g., "'s" in English and Dutch) or elisions (e.g., "l'" and "qu'" in French)
+///     for a language, given the name of its vocabulary folder.
+[[nodiscard]]
+inline token_affixes LanguageAffixes(const std::string_view vocabularyFolder)
+    {
+    if (vocabularyFolder == "english")
+        { return { {}, { L"'s", L"'" } }; }
+    if (vocabularyFolder.starts_with("dutch"))
+        { return { {}, { L"'s" } }; }
+    if (vocabularyFolder == "french")
+        { return { { L"l'", L"d'", L"qu'", L"j'", L"n'", L"s'", L"c'", L"m'", L"t'" }, {} }; }
+    return {};
+    }
+
+/// @brief How a stream of tokens is drawn by GenerateWorkload().
+struct workload_options
+    {
+    /// @brief The number of tokens to draw.
+    size_t m_length{ ZIPF_STREAM_LENGTH };
+    /// @brief The Zipf exponent of the word frequencies
+    ///     (1.0 is typical for natural language; higher values repeat the common words more).
+    double m_skew{ 1.0 };
+    /// @brief The seed for the ranking, the draws, and the noise.
+    uint64_t m_seed{ 5489 };
+    /// @brief The fraction of tokens that are capitalized (or, for a third of them, uppercased).
+    double m_case_noise{ 0 };
+    /// @brief The fraction of tokens that are given one of @c m_affixes.
+    double m_affix_rate{ 0 };
+    /// @brief The fraction of tokens replaced with long words from MakeLongWords().
+    double m_long_token_rate{ 0 };
+    /// @brief The possessives and elisions to add to tokens.
+    token_affixes m_affixes;
+    };
+
+/// @brief The options used for the "running text" workloads: some capitalized and uppercased words,
+///     the language's possessives and elisions, and occasional long tokens.
+[[nodiscard]]
+inline workload_options RunningTextOptions(const std::string_view vocabularyFolder)
+    {
+    workload_options options;
+    options.m_case_noise = 0.15;
+    options.m_affix_rate = 0.05;
+    options.m_long_token_rate = 0.001;
+    options.m_affixes = LanguageAffixes(vocabularyFolder);
+    return options;
+    }
+
+/// @brief Draws a stream of tokens whose frequencies follow Zipf's law, the way running text does,
+///     with optional noise (case, possessives and elisions, and long outliers).
+/// @details Each word is assigned a random frequency rank (the vocabulary files are sorted
+///     alphabetically, so ranking them in file order would favor words starting with 'a'),
+///     and the word of rank @c k is drawn with a probability proportional to <tt>1/k^skew</tt>.\n
+///     The noise is drawn from a separate generator, so the same words are drawn
+///     (in the same order) whatever the noise settings are.
+/// @param vocabulary The distinct words to draw from.
+/// @param options How to draw the tokens.
+[[nodiscard]]
+inline benchmark_words GenerateWorkload(const benchmark_words& vocabulary, const workload_options& options)
+    {
+    if (vocabulary.m_words.empty())
+        { return {}; }
+    std::mt19937_64 generator{ options.m_seed };
+
+    std::vector<size_t> ranks(vocabulary.m_words.size());
+    for (size_t i = 0; i < ranks.size(); ++i)
+        { ranks[i] = i; }
+    for (size_t i = ranks.size() - 1; i > 0; --i)
+        { std::swap(ranks[i], ranks[generator() % (i + 1)]); }
+
+    std::vector<double> cumulativeWeights(ranks.size());
+    double totalWeight{ 0 };
+    for (size_t i = 0; i < cumulativeWeights.size(); ++i)
+        {
+        totalWeight += 1.0 / std::pow(static_cast<double>(i + 1), options.m_skew);
+        cumulativeWeights[i] = totalWeight;
+        }
+
+    std::mt19937_64 noiseGenerator{ options.m_seed ^ 0x9E37'79B9'7F4A'7C15 };
+    // uniform in [0, 1) from the top 53 bits
+    const auto uniform = [](std::mt19937_64& source)
+        { return static_cast<double>(source() >> 11) * 0x1.0p-53; };
+    const auto chance = [&](const double rate)
+        { return rate > 0 && uniform(noiseGenerator) < rate; };
+    const auto longWords = (options.m_long_token_rate > 0) ? MakeLongWords(vocabulary) : benchmark_words{};
+    const size_t affixCount = options.m_affixes.m_prefixes.size() + options.m_affixes.m_suffixes.size();
+
+    std::vector<std::wstring> words;
+    words.reserve(options.m_length);
+    for (size_t i = 0; i < options.m_length; ++i)
+        {
+        const double draw = uniform(generator) * totalWeight;
+        const auto rank = std::min<size_t>(
+            std::upper_bound(cumulativeWeights.cbegin(), cumulativeWeights.cend(), draw) -
+                cumulativeWeights.cbegin(),
+            ranks.size() - 1);
+        std::wstring word{ vocabulary.m_words[ranks[rank]] };
+
+        if (chance(options.m_long_token_rate) && !longWords.m_words.empty())
+            { word = longWords.m_words[noiseGenerator() % longWords.m_words.size()]; }
+        if (chance(options.m_affix_rate) && affixCount > 0)
+            {
+            const auto affix = noiseGenerator() % affixCount;
+            if (affix < options.m_affixes.m_prefixes.size())
+                { word.insert(0, options.m_affixes.m_prefixes[affix]); }
+            else
+                { word += options.m_affixes.m_suffixes[affix - options.m_affixes.m_prefixes.size()]; }
+            }
+        if (chance(options.m_case_noise) && !word.empty())
+            {
+            if (noiseGenerator() % 3 == 0)
+                {
+                std::transform(word.cbegin(), word.cend(), word.begin(),
+                    [](const auto ch) { return static_cast<wchar_t>(std::towupper(ch)); });
+                }
+            else
+                { word[0] = static_cast<wchar_t>(std::towupper(word[0])); }
+            }
+        words.push_back(std::move(word));
+        }
+    return MakeBenchmarkWords(std::move(words));
+    }
+
+/// @brief Draws a stream of words whose frequencies follow Zipf's law, without any noise.
+/// @param vocabulary The distinct words to draw from.
+/// @param streamLength The number of words to draw.
+/// @param exponent The skew of the distribution (1.0 is typical for natural language).
+/// @param seed The seed for the ranking and the draws.
+/// @sa GenerateWorkload().
+[[nodiscard]]
+inline benchmark_words ToZipfStream(const benchmark_words& vocabulary, const size_t streamLength,
+                                    const double exponent = 1.0, const uint64_t seed = 5489)
+    {
+    workload_options options;
+    options.m_length = streamLength;
+    options.m_skew = exponent;
+    options.m_seed = seed;
+    return GenerateWorkload(vocabulary, options);
+    }
+
+/// @brief Tokens from several languages, along with the language of each one.
+struct multilingual_words
+    {
+    benchmark_words m_words;
+    /// @brief The index (into the streams passed to InterleaveLanguages()) of each token's language.
+    std::vector<size_t> m_languages;
+    };
+
+/// @brief Interleaves streams of tokens from different languages in runs (like sentences or the fields
+///     of multilingual documents), where each run's language and length are drawn at random.
+/// @details Every token from every stream is used once, in its stream's order.
+/// @param streams The tokens of each language.
+/// @param meanRunLength The average number of tokens in a run.
+/// @param seed The seed for the runs.
+[[nodiscard]]
+inline multilingual_words InterleaveLanguages(const std::vector<benchmark_words>& streams,
+                                              const size_t meanRunLength = 12, const uint64_t seed = 5489)
+    {
+    std::mt19937_64 generator{ seed };
+    std::vector<size_t> positions(streams.size(), 0);
+    std::vector<size_t> remainingLanguages;
+    for (size_t i = 0; i < streams.size(); ++i)
+        {
+        if (!streams[i].m_words.empty())
+            { remainingLanguages.push_back(i); }
+        }
+
+    multilingual_words interleaved;
+    std::vector<std::wstring> words;
+    while (!remainingLanguages.empty())
+        {
+        const auto choice = generator() % remainingLanguages.size();
+        const auto language = remainingLanguages[choice];
+        const auto& stream = streams[language].m_words;
+        const auto runLength = std::min<size_t>(1 + generator() % (2 * std::max<size_t>(meanRunLength, 1)),
+                                                stream.size() - positions[language]);
+        for (size_t i = 0; i < runLength; ++i)
+            {
+            words.push_back(stream[positions[language]++]);
+            interleaved.m_languages.push_back(language);
+            }
+        if (positions[language] == stream.size())
+            { remainingLanguages.erase(remainingLanguages.begin() + static_cast<std::ptrdiff_t>(choice)); }
+        }
+    interleaved.m_words = MakeBenchmarkWords(std::move(words));
+    return interleaved;
+    }
+
+/// @brief What a benchmark processes, registered under the benchmark's name so that
+///     its timing can be converted into per-word and per-byte rates.
+struct benchmark_workload
+    {
+    std::string m_group;
+    std::string m_input;
+    size_t m_words{ 0 };
+    size_t m_utf8_bytes{ 0 };
+    };
+
+/// @brief The workloads of the benchmarks, keyed by benchmark name.
+inline std::map<std::string, benchmark_workload> BenchmarkWorkloads;
+
+/// @brief Registers the words that a benchmark processes on each run.
+/// @param name The benchmark's name.
+/// @param group The language or set of functions being benchmarked.
+/// @param input A description of the words (e.g., "uppercase").
+/// @param words The words.
+inline void RegisterWorkload(const std::string& name, const std::string& group,
+                             const std::string& input, const benchmark_words& words)
+    { BenchmarkWorkloads[name] = { group, input, words.m_words.size(), words.m_utf8_bytes }; }
+
+/// @brief Stems every word in the list, reusing one buffer so that only the stemmer is measured.
+/// @returns The total length of the stems (so that the stemming isn't optimized away).
+template<typename Tstemmer>
+size_t StemWords(const std::vector<std::wstring>& words, Tstemmer& stemmer)
+    {
+    std::wstring buffer;
+    buffer.reserve(64);
+    size_t stemmedLength{ 0 };
+    for (const auto& word : words)
+        {
+        buffer.assign(word);
+        stemmer(buffer);
+        stemmedLength += buffer.length();
+        }
+    return stemmedLength;
+    }
+
+#endif // OLEAN_BENCHMARK_DATA_H
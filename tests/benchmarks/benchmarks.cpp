@@ -0,0 +1,360 @@
+// Throughput benchmarks for the stemmers. Each language's vocabulary is loaded into memory once
+// and stemmed as-is, in mixed case, in uppercase, as a Zipf-weighted stream of words, and
+// as running text (the same stream with case noise, possessives and elisions, and long tokens).
+// "Mixed languages" stems running text from all of the languages interleaved, each token with
+// its language's stemmer.
+// Along with Catch2's own report, the ns/word, words/sec, and MB/sec (of UTF-8 input) of each
+// benchmark are printed at the end of the run and, with "--results <file>", written as JSON.
+//
+// A results file can be used as a baseline: with "--compare <file>", each benchmark's ns/word
+// is compared with the baseline's, and the run fails (exits with a non-zero status) if any
+// benchmark is slower by more than the tolerance ("--tolerance <percent>", 5% by default)
+// and the confidence intervals of the two means (see "--benchmark-confidence-interval")
+// do not overlap, i.e., the slowdown is both large enough to matter and not just noise.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/reporters/catch_reporter_event_listener.hpp>
+#include <catch2/reporters/catch_reporter_registrars.hpp>
+#include "../../src/danish_stem.h"
+#include "../../src/dutch_stem.h"
+#include "../../src/english_stem.h"
+#include "../../src/finnish_stem.h"
+#include "../../src/french_stem.h"
+#include "../../src/german_stem.h"
+#include "../../src/italian_stem.h"
+#include "../../src/norwegian_stem.h"
+#include "../../src/portuguese_stem.h"
+#include "../../src/russian_stem.h"
+#include "../../src/spanish_stem.h"
+#include "../../src/swedish_stem.h"
+#include "benchmark_data.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+    {
+    /// @brief A finished benchmark's timing (for processing the whole workload once).
+    struct benchmark_result
+        {
+        std::string m_name;
+        benchmark_workload m_workload;
+        double m_mean_ns{ 0 };
+        double m_std_dev_ns{ 0 };
+        // the confidence interval of the mean
+        double m_mean_lower_ns{ 0 };
+        double m_mean_upper_ns{ 0 };
+        size_t m_samples{ 0 };
+
+        [[nodiscard]]
+        double ns_per_word() const
+            { return m_mean_ns / static_cast<double>(m_workload.m_words); }
+
+        [[nodiscard]]
+        double words_per_second() const
+            { return static_cast<double>(m_workload.m_words) * 1e9 / m_mean_ns; }
+
+        [[nodiscard]]
+        double mb_per_second() const
+            { return static_cast<double>(m_workload.m_utf8_bytes) * 1e3 / m_mean_ns; }
+        };
+
+    /// @brief A benchmark's timing per word from a baseline results file.
+    struct baseline_result
+        {
+        double m_ns_per_word{ 0 };
+        double m_lower_ns_per_word{ 0 };
+        double m_upper_ns_per_word{ 0 };
+        };
+
+    std::vector<benchmark_result> results;
+    std::string resultsPath;
+    std::string baselinePath;
+    double tolerancePercent{ 5 };
+    size_t regressionCount{ 0 };
+
+    void WriteResults(std::ostream& output)
+        {
+        output << "{\n  \"version\": 2,\n  \"benchmarks\": [";
+        for (size_t i = 0; i < results.size(); ++i)
+            {
+            const auto& result = results[i];
+            char timings[384]{};
+            std::snprintf(timings, sizeof(timings),
+                          "\"samples\": %zu, \"mean_ns\": %.1f, \"mean_lower_ns\": %.1f, "
+                          "\"mean_upper_ns\": %.1f, \"std_dev_ns\": %.1f, \"ns_per_word\": %.3f, "
+                          "\"words_per_second\": %.0f, \"mb_per_second\": %.3f",
+                          result.m_samples, result.m_mean_ns, result.m_mean_lower_ns,
+                          result.m_mean_upper_ns, result.m_std_dev_ns, result.ns_per_word(),
+                          result.words_per_second(), result.mb_per_second());
+            output << (i == 0 ? "\n" : ",\n") << "    { \"name\": \"" << result.m_name <<
+                "\", \"group\": \"" << result.m_workload.m_group <<
+                "\", \"input\": \"" << result.m_workload.m_input <<
+                "\", \"words\": " << result.m_workload.m_words <<
+                ", \"bytes\": " << result.m_workload.m_utf8_bytes << ", " << timings << " }";
+            }
+        output << "\n  ]\n}\n";
+        }
+
+    // Reads a number that follows "key": in a results file's benchmark entry.
+    [[nodiscard]]
+    bool ReadJsonNumber(const std::string& entry, const std::string& key, double& value)
+        {
+        const auto position = entry.find("\"" + key + "\":");
+        if (position == std::string::npos)
+            { return false; }
+        std::istringstream number(entry.substr(position + key.length() + 3));
+        return static_cast<bool>(number >> value);
+        }
+
+    /// @brief Loads the ns/word of each benchmark in a results file written by WriteResults().
+    /// @details Version 1 files do not have the confidence intervals, so their means are used instead.
+    /// @returns The timings, keyed by benchmark name (empty if the file could not be read).
+    [[nodiscard]]
+    std::map<std::string, baseline_result> LoadBaseline(const std::string& path)
+        {
+        std::ifstream file(path);
+        const std::string contents{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+        std::map<std::string, baseline_result> baseline;
+        const std::string nameKey{ "{ \"name\": \"" };
+        for (auto start = contents.find(nameKey); start != std::string::npos;
+             start = contents.find(nameKey, start + 1))
+            {
+            const auto nameEnd = contents.find('"', start + nameKey.length());
+            const auto entryEnd = contents.find('}', start);
+            if (nameEnd == std::string::npos || entryEnd == std::string::npos)
+                { break; }
+            const auto entry = contents.substr(start, entryEnd - start);
+            double words{ 0 }, mean{ 0 }, lower{ 0 }, upper{ 0 };
+            if (!ReadJsonNumber(entry, "words", words) || !ReadJsonNumber(entry, "mean_ns", mean) || words <= 0)
+                { continue; }
+            if (!ReadJsonNumber(entry, "mean_lower_ns", lower) || !ReadJsonNumber(entry, "mean_upper_ns", upper))
+                { lower = upper = mean; }
+            baseline[contents.substr(start + nameKey.length(), nameEnd - (start + nameKey.length()))] =
+                { mean / words, lower / words, upper / words };
+            }
+        return baseline;
+        }
+
+    // Prints how each benchmark compares with the baseline and counts the regressions.
+    void CompareResults(const std::map<std::string, baseline_result>& baseline)
+        {
+        std::printf("\n%-40s %12s %12s %9s\n", "Benchmark", "baseline", "ns/word", "change");
+        for (const auto& result : results)
+            {
+            const auto previous = baseline.find(result.m_name);
+            if (previous == baseline.cend())
+                {
+                std::printf("%-40s %12s %12.2f %9s\n", result.m_name.c_str(), "-", result.ns_per_word(), "new");
+                continue;
+                }
+            const auto words = static_cast<double>(result.m_workload.m_words);
+            const double change = (result.ns_per_word() / previous->second.m_ns_per_word - 1) * 100;
+            const bool isRegression = change > tolerancePercent &&
+                                      result.m_mean_lower_ns / words > previous->second.m_upper_ns_per_word;
+            const bool isImprovement = change < -tolerancePercent &&
+                                       result.m_mean_upper_ns / words < previous->second.m_lower_ns_per_word;
+            if (isRegression)
+                { ++regressionCount; }
+            std::printf("%-40s %12.2f %12.2f %+8.1f%%%s\n", result.m_name.c_str(),
+                        previous->second.m_ns_per_word, result.ns_per_word(), change,
+                        isRegression ? "  REGRESSION" : isImprovement ? "  faster" : "");
+            }
+        std::printf("\n%zu regression(s) beyond %.1f%% compared with %s\n", regressionCount,
+                    tolerancePercent, baselinePath.c_str());
+        }
+    }
+
+/// @brief Converts each benchmark's time into per-word and per-byte rates once it finishes.
+class throughput_listener : public Catch::EventListenerBase
+    {
+public:
+    using Catch::EventListenerBase::EventListenerBase;
+
+    void benchmarkEnded(const Catch::BenchmarkStats<>& stats) override
+        {
+        const auto workload = BenchmarkWorkloads.find(stats.info.name);
+        if (workload == BenchmarkWorkloads.cend() || workload->second.m_words == 0)
+            { return; }
+        results.push_back({ stats.info.name, workload->second,
+                            stats.mean.point.count(), stats.standardDeviation.point.count(),
+                            stats.mean.lower_bound.count(), stats.mean.upper_bound.count(),
+                            stats.samples.size() });
+        }
+
+    void testRunEnded([[maybe_unused]] const Catch::TestRunStats& stats) override
+        {
+        if (results.empty())
+            { return; }
+        std::printf("\n%-40s %10s %14s %10s\n", "Benchmark", "ns/word", "words/sec", "MB/sec");
+        for (const auto& result : results)
+            {
+            std::printf("%-40s %10.2f %14.0f %10.2f\n", result.m_name.c_str(), result.ns_per_word(),
+                        result.words_per_second(), result.mb_per_second());
+            }
+        std::fflush(stdout);
+
+        if (!resultsPath.empty())
+            {
+            std::ofstream output(resultsPath);
+            if (!output)
+                {
+                std::cerr << "Unable to write benchmark results to " << resultsPath << "\n";
+                return;
+                }
+            WriteResults(output);
+            }
+
+        if (!baselinePath.empty())
+            {
+            const auto baseline = LoadBaseline(baselinePath);
+            if (baseline.empty())
+                {
+                std::cerr << "Unable to read a baseline from " << baselinePath << "\n";
+                // nothing could be compared, so treat it as a failure
+                ++regressionCount;
+                return;
+                }
+            CompareResults(baseline);
+            }
+        }
+    };
+
+CATCH_REGISTER_LISTENER(throughput_listener)
+
+template<typename Tstemmer>
+void BenchmarkLanguage(const std::string& language, const std::string& vocabularyFolder)
+    {
+    const auto vocabulary = LoadBenchmarkVocabulary(vocabularyFolder + "/voc.txt");
+    REQUIRE_FALSE(vocabulary.m_words.empty());
+
+    const struct
+        {
+        std::string m_input;
+        benchmark_words m_words;
+        } inputs[] = {
+            { "vocabulary", vocabulary },
+            { "mixed case", ToMixedCase(vocabulary) },
+            { "uppercase", ToUppercase(vocabulary) },
+            { "zipf", ToZipfStream(vocabulary, ZIPF_STREAM_LENGTH) },
+            { "running text", GenerateWorkload(vocabulary, RunningTextOptions(vocabularyFolder)) } };
+
+    Tstemmer stemmer;
+    for (const auto& input : inputs)
+        {
+        const std::string name{ language + " (" + input.m_input + ")" };
+        RegisterWorkload(name, language, input.m_input, input.m_words);
+        BENCHMARK(std::string{ name }) { return StemWords(input.m_words.m_words, stemmer); };
+        }
+    }
+
+TEST_CASE("Danish", "[danish]")
+    { BenchmarkLanguage<stemming::danish_stem<>>("Danish", "danish"); }
+
+TEST_CASE("Dutch", "[dutch]")
+    { BenchmarkLanguage<stemming::dutch_porter_stem<>>("Dutch", "dutch_porter"); }
+
+TEST_CASE("English", "[english]")
+    { BenchmarkLanguage<stemming::english_stem<>>("English", "english"); }
+
+TEST_CASE("Finnish", "[finnish]")
+    { BenchmarkLanguage<stemming::finnish_stem<>>("Finnish", "finnish"); }
+
+TEST_CASE("French", "[french]")
+    { BenchmarkLanguage<stemming::french_stem<>>("French", "french"); }
+
+TEST_CASE("German", "[german]")
+    { BenchmarkLanguage<stemming::german_stem<>>("German", "german"); }
+
+TEST_CASE("Italian", "[italian]")
+    { BenchmarkLanguage<stemming::italian_stem<>>("Italian", "italian"); }
+
+TEST_CASE("Norwegian", "[norwegian]")
+    { BenchmarkLanguage<stemming::norwegian_stem<>>("Norwegian", "norwegian"); }
+
+TEST_CASE("Portuguese", "[portuguese]")
+    { BenchmarkLanguage<stemming::portuguese_stem<>>("Portuguese", "portuguese"); }
+
+TEST_CASE("Russian", "[russian]")
+    { BenchmarkLanguage<stemming::russian_stem<>>("Russian", "russian"); }
+
+TEST_CASE("Spanish", "[spanish]")
+    { BenchmarkLanguage<stemming::spanish_stem<>>("Spanish", "spanish"); }
+
+TEST_CASE("Swedish", "[swedish]")
+    { BenchmarkLanguage<stemming::swedish_stem<>>("Swedish", "swedish"); }
+
+TEST_CASE("Mixed languages", "[multilingual]")
+    {
+    const struct
+        {
+        std::string m_vocabulary_folder;
+        std::shared_ptr<stemming::stem<>> m_stemmer;
+        } languages[] = {
+            { "danish", std::make_shared<stemming::danish_stem<>>() },
+            { "dutch_porter", std::make_shared<stemming::dutch_porter_stem<>>() },
+            { "english", std::make_shared<stemming::english_stem<>>() },
+            { "finnish", std::make_shared<stemming::finnish_stem<>>() },
+            { "french", std::make_shared<stemming::french_stem<>>() },
+            { "german", std::make_shared<stemming::german_stem<>>() },
+            { "italian", std::make_shared<stemming::italian_stem<>>() },
+            { "norwegian", std::make_shared<stemming::norwegian_stem<>>() },
+            { "portuguese", std::make_shared<stemming::portuguese_stem<>>() },
+            { "russian", std::make_shared<stemming::russian_stem<>>() },
+            { "spanish", std::make_shared<stemming::spanish_stem<>>() },
+            { "swedish", std::make_shared<stemming::swedish_stem<>>() } };
+
+    std::vector<benchmark_words> streams;
+    for (const auto& language : languages)
+        {
+        auto options = RunningTextOptions(language.m_vocabulary_folder);
+        options.m_length = ZIPF_STREAM_LENGTH / std::size(languages);
+        streams.push_back(
+            GenerateWorkload(LoadBenchmarkVocabulary(language.m_vocabulary_folder + "/voc.txt"), options));
+        REQUIRE_FALSE(streams.back().m_words.empty());
+        }
+    const auto tokens = InterleaveLanguages(streams);
+
+    const std::string name{ "Mixed languages (running text)" };
+    RegisterWorkload(name, "Mixed languages", "running text", tokens.m_words);
+    BENCHMARK(std::string{ name })
+        {
+        std::wstring buffer;
+        buffer.reserve(64);
+        size_t stemmedLength{ 0 };
+        for (size_t i = 0; i < tokens.m_words.m_words.size(); ++i)
+            {
+            buffer.assign(tokens.m_words.m_words[i]);
+            (*languages[tokens.m_languages[i]].m_stemmer)(buffer);
+            stemmedLength += buffer.length();
+            }
+        return stemmedLength;
+        };
+    }
+
+int main(int argc, char* argv[])
+    {
+    Catch::Session session;
+
+    using Catch::Clara::Opt;
+    session.cli(session.cli() |
+                Opt(resultsPath, "file")["--results"]("write the ns/word, words/sec, and MB/sec "
+                                                      "of each benchmark to a JSON file (e.g., as a baseline)") |
+                Opt(baselinePath, "file")["--compare"]("compare each benchmark with a baseline results file "
+                                                       "and fail if any are slower") |
+                Opt(tolerancePercent, "percent")["--tolerance"]("how much slower than the baseline a benchmark "
+                                                                "can be before it fails (default 5)"));
+
+    if (const int returnCode = session.applyCommandLine(argc, argv); returnCode != 0)
+        { return returnCode; }
+    const int returnCode = session.run();
+    return (returnCode == 0 && regressionCount > 0) ? 1 : returnCode;
+    }
@@ -0,0 +1,221 @@
+// Hardware counters (instructions, cycles, IPC, branch misses, and L1/LLC misses) per word
+// for each stemmer, which show whether a stemmer is limited by mispredicted branches in its
+// suffix cascades or by cache misses. These are hidden, so run them with "[counters]".
+//
+// Reading the counters around each step would cost more than the step itself, so the step
+// groups are measured by difference instead, stemming a Zipf-weighted stream of (lowercase)
+// words drawn from the vocabulary with:
+//   - the default policy (the whole stemmer);
+//   - a policy that removes the full-width, possessive, and elision passes (but still compares
+//     suffixes against both cases of a letter, like the default), so "normalization passes"
+//     is default - that policy;
+//   - a policy that only sets assume_lowercase, so "two-case comparisons" (what comparing each
+//     suffix letter against its uppercased version costs) is default - that policy;
+//   - the light version of the policy without normalization passes, which only runs the
+//     inflectional steps (along with finding the R sections), reported as "inflectional steps";
+//   - "derivational steps" is then the policy without normalization passes - its light version.
+// Apart from the first, the rows are measured with two-case comparisons, as with the default policy.
+
+#include <catch2/catch_test_macros.hpp>
+#include "../../src/danish_stem.h"
+#include "../../src/dutch_stem.h"
+#include "../../src/english_stem.h"
+#include "../../src/finnish_stem.h"
+#include "../../src/french_stem.h"
+#include "../../src/german_stem.h"
+#include "../../src/italian_stem.h"
+#include "../../src/norwegian_stem.h"
+#include "../../src/portuguese_stem.h"
+#include "../../src/russian_stem.h"
+#include "../../src/spanish_stem.h"
+#include "../../src/swedish_stem.h"
+#include "benchmark_data.h"
+#include "perf_counters.h"
+#include <cstdio>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace
+    {
+    // how many times the vocabulary is stemmed for each measurement (after one warm-up pass)
+    constexpr size_t COUNTER_PASSES{ 5 };
+
+    /// @brief Removes the normalization passes, without changing how suffixes are compared.
+    struct no_normalization_policy : public stemming::default_stem_policy
+        {
+        static constexpr bool assume_no_fullwidth{ true };
+        static constexpr bool skip_possessive{ true };
+        static constexpr bool skip_elisions{ true };
+        };
+
+    /// @brief Compares suffixes against only the lowercased version of a letter.
+    struct single_case_policy : public stemming::default_stem_policy
+        {
+        static constexpr bool assume_lowercase{ true };
+        };
+
+    /// @brief Runs only the inflectional steps, without the normalization passes.
+    struct light_no_normalization_policy : public no_normalization_policy
+        {
+        static constexpr bool light_stemming{ true };
+        };
+
+    /// @brief Hardware events per word.
+    struct counter_rates
+        {
+        double m_values[static_cast<size_t>(hardware_counter::counter_count)]{};
+
+        [[nodiscard]]
+        double get(const hardware_counter counter) const noexcept
+            { return m_values[static_cast<size_t>(counter)]; }
+
+        counter_rates operator-(const counter_rates& that) const noexcept
+            {
+            counter_rates difference;
+            for (size_t i = 0; i < std::size(m_values); ++i)
+                { difference.m_values[i] = m_values[i] - that.m_values[i]; }
+            return difference;
+            }
+        };
+
+    /// @returns The hardware events per word of stemming @c words.
+    template<typename Tstemmer>
+    counter_rates CountStemming(perf_counters& counters, const std::vector<std::wstring>& words)
+        {
+        Tstemmer stemmer;
+        std::wstring buffer;
+        buffer.reserve(64);
+        size_t stemmedLength{ 0 };
+        const auto stemAll = [&]()
+            {
+            for (const auto& word : words)
+                {
+                buffer.assign(word);
+                stemmer(buffer);
+                stemmedLength += buffer.length();
+                }
+            };
+
+        stemAll();
+        counters.start();
+        for (size_t pass = 0; pass < COUNTER_PASSES; ++pass)
+            { stemAll(); }
+        counters.stop();
+        // keep the stemming from being optimized away
+        REQUIRE(stemmedLength > 0);
+
+        const auto values = counters.read();
+        counter_rates rates;
+        const auto wordCount = static_cast<double>(words.size() * COUNTER_PASSES);
+        for (size_t i = 0; i < values.size(); ++i)
+            { rates.m_values[i] = static_cast<double>(values[i]) / wordCount; }
+        return rates;
+        }
+
+    void PrintCounterRow(const perf_counters& counters, const std::string& label, const counter_rates& rates)
+        {
+        std::printf("%-32s", label.c_str());
+        for (size_t i = 0; i < static_cast<size_t>(hardware_counter::counter_count); ++i)
+            {
+            if (counters.is_available(static_cast<hardware_counter>(i)))
+                { std::printf(" %13.2f", rates.m_values[i]); }
+            else
+                { std::printf(" %13s", "n/a"); }
+            if (static_cast<hardware_counter>(i) == hardware_counter::cycles)
+                {
+                const bool hasIpc = counters.is_available(hardware_counter::instructions) &&
+                    counters.is_available(hardware_counter::cycles) &&
+                    rates.get(hardware_counter::cycles) > 0;
+                if (hasIpc)
+                    {
+                    std::printf(" %6.2f", rates.get(hardware_counter::instructions) /
+                                          rates.get(hardware_counter::cycles));
+                    }
+                else
+                    { std::printf(" %6s", "n/a"); }
+                }
+            }
+        std::printf("\n");
+        }
+
+    template<template<typename, typename> class Tstemmer>
+    void CountLanguage(const std::string& language, const std::string& vocabularyFolder)
+        {
+        perf_counters counters;
+        if (!counters.is_available())
+            {
+            WARN("Hardware counters are unavailable (" << counters.get_error() << "); "
+                 "inside a container, the seccomp profile may block perf_event_open(), "
+                 "and /proc/sys/kernel/perf_event_paranoid must be 2 or lower.");
+            return;
+            }
+        if (!counters.get_error().empty())
+            { WARN("Some hardware counters are unavailable (" << counters.get_error() << ")"); }
+
+        // the words in alphabetical order would make the branches unrealistically predictable
+        const auto words =
+            ToZipfStream(LoadBenchmarkVocabulary(vocabularyFolder + "/voc.txt"), ZIPF_STREAM_LENGTH);
+        REQUIRE_FALSE(words.m_words.empty());
+
+        const auto full =
+            CountStemming<Tstemmer<std::wstring, stemming::default_stem_policy>>(counters, words.m_words);
+        const auto noNormalization =
+            CountStemming<Tstemmer<std::wstring, no_normalization_policy>>(counters, words.m_words);
+        const auto singleCase =
+            CountStemming<Tstemmer<std::wstring, single_case_policy>>(counters, words.m_words);
+        const auto inflectional =
+            CountStemming<Tstemmer<std::wstring, light_no_normalization_policy>>(counters, words.m_words);
+
+        std::printf("\n%-32s", (language + " (per word)").c_str());
+        for (size_t i = 0; i < static_cast<size_t>(hardware_counter::counter_count); ++i)
+            {
+            std::printf(" %13s", HARDWARE_COUNTER_NAMES[i]);
+            if (static_cast<hardware_counter>(i) == hardware_counter::cycles)
+                { std::printf(" %6s", "IPC"); }
+            }
+        std::printf("\n");
+        PrintCounterRow(counters, "  whole stemmer", full);
+        PrintCounterRow(counters, "  normalization passes", full - noNormalization);
+        PrintCounterRow(counters, "  two-case comparisons", full - singleCase);
+        PrintCounterRow(counters, "  inflectional steps", inflectional);
+        PrintCounterRow(counters, "  derivational steps", noNormalization - inflectional);
+        std::fflush(stdout);
+        }
+    }
+
+TEST_CASE("Danish counters", "[.][counters]")
+    { CountLanguage<stemming::danish_stem>("Danish", "danish"); }
+
+TEST_CASE("Dutch counters", "[.][counters]")
+    { CountLanguage<stemming::dutch_porter_stem>("Dutch", "dutch_porter"); }
+
+TEST_CASE("English counters", "[.][counters]")
+    { CountLanguage<stemming::english_stem>("English", "english"); }
+
+TEST_CASE("Finnish counters", "[.][counters]")
+    { CountLanguage<stemming::finnish_stem>("Finnish", "finnish"); }
+
+TEST_CASE("French counters", "[.][counters]")
+    { CountLanguage<stemming::french_stem>("French", "french"); }
+
+TEST_CASE("German counters", "[.][counters]")
+    { CountLanguage<stemming::german_stem>("German", "german"); }
+
+TEST_CASE("Italian counters", "[.][counters]")
+    { CountLanguage<stemming::italian_stem>("Italian", "italian"); }
+
+TEST_CASE("Norwegian counters", "[.][counters]")
+    { CountLanguage<stemming::norwegian_stem>("Norwegian", "norwegian"); }
+
+TEST_CASE("Portuguese counters", "[.][counters]")
+    { CountLanguage<stemming::portuguese_stem>("Portuguese", "portuguese"); }
+
+TEST_CASE("Russian counters", "[.][counters]")
+    { CountLanguage<stemming::russian_stem>("Russian", "russian"); }
+
+TEST_CASE("Spanish counters", "[.][counters]")
+    { CountLanguage<stemming::spanish_stem>("Spanish", "spanish"); }
+
+TEST_CASE("Swedish counters", "[.][counters]")
+    { CountLanguage<stemming::swedish_stem>("Swedish", "swedish"); }
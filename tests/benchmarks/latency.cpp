@@ -0,0 +1,171 @@
+// Per-call latency of the stemmers, for query-time use where the slowest calls matter more
+// than throughput. Every call is timed by itself and recorded into a histogram, and the
+// percentiles and the slowest words are printed for each language, over its Snowball vocabulary
+// and over a set of long words built to reach the slow paths (see MakeLongWords()).
+// These are hidden, so run them with "[latency]".
+//
+// Each word is stemmed several times and all of the timings go into the histogram, while a word's
+// latency in the list of slowest words is its fastest run, so that a word isn't listed
+// just because an interrupt landed on it. The cost of reading the clock is measured first
+// and subtracted from every timing.
+
+#include <catch2/catch_test_macros.hpp>
+#include "../../src/danish_stem.h"
+#include "../../src/dutch_stem.h"
+#include "../../src/english_stem.h"
+#include "../../src/finnish_stem.h"
+#include "../../src/french_stem.h"
+#include "../../src/german_stem.h"
+#include "../../src/italian_stem.h"
+#include "../../src/norwegian_stem.h"
+#include "../../src/portuguese_stem.h"
+#include "../../src/russian_stem.h"
+#include "../../src/spanish_stem.h"
+#include "../../src/swedish_stem.h"
+#include "benchmark_data.h"
+#include "latency_histogram.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace
+    {
+    // how many times each word is timed
+    constexpr size_t LATENCY_PASSES{ 5 };
+    // how many of the slowest words are listed
+    constexpr size_t SLOWEST_WORD_COUNT{ 10 };
+
+    using latency_clock = std::chrono::steady_clock;
+
+    [[nodiscard]]
+    uint64_t ElapsedNanoseconds(const latency_clock::time_point start, const latency_clock::time_point end)
+        { return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()); }
+
+    /// @returns The least time measured between two consecutive reads of the clock.
+    [[nodiscard]]
+    uint64_t MeasureClockOverhead()
+        {
+        uint64_t overhead{ UINT64_MAX };
+        for (size_t i = 0; i < 100'000; ++i)
+            {
+            const auto start = latency_clock::now();
+            const auto end = latency_clock::now();
+            overhead = std::min(overhead, ElapsedNanoseconds(start, end));
+            }
+        return overhead;
+        }
+
+    [[nodiscard]]
+    std::string ToUtf8(const std::wstring_view text)
+        {
+        std::string encoded;
+        if constexpr (sizeof(wchar_t) == sizeof(char16_t))
+            { utf8::unchecked::utf16to8(text.cbegin(), text.cend(), std::back_inserter(encoded)); }
+        else
+            { utf8::unchecked::utf32to8(text.cbegin(), text.cend(), std::back_inserter(encoded)); }
+        return encoded;
+        }
+
+    template<typename Tstemmer>
+    void ReportLatencies(Tstemmer& stemmer, const std::string& name, const benchmark_words& words,
+                         const uint64_t clockOverhead)
+        {
+        REQUIRE_FALSE(words.m_words.empty());
+        latency_histogram histogram;
+        std::vector<uint64_t> fastestRuns(words.m_words.size(), UINT64_MAX);
+        std::wstring buffer;
+        buffer.reserve(64);
+        for (size_t pass = 0; pass < LATENCY_PASSES; ++pass)
+            {
+            for (size_t i = 0; i < words.m_words.size(); ++i)
+                {
+                buffer.assign(words.m_words[i]);
+                const auto start = latency_clock::now();
+                stemmer(buffer);
+                const auto end = latency_clock::now();
+                const auto elapsed = ElapsedNanoseconds(start, end);
+                const auto latency = elapsed - std::min(elapsed, clockOverhead);
+                histogram.record(latency);
+                fastestRuns[i] = std::min(fastestRuns[i], latency);
+                }
+            }
+
+        std::printf("%-32s %9llu %7llu %7llu %7llu %7llu %7llu %9llu\n", name.c_str(),
+                    static_cast<unsigned long long>(histogram.get_count()),
+                    static_cast<unsigned long long>(histogram.get_min()),
+                    static_cast<unsigned long long>(histogram.value_at_percentile(50)),
+                    static_cast<unsigned long long>(histogram.value_at_percentile(90)),
+                    static_cast<unsigned long long>(histogram.value_at_percentile(99)),
+                    static_cast<unsigned long long>(histogram.value_at_percentile(99.9)),
+                    static_cast<unsigned long long>(histogram.get_max()));
+
+        std::vector<size_t> slowest(words.m_words.size());
+        std::iota(slowest.begin(), slowest.end(), 0);
+        const auto listed = std::min(slowest.size(), SLOWEST_WORD_COUNT);
+        std::partial_sort(slowest.begin(), slowest.begin() + listed, slowest.end(),
+            [&fastestRuns](const auto first, const auto second)
+            { return fastestRuns[first] > fastestRuns[second]; });
+        for (size_t i = 0; i < listed; ++i)
+            {
+            std::printf("    %7llu ns  %s\n", static_cast<unsigned long long>(fastestRuns[slowest[i]]),
+                        ToUtf8(words.m_words[slowest[i]]).c_str());
+            }
+        }
+
+    template<typename Tstemmer>
+    void ReportLanguageLatencies(const std::string& language, const std::string& vocabularyFolder)
+        {
+        const auto vocabulary = LoadBenchmarkVocabulary(vocabularyFolder + "/voc.txt");
+        REQUIRE_FALSE(vocabulary.m_words.empty());
+
+        const auto clockOverhead = MeasureClockOverhead();
+        std::printf("\n%-32s %9s %7s %7s %7s %7s %7s %9s\n", (language + " (ns per call)").c_str(),
+                    "calls", "min", "p50", "p90", "p99", "p99.9", "max");
+        Tstemmer stemmer;
+        ReportLatencies(stemmer, "  vocabulary", vocabulary, clockOverhead);
+        ReportLatencies(stemmer, "  long words", MakeLongWords(vocabulary), clockOverhead);
+        std::printf("  (%llu ns of clock overhead subtracted from each call)\n",
+                    static_cast<unsigned long long>(clockOverhead));
+        std::fflush(stdout);
+        }
+    }
+
+TEST_CASE("Danish latency", "[.][latency]")
+    { ReportLanguageLatencies<stemming::danish_stem<>>("Danish", "danish"); }
+
+TEST_CASE("Dutch latency", "[.][latency]")
+    { ReportLanguageLatencies<stemming::dutch_porter_stem<>>("Dutch", "dutch_porter"); }
+
+TEST_CASE("English latency", "[.][latency]")
+    { ReportLanguageLatencies<stemming::english_stem<>>("English", "english"); }
+
+TEST_CASE("Finnish latency", "[.][latency]")
+    { ReportLanguageLatencies<stemming::finnish_stem<>>("Finnish", "finnish"); }
+
+TEST_CASE("French latency", "[.][latency]")
+    { ReportLanguageLatencies<stemming::french_stem<>>("French", "french"); }
+
+TEST_CASE("German latency", "[.][latency]")
+    { ReportLanguageLatencies<stemming::german_stem<>>("German", "german"); }
+
+TEST_CASE("Italian latency", "[.][latency]")
+    { ReportLanguageLatencies<stemming::italian_stem<>>("Italian", "italian"); }
+
+TEST_CASE("Norwegian latency", "[.][latency]")
+    { ReportLanguageLatencies<stemming::norwegian_stem<>>("Norwegian", "norwegian"); }
+
+TEST_CASE("Portuguese latency", "[.][latency]")
+    { ReportLanguageLatencies<stemming::portuguese_stem<>>("Portuguese", "portuguese"); }
+
+TEST_CASE("Russian latency", "[.][latency]")
+    { ReportLanguageLatencies<stemming::russian_stem<>>("Russian", "russian"); }
+
+TEST_CASE("Spanish latency", "[.][latency]")
+    { ReportLanguageLatencies<stemming::spanish_stem<>>("Spanish", "spanish"); }
+
+TEST_CASE("Swedish latency", "[.][latency]")
+    { ReportLanguageLatencies<stemming::swedish_stem<>>("Swedish", "swedish"); }
@@ -0,0 +1,106 @@
+// A histogram of latencies in the style of HdrHistogram: values are counted exactly up to 127,
+// and above that, each power-of-two range is split into 64 buckets, so every value is
+// recorded within 1/64 (about 1.6%) of itself while the histogram stays a fixed size.
+
+#ifndef OLEAN_LATENCY_HISTOGRAM_H
+#define OLEAN_LATENCY_HISTOGRAM_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+/// @brief Records values (e.g., nanoseconds) and reports their percentiles.
+class latency_histogram
+    {
+public:
+    /// @brief Adds a value.
+    void record(const uint64_t value) noexcept
+        {
+        ++m_counts[index_of(value)];
+        ++m_count;
+        m_min = std::min(m_min, value);
+        m_max = std::max(m_max, value);
+        }
+
+    /// @brief Adds the values from another histogram.
+    void merge(const latency_histogram& that) noexcept
+        {
+        for (size_t i = 0; i < m_counts.size(); ++i)
+            { m_counts[i] += that.m_counts[i]; }
+        m_count += that.m_count;
+        m_min = std::min(m_min, that.m_min);
+        m_max = std::max(m_max, that.m_max);
+        }
+
+    /// @returns The number of values recorded.
+    [[nodiscard]]
+    uint64_t get_count() const noexcept
+        { return m_count; }
+
+    /// @returns The smallest value recorded.
+    [[nodiscard]]
+    uint64_t get_min() const noexcept
+        { return (m_count == 0) ? 0 : m_min; }
+
+    /// @returns The largest value recorded.
+    [[nodiscard]]
+    uint64_t get_max() const noexcept
+        { return m_max; }
+
+    /// @returns The value that @c percentile percent of the recorded values are at or below
+    ///     (the top of its bucket, so it is never understated).
+    /// @param percentile The percentile, from 0 to 100 (e.g., 99.9).
+    [[nodiscard]]
+    uint64_t value_at_percentile(const double percentile) const noexcept
+        {
+        if (m_count == 0)
+            { return 0; }
+        const auto target = std::max<uint64_t>(1,
+            static_cast<uint64_t>(std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 *
+                                            static_cast<double>(m_count))));
+        uint64_t cumulative{ 0 };
+        for (size_t i = 0; i < m_counts.size(); ++i)
+            {
+            cumulative += m_counts[i];
+            if (cumulative >= target)
+                { return std::min(highest_value_of(i), m_max); }
+            }
+        return m_max;
+        }
+private:
+    static constexpr unsigned SUB_BUCKET_BITS{ 7 };
+    static constexpr uint64_t SUB_BUCKET_COUNT{ 1 << SUB_BUCKET_BITS };
+    static constexpr uint64_t HALF_SUB_BUCKET_COUNT{ SUB_BUCKET_COUNT / 2 };
+    // the exact values, followed by 64 buckets for each doubling up to 2^64
+    static constexpr size_t BUCKET_COUNT{ SUB_BUCKET_COUNT + (64 - SUB_BUCKET_BITS) * HALF_SUB_BUCKET_COUNT };
+
+    [[nodiscard]]
+    static size_t index_of(const uint64_t value) noexcept
+        {
+        if (value < SUB_BUCKET_COUNT)
+            { return static_cast<size_t>(value); }
+        // how far the value's top seven bits are shifted (at least one)
+        const auto shift = static_cast<unsigned>(std::bit_width(value)) - SUB_BUCKET_BITS;
+        return static_cast<size_t>(SUB_BUCKET_COUNT + (shift - 1) * HALF_SUB_BUCKET_COUNT +
+                                   ((value >> shift) - HALF_SUB_BUCKET_COUNT));
+        }
+
+    [[nodiscard]]
+    static uint64_t highest_value_of(const size_t index) noexcept
+        {
+        if (index < SUB_BUCKET_COUNT)
+            { return index; }
+        const auto shift = static_cast<unsigned>((index - SUB_BUCKET_COUNT) / HALF_SUB_BUCKET_COUNT) + 1;
+        const uint64_t top = (index - SUB_BUCKET_COUNT) % HALF_SUB_BUCKET_COUNT + HALF_SUB_BUCKET_COUNT;
+        return ((top + 1) << shift) - 1;
+        }
+
+    std::array<uint64_t, BUCKET_COUNT> m_counts{};
+    uint64_t m_count{ 0 };
+    uint64_t m_min{ UINT64_MAX };
+    uint64_t m_max{ 0 };
+    };
+
+#endif // OLEAN_LATENCY_HISTOGRAM_H
@@ -0,0 +1,175 @@
+// Hardware performance counters (instructions, cycles, branch misses, and cache misses)
+// read through Linux's perf_event_open(). On other systems, or where the kernel does not
+// allow it (e.g., in many containers, or if /proc/sys/kernel/perf_event_paranoid is above 2),
+// the counters are simply reported as unavailable.
+
+#ifndef OLEAN_PERF_COUNTERS_H
+#define OLEAN_PERF_COUNTERS_H
+
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+/// @brief The hardware events that are counted.
+enum class hardware_counter
+    {
+    instructions,
+    cycles,
+    branch_misses,
+    l1d_misses,
+    llc_misses,
+    counter_count
+    };
+
+/// @brief Display names for the hardware events, in the order of @c hardware_counter.
+constexpr std::array<const char*, static_cast<size_t>(hardware_counter::counter_count)> HARDWARE_COUNTER_NAMES
+    { "instructions", "cycles", "branch-misses", "L1d-misses", "LLC-misses" };
+
+/// @brief Counts hardware events for the calling thread between start() and stop().
+/// @details Each event is opened on its own, so that the others are still counted
+///     if the processor (or hypervisor) does not support one of them.
+class perf_counters
+    {
+public:
+    using counter_values = std::array<uint64_t, static_cast<size_t>(hardware_counter::counter_count)>;
+
+    perf_counters()
+        {
+        m_descriptors.fill(-1);
+    #if defined(__linux__)
+        constexpr auto cacheMisses = [](const uint64_t cache)
+            {
+            return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            };
+        open(hardware_counter::instructions, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        open(hardware_counter::cycles, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        open(hardware_counter::branch_misses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+        open(hardware_counter::l1d_misses, PERF_TYPE_HW_CACHE, cacheMisses(PERF_COUNT_HW_CACHE_L1D));
+        open(hardware_counter::llc_misses, PERF_TYPE_HW_CACHE, cacheMisses(PERF_COUNT_HW_CACHE_LL));
+    #else
+        m_error = "hardware counters are only read on Linux";
+    #endif
+        }
+
+    perf_counters(const perf_counters&) = delete;
+    perf_counters& operator=(const perf_counters&) = delete;
+
+    ~perf_counters()
+        {
+    #if defined(__linux__)
+        for (const auto descriptor : m_descriptors)
+            {
+            if (descriptor != -1)
+                { ::close(descriptor); }
+            }
+    #endif
+        }
+
+    /// @returns @c true if any of the events can be counted.
+    [[nodiscard]]
+    bool is_available() const noexcept
+        {
+        for (const auto descriptor : m_descriptors)
+            {
+            if (descriptor != -1)
+                { return true; }
+            }
+        return false;
+        }
+
+    /// @returns @c true if the given event can be counted.
+    [[nodiscard]]
+    bool is_available(const hardware_counter counter) const noexcept
+        { return m_descriptors[static_cast<size_t>(counter)] != -1; }
+
+    /// @returns Why the first event that could not be counted failed to open.
+    [[nodiscard]]
+    const std::string& get_error() const noexcept
+        { return m_error; }
+
+    /// @brief Resets the counts to zero and starts counting.
+    void start() noexcept
+        {
+    #if defined(__linux__)
+        for (const auto descriptor : m_descriptors)
+            {
+            if (descriptor != -1)
+                {
+                ::ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+                ::ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+                }
+            }
+    #endif
+        }
+
+    /// @brief Stops counting.
+    void stop() noexcept
+        {
+    #if defined(__linux__)
+        for (const auto descriptor : m_descriptors)
+            {
+            if (descriptor != -1)
+                { ::ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0); }
+            }
+    #endif
+        }
+
+    /// @returns The count of each event since start() (zero for the ones that are unavailable).
+    /// @details If the kernel had to share the processor's counters between events,
+    ///     the counts are scaled up by the fraction of time that each one was counted.
+    [[nodiscard]]
+    counter_values read() const noexcept
+        {
+        counter_values values{};
+    #if defined(__linux__)
+        for (size_t i = 0; i < m_descriptors.size(); ++i)
+            {
+            // the count, the time enabled, and the time running
+            uint64_t data[3]{};
+            if (m_descriptors[i] == -1 ||
+                ::read(m_descriptors[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)))
+                { continue; }
+            values[i] = (data[2] == 0) ? 0 :
+                static_cast<uint64_t>(static_cast<double>(data[0]) *
+                                      (static_cast<double>(data[1]) / static_cast<double>(data[2])));
+            }
+    #endif
+        return values;
+        }
+private:
+#if defined(__linux__)
+    void open(const hardware_counter counter, const uint32_t type, const uint64_t config)
+        {
+        perf_event_attr attributes;
+        std::memset(&attributes, 0, sizeof(attributes));
+        attributes.size = sizeof(attributes);
+        attributes.type = type;
+        attributes.config = config;
+        attributes.disabled = 1;
+        // only count the benchmark itself (which also allows unprivileged use)
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        const auto descriptor = ::syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+        if (descriptor == -1 && m_error.empty())
+            {
+            m_error = std::string{ HARDWARE_COUNTER_NAMES[static_cast<size_t>(counter)] } + ": " +
+                std::strerror(errno);
+            }
+        m_descriptors[static_cast<size_t>(counter)] = static_cast<int>(descriptor);
+        }
+#endif
+
+    std::array<int, static_cast<size_t>(hardware_counter::counter_count)> m_descriptors{};
+    std::string m_error;
+    };
+
+#endif // OLEAN_PERF_COUNTERS_H
@@ -0,0 +1,130 @@
+// What each policy (and the German stemmer's umlaut option) saves: each stemmer is timed with
+// each policy on a Zipf-weighted stream of (lowercase) words drawn from its vocabulary.
+// Every stemmer normalizes its input, but which passes a policy removes differs by language
+// (e.g., only French removes elisions). Note that assume_lowercase (and so prenormalized)
+// also makes every suffix comparison check one case instead of two, so its savings are not
+// only from the lowercasing pass. These are hidden, so run them with "[policy]".
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "../../src/danish_stem.h"
+#include "../../src/dutch_stem.h"
+#include "../../src/english_stem.h"
+#include "../../src/finnish_stem.h"
+#include "../../src/french_stem.h"
+#include "../../src/german_stem.h"
+#include "../../src/italian_stem.h"
+#include "../../src/norwegian_stem.h"
+#include "../../src/portuguese_stem.h"
+#include "../../src/russian_stem.h"
+#include "../../src/spanish_stem.h"
+#include "../../src/swedish_stem.h"
+#include "benchmark_data.h"
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace
+    {
+    // policies which each remove one pass from the stemmers
+    struct assume_lowercase_policy : public stemming::default_stem_policy
+        { static constexpr bool assume_lowercase{ true }; };
+
+    struct assume_no_fullwidth_policy : public stemming::default_stem_policy
+        { static constexpr bool assume_no_fullwidth{ true }; };
+
+    struct skip_possessive_policy : public stemming::default_stem_policy
+        { static constexpr bool skip_possessive{ true }; };
+
+    struct skip_elisions_policy : public stemming::default_stem_policy
+        { static constexpr bool skip_elisions{ true }; };
+
+    template<typename Tstemmer>
+    void BenchmarkStemmer(Tstemmer& stemmer, const std::string& language, const std::string& variant,
+                          const benchmark_words& words)
+        {
+        const std::string name{ language + " (" + variant + ")" };
+        RegisterWorkload(name, language, variant, words);
+        BENCHMARK(std::string{ name }) { return StemWords(words.m_words, stemmer); };
+        }
+
+    template<template<typename, typename> class Tstemmer>
+    void BenchmarkPolicies(const std::string& language, const std::string& vocabularyFolder)
+        {
+        const auto words =
+            ToZipfStream(LoadBenchmarkVocabulary(vocabularyFolder + "/voc.txt"), ZIPF_STREAM_LENGTH);
+        REQUIRE_FALSE(words.m_words.empty());
+
+        Tstemmer<std::wstring, stemming::default_stem_policy> defaultStemmer;
+        BenchmarkStemmer(defaultStemmer, language, "default", words);
+        Tstemmer<std::wstring, stemming::lowercase_stem_policy> lowercaseStemmer;
+        BenchmarkStemmer(lowercaseStemmer, language, "fold_case", words);
+        Tstemmer<std::wstring, assume_lowercase_policy> assumeLowercaseStemmer;
+        BenchmarkStemmer(assumeLowercaseStemmer, language, "assume_lowercase", words);
+        Tstemmer<std::wstring, assume_no_fullwidth_policy> noFullWidthStemmer;
+        BenchmarkStemmer(noFullWidthStemmer, language, "assume_no_fullwidth", words);
+        Tstemmer<std::wstring, skip_possessive_policy> skipPossessiveStemmer;
+        BenchmarkStemmer(skipPossessiveStemmer, language, "skip_possessive", words);
+        Tstemmer<std::wstring, skip_elisions_policy> skipElisionsStemmer;
+        BenchmarkStemmer(skipElisionsStemmer, language, "skip_elisions", words);
+        Tstemmer<std::wstring, stemming::prenormalized_stem_policy> prenormalizedStemmer;
+        BenchmarkStemmer(prenormalizedStemmer, language, "prenormalized", words);
+        Tstemmer<std::wstring, stemming::light_stem_policy> lightStemmer;
+        BenchmarkStemmer(lightStemmer, language, "light", words);
+        }
+    }
+
+TEST_CASE("Danish policies", "[.][policy]")
+    { BenchmarkPolicies<stemming::danish_stem>("Danish", "danish"); }
+
+TEST_CASE("Dutch policies", "[.][policy]")
+    { BenchmarkPolicies<stemming::dutch_porter_stem>("Dutch", "dutch_porter"); }
+
+TEST_CASE("English policies", "[.][policy]")
+    { BenchmarkPolicies<stemming::english_stem>("English", "english"); }
+
+TEST_CASE("Finnish policies", "[.][policy]")
+    { BenchmarkPolicies<stemming::finnish_stem>("Finnish", "finnish"); }
+
+TEST_CASE("French policies", "[.][policy]")
+    { BenchmarkPolicies<stemming::french_stem>("French", "french"); }
+
+TEST_CASE("German policies", "[.][policy]")
+    { BenchmarkPolicies<stemming::german_stem>("German", "german"); }
+
+TEST_CASE("Italian policies", "[.][policy]")
+    { BenchmarkPolicies<stemming::italian_stem>("Italian", "italian"); }
+
+TEST_CASE("Norwegian policies", "[.][policy]")
+    { BenchmarkPolicies<stemming::norwegian_stem>("Norwegian", "norwegian"); }
+
+TEST_CASE("Portuguese policies", "[.][policy]")
+    { BenchmarkPolicies<stemming::portuguese_stem>("Portuguese", "portuguese"); }
+
+TEST_CASE("Russian policies", "[.][policy]")
+    { BenchmarkPolicies<stemming::russian_stem>("Russian", "russian"); }
+
+TEST_CASE("Spanish policies", "[.][policy]")
+    { BenchmarkPolicies<stemming::spanish_stem>("Spanish", "spanish"); }
+
+TEST_CASE("Swedish policies", "[.][policy]")
+    { BenchmarkPolicies<stemming::swedish_stem>("Swedish", "swedish"); }
+
+TEST_CASE("German options", "[.][policy]")
+    {
+    const auto vocabulary = LoadBenchmarkVocabulary("german/voc.txt");
+    REQUIRE_FALSE(vocabulary.m_words.empty());
+    // compounds are the longest words, so they are benchmarked separately
+    std::vector<std::wstring> compounds;
+    std::copy_if(vocabulary.m_words.cbegin(), vocabulary.m_words.cend(), std::back_inserter(compounds),
+        [](const auto& word) { return word.length() >= 15; });
+    const auto compoundWords = MakeBenchmarkWords(std::move(compounds));
+    REQUIRE_FALSE(compoundWords.m_words.empty());
+    const auto words = ToZipfStream(vocabulary, ZIPF_STREAM_LENGTH);
+
+    stemming::german_stem germanStemmer;
+    BenchmarkStemmer(germanStemmer, "German", "compounds", compoundWords);
+    germanStemmer.should_transliterate_umlauts(false);
+    BenchmarkStemmer(germanStemmer, "German", "no transliteration", words);
+    }
@@ -0,0 +1,437 @@
+// Microbenchmarks of the base stemmer's building blocks (finding the R sections, comparing
+// and deleting suffixes, hashing, and normalizing), each timed in isolation.
+// The words are Zipf-weighted streams drawn from the Snowball vocabularies, so that they
+// follow the word lengths (and letters) of running text. "Word copy" times copying each
+// word into the work buffer, which every other benchmark here also does, as a baseline.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "../../src/english_stem.h"
+#include "../../src/russian_stem.h"
+#include "benchmark_data.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace
+    {
+    constexpr wchar_t ENGLISH_VOWELS[] = L"aeiouyAEIOUY";
+    }
+
+/// @brief Exposes the base stemmer's protected functions so that they can be timed by themselves.
+class primitive_stem final : public stemming::stem<std::wstring>
+    {
+public:
+    using base = stemming::stem<std::wstring>;
+
+    using base::find_r1;
+    using base::find_r2;
+    using base::find_spanish_rv;
+    using base::find_french_rv;
+    using base::find_russian_rv;
+    using base::get_r1;
+    using base::get_r2;
+    using base::get_rv;
+    using base::set_r1;
+    using base::set_r2;
+    using base::set_rv;
+    using base::is_suffix;
+    using base::delete_if_is_in_r1;
+    using base::delete_if_is_in_r2;
+    using base::delete_if_is_in_rv;
+    using base::hash_y;
+    using base::unhash_y;
+    using base::replace_all;
+
+    void operator()([[maybe_unused]] std::wstring& text) final
+        {}
+
+    [[nodiscard]]
+    stemming::stemming_type get_language() const noexcept final
+        { return stemming::stemming_type::no_stemming; }
+    };
+
+// Copies each word into one reused buffer and calls @c function on it.
+template<typename Tfunction>
+size_t ForEachWord(const std::vector<std::wstring>& words, Tfunction function)
+    {
+    std::wstring buffer;
+    buffer.reserve(64);
+    size_t total{ 0 };
+    for (size_t i = 0; i < words.size(); ++i)
+        {
+        buffer.assign(words[i]);
+        total += function(buffer, i);
+        }
+    return total;
+    }
+
+// Loads a vocabulary as a Zipf-weighted stream, registering it under each benchmark name.
+benchmark_words LoadPrimitiveWorkload(const std::string& vocabularyFolder, const std::string& language,
+                                      const std::vector<std::string>& benchmarkNames)
+    {
+    const auto words =
+        ToZipfStream(LoadBenchmarkVocabulary(vocabularyFolder + "/voc.txt"), ZIPF_STREAM_LENGTH);
+    for (const auto& name : benchmarkNames)
+        { RegisterWorkload(name, "primitives", language, words); }
+    return words;
+    }
+
+TEST_CASE("R sections", "[primitives]")
+    {
+    const auto english = LoadPrimitiveWorkload("english", "English",
+        { "Word copy", "find_r1", "find_r2" });
+    const auto spanish = LoadPrimitiveWorkload("spanish", "Spanish", { "find_spanish_rv" });
+    const auto french = LoadPrimitiveWorkload("french", "French", { "find_french_rv" });
+    const auto russian = LoadPrimitiveWorkload("russian", "Russian", { "find_russian_rv" });
+    REQUIRE_FALSE(english.m_words.empty());
+    REQUIRE_FALSE(spanish.m_words.empty());
+    REQUIRE_FALSE(french.m_words.empty());
+    REQUIRE_FALSE(russian.m_words.empty());
+
+    primitive_stem stemmer;
+    BENCHMARK("Word copy")
+        {
+        return ForEachWord(english.m_words,
+            [](const auto& word, [[maybe_unused]] const size_t index) { return word.length(); });
+        };
+
+    BENCHMARK("find_r1")
+        {
+        return ForEachWord(english.m_words,
+            [&stemmer](const auto& word, [[maybe_unused]] const size_t index)
+            {
+            stemmer.find_r1(word, ENGLISH_VOWELS);
+            return stemmer.get_r1();
+            });
+        };
+
+    // R2 starts its search from R1, so R1 is found beforehand for each word
+    std::vector<size_t> englishR1(english.m_words.size());
+    for (size_t i = 0; i < english.m_words.size(); ++i)
+        {
+        stemmer.find_r1(english.m_words[i], ENGLISH_VOWELS);
+        englishR1[i] = stemmer.get_r1();
+        }
+    BENCHMARK("find_r2")
+        {
+        return ForEachWord(english.m_words,
+            [&stemmer, &englishR1](const auto& word, const size_t index)
+            {
+            stemmer.set_r1(englishR1[index]);
+            stemmer.find_r2(word, ENGLISH_VOWELS);
+            return stemmer.get_r2();
+            });
+        };
+
+    BENCHMARK("find_spanish_rv")
+        {
+        return ForEachWord(spanish.m_words,
+            [&stemmer](const auto& word, [[maybe_unused]] const size_t index)
+            {
+            stemmer.find_spanish_rv(word, stemming::SPANISH_VOWELS);
+            return stemmer.get_rv();
+            });
+        };
+
+    BENCHMARK("find_french_rv")
+        {
+        return ForEachWord(french.m_words,
+            [&stemmer](const auto& word, [[maybe_unused]] const size_t index)
+            {
+            stemmer.find_french_rv(word, stemming::FRENCH_VOWELS);
+            return stemmer.get_rv();
+            });
+        };
+
+    BENCHMARK("find_russian_rv")
+        {
+        return ForEachWord(russian.m_words,
+            [&stemmer](const auto& word, [[maybe_unused]] const size_t index)
+            {
+            stemmer.find_russian_rv(word, stemming::RUSSIAN_VOWELS);
+            return stemmer.get_rv();
+            });
+        };
+    }
+
+TEST_CASE("Suffix comparisons", "[primitives]")
+    {
+    const auto english = LoadPrimitiveWorkload("english", "English",
+        { "is_suffix (1 letter)", "is_suffix (2 letters)", "is_suffix (3 letters)",
+          "is_suffix (4 letters)", "is_suffix (5 letters)", "is_suffix (6 letters)",
+          "is_suffix (7 letters)", "is_suffix (8 letters)", "is_suffix (9 letters)" });
+    REQUIRE_FALSE(english.m_words.empty());
+
+    // common English suffixes of each length
+    BENCHMARK("is_suffix (1 letter)")
+        {
+        return ForEachWord(english.m_words,
+            [](const auto& word, [[maybe_unused]] const size_t index)
+            { return primitive_stem::is_suffix(word, L's', L'S'); });
+        };
+    BENCHMARK("is_suffix (2 letters)")
+        {
+        return ForEachWord(english.m_words,
+            [](const auto& word, [[maybe_unused]] const size_t index)
+            { return primitive_stem::is_suffix(word, L'e', L'E', L'd', L'D'); });
+        };
+    BENCHMARK("is_suffix (3 letters)")
+        {
+        return ForEachWord(english.m_words,
+            [](const auto& word, [[maybe_unused]] const size_t index)
+            { return primitive_stem::is_suffix(word, L'i', L'I', L'n', L'N', L'g', L'G'); });
+        };
+    BENCHMARK("is_suffix (4 letters)")
+        {
+        return ForEachWord(english.m_words,
+            [](const auto& word, [[maybe_unused]] const size_t index)
+            { return primitive_stem::is_suffix(word, L'n', L'N', L'e', L'E', L's', L'S', L's', L'S'); });
+        };
+    BENCHMARK("is_suffix (5 letters)")
+        {
+        return ForEachWord(english.m_words,
+            [](const auto& word, [[maybe_unused]] const size_t index)
+            {
+            return primitive_stem::is_suffix(word, L'a', L'A', L't', L'T', L'i', L'I', L'o', L'O',
+                                             L'n', L'N');
+            });
+        };
+    BENCHMARK("is_suffix (6 letters)")
+        {
+        return ForEachWord(english.m_words,
+            [](const auto& word, [[maybe_unused]] const size_t index)
+            {
+            return primitive_stem::is_suffix(word, L'i', L'I', L'c', L'C', L'a', L'A', L'l', L'L',
+                                             L'l', L'L', L'y', L'Y');
+            });
+        };
+    BENCHMARK("is_suffix (7 letters)")
+        {
+        return ForEachWord(english.m_words,
+            [](const auto& word, [[maybe_unused]] const size_t index)
+            {
+            return primitive_stem::is_suffix(word, L'a', L'A', L't', L'T', L'i', L'I', L'o', L'O',
+                                             L'n', L'N', L'a', L'A', L'l', L'L');
+            });
+        };
+    BENCHMARK("is_suffix (8 letters)")
+        {
+        return ForEachWord(english.m_words,
+            [](const auto& word, [[maybe_unused]] const size_t index)
+            {
+            return primitive_stem::is_suffix(word, L'i', L'I', L'z', L'Z', L'a', L'A', L't', L'T',
+                                             L'i', L'I', L'o', L'O', L'n', L'N', L's', L'S');
+            });
+        };
+    BENCHMARK("is_suffix (9 letters)")
+        {
+        return ForEachWord(english.m_words,
+            [](const auto& word, [[maybe_unused]] const size_t index)
+            {
+            return primitive_stem::is_suffix(word, L'a', L'A', L't', L'T', L'i', L'I', L'v', L'V',
+                                             L'e', L'E', L'n', L'N', L'e', L'E', L's', L'S', L's', L'S');
+            });
+        };
+    }
+
+TEST_CASE("Suffix deletions", "[primitives]")
+    {
+    const auto english = LoadPrimitiveWorkload("english", "English",
+        { "delete_if_is_in_r1", "delete_if_is_in_r2" });
+    const auto spanish = LoadPrimitiveWorkload("spanish", "Spanish", { "delete_if_is_in_rv" });
+    REQUIRE_FALSE(english.m_words.empty());
+    REQUIRE_FALSE(spanish.m_words.empty());
+
+    // the R sections are found beforehand, so that only the comparison and deletion are timed
+    primitive_stem stemmer;
+    std::vector<size_t> englishR1(english.m_words.size());
+    std::vector<size_t> englishR2(english.m_words.size());
+    for (size_t i = 0; i < english.m_words.size(); ++i)
+        {
+        stemmer.find_r1(english.m_words[i], ENGLISH_VOWELS);
+        stemmer.find_r2(english.m_words[i], ENGLISH_VOWELS);
+        englishR1[i] = stemmer.get_r1();
+        englishR2[i] = stemmer.get_r2();
+        }
+    std::vector<size_t> spanishRv(spanish.m_words.size());
+    for (size_t i = 0; i < spanish.m_words.size(); ++i)
+        {
+        stemmer.find_spanish_rv(spanish.m_words[i], stemming::SPANISH_VOWELS);
+        spanishRv[i] = stemmer.get_rv();
+        }
+
+    BENCHMARK("delete_if_is_in_r1")
+        {
+        return ForEachWord(english.m_words,
+            [&](auto& word, const size_t index)
+            {
+            stemmer.set_r1(englishR1[index]);
+            stemmer.set_r2(englishR2[index]);
+            return stemmer.delete_if_is_in_r1(word, L'i', L'I', L'n', L'N', L'g', L'G', false);
+            });
+        };
+
+    BENCHMARK("delete_if_is_in_r2")
+        {
+        return ForEachWord(english.m_words,
+            [&](auto& word, const size_t index)
+            {
+            stemmer.set_r1(englishR1[index]);
+            stemmer.set_r2(englishR2[index]);
+            return stemmer.delete_if_is_in_r2(word, L'n', L'N', L'e', L'E', L's', L'S', L's', L'S',
+                                              false);
+            });
+        };
+
+    BENCHMARK("delete_if_is_in_rv")
+        {
+        return ForEachWord(spanish.m_words,
+            [&](auto& word, const size_t index)
+            {
+            stemmer.set_rv(spanishRv[index]);
+            return stemmer.delete_if_is_in_rv(word, L'a', L'A', L'n', L'N', L'd', L'D', L'o', L'O',
+                                              false);
+            });
+        };
+    }
+
+TEST_CASE("Hashing and normalization", "[primitives]")
+    {
+    const auto english = LoadPrimitiveWorkload("english", "English",
+        { "hash_y", "unhash_y", "full_width_to_narrow", "full_width_to_narrow (full-width text)" });
+    const auto german = LoadPrimitiveWorkload("german", "German",
+        { "replace_all (letter with letter)", "replace_all (letter with text)",
+          "replace_all (text with letter)", "replace_all (text with text)" });
+    REQUIRE_FALSE(english.m_words.empty());
+    REQUIRE_FALSE(german.m_words.empty());
+
+    primitive_stem stemmer;
+    BENCHMARK("hash_y")
+        {
+        return ForEachWord(english.m_words,
+            [&stemmer](auto& word, [[maybe_unused]] const size_t index)
+            {
+            stemmer.hash_y(word, ENGLISH_VOWELS);
+            return static_cast<size_t>(word[0]);
+            });
+        };
+
+    std::vector<std::wstring> hashedWords{ english.m_words };
+    for (auto& word : hashedWords)
+        { stemmer.hash_y(word, ENGLISH_VOWELS); }
+    BENCHMARK("unhash_y")
+        {
+        return ForEachWord(hashedWords,
+            [&stemmer](auto& word, [[maybe_unused]] const size_t index)
+            {
+            stemmer.unhash_y(word);
+            return static_cast<size_t>(word[0]);
+            });
+        };
+
+    BENCHMARK("full_width_to_narrow")
+        {
+        return ForEachWord(english.m_words,
+            [](auto& word, [[maybe_unused]] const size_t index)
+            {
+            std::transform(word.cbegin(), word.cend(), word.begin(), stemming::full_width_to_narrow);
+            return static_cast<size_t>(word[0]);
+            });
+        };
+
+    // the same words, written with full-width letters (as in East Asian text)
+    std::vector<std::wstring> fullWidthWords{ english.m_words };
+    for (auto& word : fullWidthWords)
+        {
+        std::transform(word.cbegin(), word.cend(), word.begin(),
+            [](const auto ch)
+            { return (ch >= 0x21 && ch <= 0x7E) ? static_cast<wchar_t>(ch + 65'248) : ch; });
+        }
+    BENCHMARK("full_width_to_narrow (full-width text)")
+        {
+        return ForEachWord(fullWidthWords,
+            [](auto& word, [[maybe_unused]] const size_t index)
+            {
+            std::transform(word.cbegin(), word.cend(), word.begin(), stemming::full_width_to_narrow);
+            return static_cast<size_t>(word[0]);
+            });
+        };
+
+    // the replacements that the German stemmer makes (or used to)
+    BENCHMARK("replace_all (letter with letter)")
+        {
+        return ForEachWord(german.m_words,
+            [](auto& word, [[maybe_unused]] const size_t index)
+            {
+            primitive_stem::replace_all(word, L'y', L'Y');
+            return word.length();
+            });
+        };
+    BENCHMARK("replace_all (letter with text)")
+        {
+        return ForEachWord(german.m_words,
+            [](auto& word, [[maybe_unused]] const size_t index)
+            {
+            primitive_stem::replace_all(word, L'ß', L"ss");
+            return word.length();
+            });
+        };
+    BENCHMARK("replace_all (text with letter)")
+        {
+        return ForEachWord(german.m_words,
+            [](auto& word, [[maybe_unused]] const size_t index)
+            {
+            primitive_stem::replace_all(word, L"ae", L'ä');
+            return word.length();
+            });
+        };
+    BENCHMARK("replace_all (text with text)")
+        {
+        return ForEachWord(german.m_words,
+            [](auto& word, [[maybe_unused]] const size_t index)
+            {
+            primitive_stem::replace_all(word, L"ue", L"ü");
+            return word.length();
+            });
+        };
+    }
+
+TEST_CASE("English lookups", "[primitives]")
+    {
+    const auto english = LoadPrimitiveWorkload("english", "English",
+        { "Packed tails", "R1 prefix trie", "Exception table" });
+    REQUIRE_FALSE(english.m_words.empty());
+
+    BENCHMARK("Packed tails")
+        {
+        return ForEachWord(english.m_words,
+            [](const auto& word, [[maybe_unused]] const size_t index)
+            {
+            const auto tail = stemming::packed_tail::pack<false>(word);
+            return static_cast<size_t>(tail.ends_with("ational")) + tail.ends_with("ization") +
+                tail.ends_with("fulness");
+            });
+        };
+
+    constexpr stemming::prefix_trie<43> r1Prefixes{ L"gener", L"commun", L"arsen", L"past",
+                                                    L"univers", L"later", L"emerg", L"organ" };
+    BENCHMARK("R1 prefix trie")
+        {
+        return ForEachWord(english.m_words,
+            [&r1Prefixes](const auto& word, [[maybe_unused]] const size_t index)
+            { return static_cast<size_t>(r1Prefixes.match_prefix<false>(word)); });
+        };
+
+    BENCHMARK("Exception table")
+        {
+        return ForEachWord(english.m_words,
+            [](const auto& word, [[maybe_unused]] const size_t index)
+            {
+            if (word.length() < 2 || word.length() > stemming::ENGLISH_EXCEPTION_MAX_LENGTH)
+                { return size_t{ 0 }; }
+            return static_cast<size_t>(stemming::ENGLISH_EXCEPTION_TABLE[
+                stemming::hash_english_exception(word[0], word[1], word.length())]);
+            });
+        };
+    }
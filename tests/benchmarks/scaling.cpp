@@ -0,0 +1,271 @@
+// Measures how the stemmers scale across threads, for the ways that they can be deployed:
+//   - "per thread": each thread constructs its own stemmer (on its own stack);
+//   - "adjacent": each thread uses its own stemmer, but the stemmers are next to each other in one
+//     array, as they would be in a pool. A stemmer is only a few dozen bytes, so neighbors share
+//     cache lines, and writing m_r1, m_r2, and m_rv on every word causes false sharing;
+//   - "padded": the same array, but with each stemmer on its own cache line;
+//   - "mutex": one stemmer shared by all of the threads, locked around each call.
+//
+// Usage: OleanderStemScaling [--language <name>] [--threads <max>] [--pin]
+//
+// Every thread stems the same running-text stream (see RunningTextOptions()), so the work grows
+// with the threads; efficiency is the throughput divided by the single-thread throughput times
+// the number of threads (1.0 is perfect scaling). Thread counts double from 1 up to the maximum
+// (which defaults to the number of hardware threads), and each is the best of several runs.
+// With --pin, each thread is bound to its own logical processor (on Linux and Windows)
+// to reduce the noise from threads migrating between processors.
+
+#include "../../src/danish_stem.h"
+#include "../../src/dutch_stem.h"
+#include "../../src/english_stem.h"
+#include "../../src/finnish_stem.h"
+#include "../../src/french_stem.h"
+#include "../../src/german_stem.h"
+#include "../../src/italian_stem.h"
+#include "../../src/norwegian_stem.h"
+#include "../../src/portuguese_stem.h"
+#include "../../src/russian_stem.h"
+#include "../../src/spanish_stem.h"
+#include "../../src/swedish_stem.h"
+#include "benchmark_data.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <latch>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#if defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#elif defined(_WIN32)
+    #define NOMINMAX
+    #include <windows.h>
+#endif
+
+namespace
+    {
+    // how many times each thread count is run (the fastest run is reported)
+    constexpr size_t SCALING_RUNS{ 3 };
+    // the cache line size of current x86 and ARM processors
+    // (std::hardware_destructive_interference_size isn't available everywhere yet)
+    constexpr size_t CACHE_LINE_SIZE{ 64 };
+
+    bool pinThreads{ false };
+
+    /// @brief Binds the calling thread to a logical processor.
+    /// @returns @c false if threads can't be pinned on this system.
+    bool PinThread(const size_t processor)
+        {
+    #if defined(__linux__)
+        cpu_set_t processors;
+        CPU_ZERO(&processors);
+        CPU_SET(processor % CPU_SETSIZE, &processors);
+        return pthread_setaffinity_np(pthread_self(), sizeof(processors), &processors) == 0;
+    #elif defined(_WIN32)
+        return SetThreadAffinityMask(GetCurrentThread(),
+                                     DWORD_PTR{ 1 } << (processor % (sizeof(DWORD_PTR) * 8))) != 0;
+    #else
+        (void)processor;
+        return false;
+    #endif
+        }
+
+    /// @brief Runs @c work on @c threadCount threads at once.
+    /// @returns The time (in nanoseconds) from starting them all to the last one finishing.
+    double RunThreads(const size_t threadCount, const std::function<size_t(size_t)>& work)
+        {
+        std::latch ready{ static_cast<std::ptrdiff_t>(threadCount) + 1 };
+        std::latch start{ 1 };
+        std::atomic<size_t> stemmedLength{ 0 };
+        std::atomic<bool> pinFailed{ false };
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; ++i)
+            {
+            threads.emplace_back([&, i]()
+                {
+                if (pinThreads && !PinThread(i % std::max(std::thread::hardware_concurrency(), 1U)))
+                    { pinFailed = true; }
+                ready.count_down();
+                start.wait();
+                stemmedLength += work(i);
+                });
+            }
+        ready.arrive_and_wait();
+        const auto startTime = std::chrono::steady_clock::now();
+        start.count_down();
+        for (auto& thread : threads)
+            { thread.join(); }
+        const auto elapsed =
+            std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+        if (pinFailed)
+            {
+            std::cerr << "Unable to pin threads on this system.\n";
+            pinThreads = false;
+            }
+        if (stemmedLength == 0)
+            { std::cerr << "Nothing was stemmed.\n"; }
+        return elapsed;
+        }
+
+    /// @brief A stemmer alone on its cache line(s).
+    template<typename Tstemmer>
+    struct alignas(CACHE_LINE_SIZE) padded_stemmer
+        {
+        Tstemmer m_stemmer;
+        };
+
+    template<typename Tstemmer>
+    void ReportScaling(const std::vector<std::wstring>& words, const std::vector<size_t>& threadCounts)
+        {
+        const struct
+            {
+            std::string m_name;
+            std::function<double(size_t)> m_run;
+            } modes[] = {
+                { "per thread", [&words](const size_t threadCount)
+                    {
+                    return RunThreads(threadCount, [&words](size_t)
+                        {
+                        Tstemmer stemmer;
+                        return StemWords(words, stemmer);
+                        });
+                    } },
+                { "adjacent", [&words](const size_t threadCount)
+                    {
+                    std::vector<Tstemmer> stemmers(threadCount);
+                    return RunThreads(threadCount, [&words, &stemmers](const size_t thread)
+                        { return StemWords(words, stemmers[thread]); });
+                    } },
+                { "padded", [&words](const size_t threadCount)
+                    {
+                    std::vector<padded_stemmer<Tstemmer>> stemmers(threadCount);
+                    return RunThreads(threadCount, [&words, &stemmers](const size_t thread)
+                        { return StemWords(words, stemmers[thread].m_stemmer); });
+                    } },
+                { "mutex", [&words](const size_t threadCount)
+                    {
+                    Tstemmer stemmer;
+                    std::mutex stemmerMutex;
+                    return RunThreads(threadCount, [&words, &stemmer, &stemmerMutex](size_t)
+                        {
+                        std::wstring buffer;
+                        buffer.reserve(64);
+                        size_t stemmedLength{ 0 };
+                        for (const auto& word : words)
+                            {
+                            buffer.assign(word);
+                            std::lock_guard lock{ stemmerMutex };
+                            stemmer(buffer);
+                            stemmedLength += buffer.length();
+                            }
+                        return stemmedLength;
+                        });
+                    } } };
+
+        std::printf("  %-12s %8s %16s %11s\n", "mode", "threads", "words/sec", "efficiency");
+        for (const auto& mode : modes)
+            {
+            double singleThreadRate{ 0 };
+            for (const auto threadCount : threadCounts)
+                {
+                double fastest{ 0 };
+                for (size_t run = 0; run < SCALING_RUNS; ++run)
+                    {
+                    const auto elapsed = mode.m_run(threadCount);
+                    fastest = (run == 0) ? elapsed : std::min(fastest, elapsed);
+                    }
+                const double rate = static_cast<double>(words.size() * threadCount) * 1e9 / fastest;
+                if (threadCount == 1)
+                    { singleThreadRate = rate; }
+                std::printf("  %-12s %8zu %16.0f %11.2f\n", mode.m_name.c_str(), threadCount, rate,
+                            rate / (singleThreadRate * static_cast<double>(threadCount)));
+                }
+            }
+        std::fflush(stdout);
+        }
+
+    /// @brief A language, where its vocabulary is, and how to measure its stemmer's scaling.
+    struct scaled_language
+        {
+        std::string m_name;
+        std::string m_vocabulary_folder;
+        size_t m_stemmer_size{ 0 };
+        std::function<void(const std::vector<std::wstring>&, const std::vector<size_t>&)> m_report;
+        };
+
+    template<typename Tstemmer>
+    scaled_language MakeLanguage(std::string name, std::string vocabularyFolder)
+        { return { std::move(name), std::move(vocabularyFolder), sizeof(Tstemmer), ReportScaling<Tstemmer> }; }
+
+    const std::vector<scaled_language> languages
+        {
+        MakeLanguage<stemming::danish_stem<>>("Danish", "danish"),
+        MakeLanguage<stemming::dutch_porter_stem<>>("Dutch", "dutch_porter"),
+        MakeLanguage<stemming::english_stem<>>("English", "english"),
+        MakeLanguage<stemming::finnish_stem<>>("Finnish", "finnish"),
+        MakeLanguage<stemming::french_stem<>>("French", "french"),
+        MakeLanguage<stemming::german_stem<>>("German", "german"),
+        MakeLanguage<stemming::italian_stem<>>("Italian", "italian"),
+        MakeLanguage<stemming::norwegian_stem<>>("Norwegian", "norwegian"),
+        MakeLanguage<stemming::portuguese_stem<>>("Portuguese", "portuguese"),
+        MakeLanguage<stemming::russian_stem<>>("Russian", "russian"),
+        MakeLanguage<stemming::spanish_stem<>>("Spanish", "spanish"),
+        MakeLanguage<stemming::swedish_stem<>>("Swedish", "swedish")
+        };
+    }
+
+int main(int argc, char* argv[])
+    {
+    std::string languageName;
+    size_t maxThreads{ std::max<size_t>(std::thread::hardware_concurrency(), 1) };
+    for (int i = 1; i < argc; ++i)
+        {
+        const std::string option{ argv[i] };
+        if (option == "--pin")
+            { pinThreads = true; }
+        else if (option == "--language" && i + 1 < argc)
+            { languageName = argv[++i]; }
+        else if (option == "--threads" && i + 1 < argc)
+            { maxThreads = std::max<size_t>(std::stoul(argv[++i]), 1); }
+        else
+            {
+            std::cerr << "Unknown option: " << option << "\n";
+            return 1;
+            }
+        }
+
+    std::vector<size_t> threadCounts;
+    for (size_t threadCount = 1; threadCount < maxThreads; threadCount *= 2)
+        { threadCounts.push_back(threadCount); }
+    threadCounts.push_back(maxThreads);
+
+    bool foundLanguage{ false };
+    for (const auto& language : languages)
+        {
+        if (!languageName.empty() && language.m_name != languageName &&
+            language.m_vocabulary_folder != languageName)
+            { continue; }
+        foundLanguage = true;
+        const auto words = GenerateWorkload(LoadBenchmarkVocabulary(language.m_vocabulary_folder + "/voc.txt"),
+                                            RunningTextOptions(language.m_vocabulary_folder));
+        if (words.m_words.empty())
+            {
+            std::cerr << "No vocabulary for " << language.m_name << "\n";
+            return 1;
+            }
+        std::printf("\n%s (stemmer is %zu bytes)\n", language.m_name.c_str(), language.m_stemmer_size);
+        language.m_report(words.m_words, threadCounts);
+        }
+    if (!foundLanguage)
+        {
+        std::cerr << "Unknown language: " << languageName << "\n";
+        return 1;
+        }
+    return 0;
+    }
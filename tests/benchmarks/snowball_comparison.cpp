@@ -0,0 +1,269 @@
+// Compares the stemmers with the reference Snowball C stemmers (libstemmer_c), which are not
+// included with this library. To build this, configure the benchmarks with LIBSTEMMER_C_DIR
+// set to a libstemmer_c release or a Snowball build's libstemmer_c folder
+// (e.g., "cmake -DLIBSTEMMER_C_DIR=/path/to/libstemmer_c-3.0.1 ..").
+//
+// Usage: OleanderStemVsSnowball [--language <name>]
+//
+// Both libraries stem the same UTF-8 words (a Zipf-weighted stream drawn from each language's
+// Snowball vocabulary), and the best of several runs is reported for:
+//   - libstemmer_c, stemming the UTF-8 bytes;
+//   - this library, stemming words that were already decoded into wide strings;
+//   - this library, including the decoding from (and encoding back to) UTF-8.
+// Then, every word in the vocabulary is stemmed by both and the stems are compared.
+
+#include "../../src/danish_stem.h"
+#include "../../src/dutch_stem.h"
+#include "../../src/english_stem.h"
+#include "../../src/finnish_stem.h"
+#include "../../src/french_stem.h"
+#include "../../src/german_stem.h"
+#include "../../src/italian_stem.h"
+#include "../../src/norwegian_stem.h"
+#include "../../src/portuguese_stem.h"
+#include "../../src/russian_stem.h"
+#include "../../src/spanish_stem.h"
+#include "../../src/swedish_stem.h"
+#include "benchmark_data.h"
+#include <libstemmer.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+    {
+    // how many times each stream is stemmed (the fastest run is reported)
+    constexpr size_t COMPARISON_RUNS{ 5 };
+    // how many of the words whose stems differ are listed
+    constexpr size_t LISTED_DIFFERENCES{ 10 };
+
+    /// @brief A language, where its vocabulary is, and its name in libstemmer_c.
+    struct compared_language
+        {
+        std::string m_name;
+        std::string m_vocabulary_folder;
+        // older releases of libstemmer_c call Porter's Dutch algorithm "dutch"
+        std::vector<std::string> m_snowball_names;
+        std::function<std::unique_ptr<stemming::stem<>>()> m_make_stemmer;
+        };
+
+    template<typename Tstemmer>
+    std::unique_ptr<stemming::stem<>> MakeStemmer()
+        { return std::make_unique<Tstemmer>(); }
+
+    const std::vector<compared_language> languages
+        {
+        { "Danish", "danish", { "danish" }, MakeStemmer<stemming::danish_stem<>> },
+        { "Dutch", "dutch_porter", { "dutch_porter", "dutch" }, MakeStemmer<stemming::dutch_porter_stem<>> },
+        { "English", "english", { "english" }, MakeStemmer<stemming::english_stem<>> },
+        { "Finnish", "finnish", { "finnish" }, MakeStemmer<stemming::finnish_stem<>> },
+        { "French", "french", { "french" }, MakeStemmer<stemming::french_stem<>> },
+        { "German", "german", { "german" }, MakeStemmer<stemming::german_stem<>> },
+        { "Italian", "italian", { "italian" }, MakeStemmer<stemming::italian_stem<>> },
+        { "Norwegian", "norwegian", { "norwegian" }, MakeStemmer<stemming::norwegian_stem<>> },
+        { "Portuguese", "portuguese", { "portuguese" }, MakeStemmer<stemming::portuguese_stem<>> },
+        { "Russian", "russian", { "russian" }, MakeStemmer<stemming::russian_stem<>> },
+        { "Spanish", "spanish", { "spanish" }, MakeStemmer<stemming::spanish_stem<>> },
+        { "Swedish", "swedish", { "swedish" }, MakeStemmer<stemming::swedish_stem<>> }
+        };
+
+    /// @brief Frees a libstemmer_c stemmer.
+    struct snowball_deleter
+        {
+        void operator()(sb_stemmer* stemmer) const
+            { sb_stemmer_delete(stemmer); }
+        };
+
+    using snowball_stemmer = std::unique_ptr<sb_stemmer, snowball_deleter>;
+
+    void DecodeUtf8(const std::string& text, std::wstring& decoded)
+        {
+        decoded.clear();
+        if constexpr (sizeof(wchar_t) == sizeof(char16_t))
+            { utf8::unchecked::utf8to16(text.cbegin(), text.cend(), std::back_inserter(decoded)); }
+        else
+            { utf8::unchecked::utf8to32(text.cbegin(), text.cend(), std::back_inserter(decoded)); }
+        }
+
+    void EncodeUtf8(const std::wstring& text, std::string& encoded)
+        {
+        encoded.clear();
+        if constexpr (sizeof(wchar_t) == sizeof(char16_t))
+            { utf8::unchecked::utf16to8(text.cbegin(), text.cend(), std::back_inserter(encoded)); }
+        else
+            { utf8::unchecked::utf32to8(text.cbegin(), text.cend(), std::back_inserter(encoded)); }
+        }
+
+    [[nodiscard]]
+    std::vector<std::string> ToUtf8(const std::vector<std::wstring>& words)
+        {
+        std::vector<std::string> encoded(words.size());
+        for (size_t i = 0; i < words.size(); ++i)
+            { EncodeUtf8(words[i], encoded[i]); }
+        return encoded;
+        }
+
+    /// @returns The fastest time (in nanoseconds) of running @c stemAll, which returns
+    ///     the total length of the stems (so that the stemming isn't optimized away).
+    [[nodiscard]]
+    double FastestRun(const std::function<size_t()>& stemAll)
+        {
+        double fastest{ 0 };
+        size_t stemmedLength{ 0 };
+        for (size_t run = 0; run < COMPARISON_RUNS; ++run)
+            {
+            const auto start = std::chrono::steady_clock::now();
+            stemmedLength += stemAll();
+            const auto elapsed = std::chrono::duration<double, std::nano>(
+                std::chrono::steady_clock::now() - start).count();
+            fastest = (run == 0) ? elapsed : std::min(fastest, elapsed);
+            }
+        if (stemmedLength == 0)
+            { std::cerr << "Nothing was stemmed.\n"; }
+        return fastest;
+        }
+
+    void PrintThroughput(const std::string& label, const double nanoseconds, const benchmark_words& words)
+        {
+        std::printf("  %-36s %10.2f %14.0f %10.2f\n", label.c_str(),
+                    nanoseconds / static_cast<double>(words.m_words.size()),
+                    static_cast<double>(words.m_words.size()) * 1e9 / nanoseconds,
+                    static_cast<double>(words.m_utf8_bytes) * 1e3 / nanoseconds);
+        }
+
+    [[nodiscard]]
+    bool CompareLanguage(const compared_language& language)
+        {
+        snowball_stemmer snowball;
+        for (const auto& snowballName : language.m_snowball_names)
+            {
+            snowball.reset(sb_stemmer_new(snowballName.c_str(), "UTF_8"));
+            if (snowball)
+                { break; }
+            }
+        if (!snowball)
+            {
+            std::cerr << "libstemmer_c does not have a " << language.m_name << " stemmer\n";
+            return false;
+            }
+        const auto stemmer = language.m_make_stemmer();
+
+        const auto vocabulary = LoadBenchmarkVocabulary(language.m_vocabulary_folder + "/voc.txt");
+        if (vocabulary.m_words.empty())
+            {
+            std::cerr << "No vocabulary for " << language.m_name << "\n";
+            return false;
+            }
+        const auto stream = ToZipfStream(vocabulary, ZIPF_STREAM_LENGTH);
+        const auto streamUtf8 = ToUtf8(stream.m_words);
+
+        std::wstring buffer;
+        buffer.reserve(64);
+        std::string encoded;
+        encoded.reserve(256);
+
+        const auto snowballTime = FastestRun([&]()
+            {
+            size_t stemmedLength{ 0 };
+            for (const auto& word : streamUtf8)
+                {
+                sb_stemmer_stem(snowball.get(), reinterpret_cast<const sb_symbol*>(word.data()),
+                                static_cast<int>(word.length()));
+                stemmedLength += static_cast<size_t>(sb_stemmer_length(snowball.get()));
+                }
+            return stemmedLength;
+            });
+        const auto oleanderTime = FastestRun([&]()
+            {
+            size_t stemmedLength{ 0 };
+            for (const auto& word : stream.m_words)
+                {
+                buffer.assign(word);
+                (*stemmer)(buffer);
+                stemmedLength += buffer.length();
+                }
+            return stemmedLength;
+            });
+        const auto oleanderUtf8Time = FastestRun([&]()
+            {
+            size_t stemmedLength{ 0 };
+            for (const auto& word : streamUtf8)
+                {
+                DecodeUtf8(word, buffer);
+                (*stemmer)(buffer);
+                EncodeUtf8(buffer, encoded);
+                stemmedLength += encoded.length();
+                }
+            return stemmedLength;
+            });
+
+        std::printf("\n%-38s %10s %14s %10s\n", language.m_name.c_str(), "ns/word", "words/sec", "MB/sec");
+        PrintThroughput("libstemmer_c (UTF-8)", snowballTime, stream);
+        PrintThroughput("Oleander (wide strings)", oleanderTime, stream);
+        PrintThroughput("Oleander (UTF-8, with conversion)", oleanderUtf8Time, stream);
+
+        size_t agreements{ 0 };
+        std::vector<std::string> differences;
+        for (const auto& word : vocabulary.m_words)
+            {
+            std::string wordUtf8;
+            EncodeUtf8(word, wordUtf8);
+            const auto* snowballStem = sb_stemmer_stem(snowball.get(),
+                reinterpret_cast<const sb_symbol*>(wordUtf8.data()), static_cast<int>(wordUtf8.length()));
+            const std::string snowballResult(reinterpret_cast<const char*>(snowballStem),
+                                             static_cast<size_t>(sb_stemmer_length(snowball.get())));
+            buffer.assign(word);
+            (*stemmer)(buffer);
+            EncodeUtf8(buffer, encoded);
+            if (encoded == snowballResult)
+                { ++agreements; }
+            else if (differences.size() < LISTED_DIFFERENCES)
+                { differences.push_back(wordUtf8 + ": " + encoded + " (libstemmer_c: " + snowballResult + ")"); }
+            }
+        std::printf("  Agreement: %zu of %zu words (%.3f%%)\n", agreements, vocabulary.m_words.size(),
+                    100.0 * static_cast<double>(agreements) / static_cast<double>(vocabulary.m_words.size()));
+        for (const auto& difference : differences)
+            { std::printf("    %s\n", difference.c_str()); }
+        std::fflush(stdout);
+        return true;
+        }
+    }
+
+int main(int argc, char* argv[])
+    {
+    std::string languageName;
+    for (int i = 1; i + 1 < argc; i += 2)
+        {
+        const std::string option{ argv[i] };
+        if (option == "--language")
+            { languageName = argv[i + 1]; }
+        else
+            {
+            std::cerr << "Unknown option: " << option << "\n";
+            return 1;
+            }
+        }
+
+    bool foundLanguage{ false };
+    for (const auto& language : languages)
+        {
+        if (!languageName.empty() && language.m_name != languageName &&
+            language.m_vocabulary_folder != languageName)
+            { continue; }
+        foundLanguage = true;
+        if (!CompareLanguage(language))
+            { return 1; }
+        }
+    if (!foundLanguage)
+        {
+        std::cerr << "Unknown language: " << languageName << "\n";
+        return 1;
+        }
+    return 0;
+    }
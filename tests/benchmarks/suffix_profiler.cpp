@@ -0,0 +1,304 @@
+// Profiles how often each step's suffixes are compared and matched over a corpus,
+// and proposes an order for each step's chain of suffix comparisons that moves the
+// most frequently matched suffixes to the front.
+//
+// Usage: OleanderStemSuffixProfiler [--language <name>] [--corpus <file>] [--csv <file>]
+//
+// Without a corpus, each language's Snowball vocabulary is drawn as a Zipf-weighted
+// stream (so that common words are seen more often, as in running text). A corpus is
+// UTF-8 text, which is split on whitespace and has ASCII punctuation trimmed from its words.
+//
+// A chain of "else if" suffix comparisons stops at the first suffix that the word ends with,
+// so two suffixes can only be swapped without changing the result if no word can end with both,
+// i.e., neither one ends with the other. The proposed order keeps every such pair in its current
+// order. It is only a proposal: it is not checked against a reordered stemmer, and a chain whose
+// branches also test regions (or fall through to later suffixes) needs to be reviewed by hand.
+// The current order is estimated from each suffix's average position in its step's comparisons.
+
+#include "../../src/danish_stem.h"
+#include "../../src/dutch_stem.h"
+#include "../../src/english_stem.h"
+#include "../../src/finnish_stem.h"
+#include "../../src/french_stem.h"
+#include "../../src/german_stem.h"
+#include "../../src/italian_stem.h"
+#include "../../src/norwegian_stem.h"
+#include "../../src/portuguese_stem.h"
+#include "../../src/russian_stem.h"
+#include "../../src/spanish_stem.h"
+#include "../../src/swedish_stem.h"
+#include "../../src/stemming_statistics.h"
+#include "benchmark_data.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+    {
+    /// @brief A suffix's place in its step, now and as proposed.
+    struct profiled_suffix
+        {
+        std::wstring m_suffix;
+        stemming::suffix_statistics m_counters;
+        double m_current_position{ 0 };
+        };
+
+    /// @brief A language, where its vocabulary is, and how to run its stemmer with statistics.
+    struct profiled_language
+        {
+        std::string m_name;
+        std::string m_vocabulary_folder;
+        std::function<void(const std::vector<std::wstring>&)> m_stem_all;
+        };
+
+    template<typename Tstemmer>
+    void StemAll(const std::vector<std::wstring>& words)
+        {
+        Tstemmer stemmer;
+        std::wstring buffer;
+        for (const auto& word : words)
+            {
+            buffer.assign(word);
+            stemmer(buffer);
+            }
+        }
+
+    [[nodiscard]]
+    bool EndsWith(const std::wstring_view text, const std::wstring_view suffix) noexcept
+        { return text.length() >= suffix.length() && text.substr(text.length() - suffix.length()) == suffix; }
+
+    // Two suffixes whose order decides which one matches first.
+    [[nodiscard]]
+    bool AreOrderDependent(const std::wstring_view first, const std::wstring_view second) noexcept
+        { return EndsWith(first, second) || EndsWith(second, first); }
+
+    /** Orders the suffixes by how often they match (most first), without moving a suffix
+        ahead of an earlier one that it ends with (or that ends with it).
+        @param suffixes The suffixes, in their current order.*/
+    [[nodiscard]]
+    std::vector<size_t> ProposeOrder(const std::vector<profiled_suffix>& suffixes)
+        {
+        std::vector<size_t> order;
+        std::vector<bool> placed(suffixes.size(), false);
+        while (order.size() < suffixes.size())
+            {
+            size_t best{ suffixes.size() };
+            for (size_t candidate = 0; candidate < suffixes.size(); ++candidate)
+                {
+                if (placed[candidate])
+                    { continue; }
+                bool isBlocked{ false };
+                for (size_t earlier = 0; earlier < candidate && !isBlocked; ++earlier)
+                    {
+                    isBlocked = !placed[earlier] &&
+                        AreOrderDependent(suffixes[earlier].m_suffix, suffixes[candidate].m_suffix);
+                    }
+                if (!isBlocked &&
+                    (best == suffixes.size() ||
+                     suffixes[candidate].m_counters.m_matches > suffixes[best].m_counters.m_matches))
+                    { best = candidate; }
+                }
+            placed[best] = true;
+            order.push_back(best);
+            }
+        return order;
+        }
+
+    // The comparisons per run of a first-match chain: a run that matches suffix k makes
+    // k + 1 comparisons, and a run that matches nothing compares every suffix.
+    [[nodiscard]]
+    double EstimateTestsPerRun(const std::vector<profiled_suffix>& suffixes, const std::vector<size_t>& order,
+                               const uint64_t runs)
+        {
+        if (runs == 0)
+            { return 0; }
+        double tests{ 0 };
+        uint64_t matchedRuns{ 0 };
+        for (size_t rank = 0; rank < order.size(); ++rank)
+            {
+            tests += static_cast<double>(suffixes[order[rank]].m_counters.m_matches) * static_cast<double>(rank + 1);
+            matchedRuns += suffixes[order[rank]].m_counters.m_matches;
+            }
+        tests += static_cast<double>(runs - std::min(runs, matchedRuns)) * static_cast<double>(suffixes.size());
+        return tests / static_cast<double>(runs);
+        }
+
+    [[nodiscard]]
+    std::string ToUtf8(const std::wstring_view text)
+        {
+        std::ostringstream output;
+        stemming::stemming_statistics::write_utf8(output, text);
+        return output.str();
+        }
+
+    [[nodiscard]]
+    std::vector<std::wstring> LoadCorpus(const std::string& path)
+        {
+        std::vector<std::wstring> words;
+        std::ifstream file(path);
+        std::string line;
+        while (std::getline(file, line))
+            {
+            const auto utf16line = utf8::utf8to16(line);
+            std::wstring token;
+            for (size_t i = 0; i <= utf16line.length(); ++i)
+                {
+                const wchar_t ch = (i < utf16line.length()) ? static_cast<wchar_t>(utf16line[i]) : L' ';
+                if (!std::iswspace(ch))
+                    {
+                    token += ch;
+                    continue;
+                    }
+                const auto isPunctuation = [](const wchar_t letter)
+                    { return letter < 128 && std::iswpunct(letter); };
+                while (!token.empty() && isPunctuation(token.back()))
+                    { token.pop_back(); }
+                const auto firstLetter = std::find_if_not(token.cbegin(), token.cend(), isPunctuation);
+                if (firstLetter != token.cend())
+                    { words.emplace_back(firstLetter, token.cend()); }
+                token.clear();
+                }
+            }
+        return words;
+        }
+
+    void ReportLanguage(const profiled_language& language, const std::vector<std::wstring>& words,
+                        std::ostream* csv)
+        {
+        auto& statistics = stemming::thread_statistics();
+        statistics.clear();
+        language.m_stem_all(words);
+
+        std::printf("\n%s (%zu words)\n", language.m_name.c_str(), words.size());
+        for (const auto& [stepName, stepSuffixes] : statistics.get_suffixes())
+            {
+            std::vector<profiled_suffix> suffixes;
+            for (const auto& [suffix, counters] : stepSuffixes)
+                {
+                suffixes.push_back({ suffix, counters,
+                    static_cast<double>(counters.m_preceding_tests) / static_cast<double>(counters.m_tests) });
+                }
+            std::stable_sort(suffixes.begin(), suffixes.end(),
+                [](const auto& first, const auto& second)
+                { return first.m_current_position < second.m_current_position; });
+
+            const auto step = statistics.get_steps().find(stepName);
+            const uint64_t runs = (step != statistics.get_steps().cend()) ? step->second.m_entries : 0;
+            uint64_t measuredTests{ 0 };
+            for (const auto& suffix : suffixes)
+                { measuredTests += suffix.m_counters.m_tests; }
+
+            std::vector<size_t> currentOrder(suffixes.size());
+            for (size_t i = 0; i < currentOrder.size(); ++i)
+                { currentOrder[i] = i; }
+            const auto proposedOrder = ProposeOrder(suffixes);
+
+            std::printf("\n  %s: %zu runs, %.2f suffix comparisons per run (estimated %.2f in the current order, "
+                        "%.2f in the proposed order)\n",
+                        stepName.empty() ? "(outside of a step)" : stepName.c_str(), static_cast<size_t>(runs),
+                        runs ? static_cast<double>(measuredTests) / static_cast<double>(runs) : 0.0,
+                        EstimateTestsPerRun(suffixes, currentOrder, runs),
+                        EstimateTestsPerRun(suffixes, proposedOrder, runs));
+            std::printf("  %6s %-16s %12s %12s %10s\n", "rank", "suffix", "matches", "tests", "position");
+            for (size_t rank = 0; rank < proposedOrder.size(); ++rank)
+                {
+                const auto& suffix = suffixes[proposedOrder[rank]];
+                std::printf("  %6zu %-16s %12llu %12llu %10.2f\n", rank + 1, ToUtf8(suffix.m_suffix).c_str(),
+                            static_cast<unsigned long long>(suffix.m_counters.m_matches),
+                            static_cast<unsigned long long>(suffix.m_counters.m_tests), suffix.m_current_position);
+                if (csv != nullptr)
+                    {
+                    *csv << language.m_name << ',' << stepName << ',' << (rank + 1) << ',' <<
+                        ToUtf8(suffix.m_suffix) << ',' << suffix.m_counters.m_matches << ',' <<
+                        suffix.m_counters.m_tests << ',' << suffix.m_current_position << "\n";
+                    }
+                }
+            }
+        }
+    }
+
+int main(int argc, char* argv[])
+    {
+    using policy = stemming::statistics_stem_policy;
+    const std::vector<profiled_language> languages
+        {
+        { "Danish", "danish", StemAll<stemming::danish_stem<std::wstring, policy>> },
+        { "Dutch", "dutch_porter", StemAll<stemming::dutch_porter_stem<std::wstring, policy>> },
+        { "English", "english", StemAll<stemming::english_stem<std::wstring, policy>> },
+        { "Finnish", "finnish", StemAll<stemming::finnish_stem<std::wstring, policy>> },
+        { "French", "french", StemAll<stemming::french_stem<std::wstring, policy>> },
+        { "German", "german", StemAll<stemming::german_stem<std::wstring, policy>> },
+        { "Italian", "italian", StemAll<stemming::italian_stem<std::wstring, policy>> },
+        { "Norwegian", "norwegian", StemAll<stemming::norwegian_stem<std::wstring, policy>> },
+        { "Portuguese", "portuguese", StemAll<stemming::portuguese_stem<std::wstring, policy>> },
+        { "Russian", "russian", StemAll<stemming::russian_stem<std::wstring, policy>> },
+        { "Spanish", "spanish", StemAll<stemming::spanish_stem<std::wstring, policy>> },
+        { "Swedish", "swedish", StemAll<stemming::swedish_stem<std::wstring, policy>> }
+        };
+
+    std::string languageName;
+    std::string corpusPath;
+    std::string csvPath;
+    for (int i = 1; i + 1 < argc; i += 2)
+        {
+        const std::string option{ argv[i] };
+        if (option == "--language")
+            { languageName = argv[i + 1]; }
+        else if (option == "--corpus")
+            { corpusPath = argv[i + 1]; }
+        else if (option == "--csv")
+            { csvPath = argv[i + 1]; }
+        else
+            {
+            std::cerr << "Unknown option: " << option << "\n";
+            return 1;
+            }
+        }
+    if (!corpusPath.empty() && languageName.empty())
+        {
+        std::cerr << "A corpus needs a --language.\n";
+        return 1;
+        }
+
+    std::ofstream csvFile;
+    if (!csvPath.empty())
+        {
+        csvFile.open(csvPath);
+        if (!csvFile)
+            {
+            std::cerr << "Unable to write " << csvPath << "\n";
+            return 1;
+            }
+        csvFile << "language,step,rank,suffix,matches,tests,current_position\n";
+        }
+
+    bool foundLanguage{ false };
+    for (const auto& language : languages)
+        {
+        if (!languageName.empty() && language.m_name != languageName &&
+            language.m_vocabulary_folder != languageName)
+            { continue; }
+        foundLanguage = true;
+        const auto words = corpusPath.empty() ?
+            ToZipfStream(LoadBenchmarkVocabulary(language.m_vocabulary_folder + "/voc.txt"),
+                         ZIPF_STREAM_LENGTH).m_words :
+            LoadCorpus(corpusPath);
+        if (words.empty())
+            {
+            std::cerr << "No words to profile for " << language.m_name << "\n";
+            return 1;
+            }
+        ReportLanguage(language, words, csvFile.is_open() ? &csvFile : nullptr);
+        }
+    if (!foundLanguage)
+        {
+        std::cerr << "Unknown language: " << languageName << "\n";
+        return 1;
+        }
+    return 0;
+    }
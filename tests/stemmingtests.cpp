@@ -13,10 +13,17 @@
 #include "../src/russian_stem.h"
 #include "../src/spanish_stem.h"
 #include "../src/swedish_stem.h"
+#include "../src/stemming_statistics.h"
 #include "utfcpp/source/utf8.h"
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <set>
+#include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 [[nodiscard]]
@@ -208,3 +215,907 @@ TEST_CASE("swedish", "[stemming][swedish]")
     stemming::swedish_stem stemmer;
     TestLanguage("swedish/voc.txt", "swedish/output.txt", stemmer);
     }
+
+TEST_CASE("lowercase policy", "[stemming][policy]")
+    {
+    using stemming::lowercase_stem_policy;
+
+    SECTION("Uppercase input is stemmed and lowercased")
+        {
+        stemming::english_stem<std::wstring, lowercase_stem_policy> englishStemmer;
+        std::wstring word{ L"DOCUMENTATION" };
+        englishStemmer(word);
+        CHECK(word == L"document");
+
+        stemming::french_stem<std::wstring, lowercase_stem_policy> frenchStemmer;
+        word = L"CONTINUELLEMENT";
+        frenchStemmer(word);
+        CHECK(word == L"continuel");
+
+        stemming::german_stem<std::wstring, lowercase_stem_policy> germanStemmer;
+        word = L"HÄUSER";
+        germanStemmer(word);
+        CHECK(word == L"haus");
+
+        stemming::russian_stem<std::wstring, lowercase_stem_policy> russianStemmer;
+        word = L"ВЕЛИКОЛЕПНЫЙ";
+        russianStemmer(word);
+        CHECK(word == L"великолепн");
+
+        stemming::no_op_stem<std::wstring, lowercase_stem_policy> noOpStemmer;
+        word = L"ÉCOLE";
+        noOpStemmer(word);
+        CHECK(word == L"école");
+        }
+
+    SECTION("Prenormalized text")
+        {
+        stemming::french_stem<std::wstring, stemming::prenormalized_stem_policy> frenchStemmer;
+        std::wstring word{ L"continuellement" };
+        frenchStemmer(word);
+        CHECK(word == L"continuel");
+        // elisions are left alone
+        word = L"l'homme";
+        frenchStemmer(word);
+        CHECK(word == L"l'homm");
+
+        stemming::english_stem<std::wstring, stemming::prenormalized_stem_policy> englishStemmer;
+        word = L"documentation";
+        englishStemmer(word);
+        CHECK(word == L"document");
+        }
+
+    SECTION("Snowball vocabularies")
+        {
+        stemming::danish_stem<std::wstring, lowercase_stem_policy> danishStemmer;
+        TestLanguage("danish/voc.txt", "danish/output.txt", danishStemmer);
+        stemming::dutch_porter_stem<std::wstring, lowercase_stem_policy> dutchStemmer;
+        TestLanguage("dutch_porter/voc.txt", "dutch_porter/output.txt", dutchStemmer);
+        stemming::english_stem<std::wstring, lowercase_stem_policy> englishStemmer;
+        TestLanguage("english/voc.txt", "english/output.txt", englishStemmer);
+        stemming::finnish_stem<std::wstring, lowercase_stem_policy> finnishStemmer;
+        TestLanguage("finnish/voc.txt", "finnish/output.txt", finnishStemmer);
+        stemming::french_stem<std::wstring, lowercase_stem_policy> frenchStemmer;
+        TestLanguage("french/voc.txt", "french/output.txt", frenchStemmer);
+        stemming::german_stem<std::wstring, lowercase_stem_policy> germanStemmer;
+        TestLanguage("german/voc.txt", "german/output.txt", germanStemmer);
+        stemming::italian_stem<std::wstring, lowercase_stem_policy> italianStemmer;
+        TestLanguage("italian/voc.txt", "italian/output.txt", italianStemmer);
+        stemming::norwegian_stem<std::wstring, lowercase_stem_policy> norwegianStemmer;
+        TestLanguage("norwegian/voc.txt", "norwegian/output.txt", norwegianStemmer);
+        stemming::portuguese_stem<std::wstring, lowercase_stem_policy> portugueseStemmer;
+        TestLanguage("portuguese/voc.txt", "portuguese/output.txt", portugueseStemmer);
+        stemming::russian_stem<std::wstring, lowercase_stem_policy> russianStemmer;
+        TestLanguage("russian/voc.txt", "russian/output.txt", russianStemmer);
+        stemming::spanish_stem<std::wstring, lowercase_stem_policy> spanishStemmer;
+        TestLanguage("spanish/voc.txt", "spanish/output.txt", spanishStemmer);
+        stemming::swedish_stem<std::wstring, lowercase_stem_policy> swedishStemmer;
+        TestLanguage("swedish/voc.txt", "swedish/output.txt", swedishStemmer);
+        }
+    }
+
+TEST_CASE("English exceptions and prefixes", "[stemming][english]")
+    {
+    SECTION("Prefix trie")
+        {
+        constexpr stemming::prefix_trie<8> prefixes{ L"past", L"gen" };
+        static_assert(prefixes.match_prefix<false>(std::wstring_view{ L"Pasture" }) == 4);
+        static_assert(prefixes.match_prefix<false>(std::wstring_view{ L"GENERAL" }) == 3);
+        static_assert(prefixes.match_prefix<true>(std::wstring_view{ L"GENERAL" }) == 0);
+        static_assert(prefixes.match_prefix<false>(std::wstring_view{ L"pas" }) == 0);
+        static_assert(prefixes.match_prefix<false>(std::wstring_view{ L"agen" }) == 0);
+        }
+
+    SECTION("Exceptions")
+        {
+        stemming::english_stem englishStemmer;
+        std::wstring word{ L"SKIES" };
+        englishStemmer(word);
+        CHECK(word == L"sky");
+        word = L"Andes";
+        englishStemmer(word);
+        CHECK(word == L"Andes");
+        // same hash as an exception, but a different word
+        word = L"skid";
+        englishStemmer(word);
+        CHECK(word == L"skid");
+        word = L"atlases";
+        englishStemmer(word);
+        CHECK(word == L"atlas");
+        }
+
+    SECTION("Exceptions starting with invalid characters")
+        {
+        // the lookup lowercases the first two letters (a table lookup for Latin-1),
+        // which must not index outside of the table for negative code units
+        static_assert(stemming::tolower_latin1_cyrillic(static_cast<wchar_t>(-1)) == static_cast<wchar_t>(-1));
+        static_assert(stemming::tolower_latin1_cyrillic(std::numeric_limits<wchar_t>::min()) ==
+                      std::numeric_limits<wchar_t>::min());
+        stemming::english_stem englishStemmer;
+        stemming::english_stem<std::wstring, stemming::lowercase_stem_policy> lowercaseStemmer;
+        for (const auto invalidCharacter : { static_cast<wchar_t>(-1), static_cast<wchar_t>(-0xE0),
+                                             std::numeric_limits<wchar_t>::min() })
+            {
+            // the lengths of the exceptions
+            for (const std::wstring& rest : { std::wstring{ L"ky" }, std::wstring{ L"kies" },
+                                              std::wstring{ L"ndes" }, std::wstring{ L"tlases" } })
+                {
+                std::wstring word{ invalidCharacter + rest };
+                englishStemmer(word);
+                CHECK(word.front() == invalidCharacter);
+                word = std::wstring(2, invalidCharacter) + rest.substr(1);
+                lowercaseStemmer(word);
+                CHECK(word.front() == invalidCharacter);
+                }
+            }
+        }
+
+    SECTION("R1 prefixes")
+        {
+        stemming::english_stem englishStemmer;
+        std::wstring word{ L"Generously" };
+        englishStemmer(word);
+        CHECK(word == L"Generous");
+        word = L"COMMUNITIES";
+        englishStemmer(word);
+        CHECK(word == L"COMMUNITI");
+        word = L"genera";
+        englishStemmer(word);
+        CHECK(word == L"genera");
+        }
+    }
+
+TEST_CASE("Packed suffixes", "[stemming][english]")
+    {
+    using stemming::packed_tail;
+    static_assert(packed_tail::pack<true>(std::wstring_view{ L"RELATIONAL" }).ends_with("ational"));
+    static_assert(packed_tail::pack<true>(std::wstring_view{ L"relational" }).ends_with("l"));
+    static_assert(!packed_tail::pack<true>(std::wstring_view{ L"relational" }).ends_with("ization"));
+    // shorter than the suffix
+    static_assert(!packed_tail::pack<true>(std::wstring_view{ L"onal" }).ends_with("tional"));
+    // only the last eight characters are packed
+    static_assert(packed_tail::pack<true>(std::wstring_view{ L"hopefulness" }).ends_with("efulness"));
+    // non-ASCII characters never match
+    static_assert(!packed_tail::pack<false>(std::wstring_view{ L"ationäl" }).ends_with("ational"));
+    static_assert(packed_tail::pack<false>(std::wstring_view{ L"émotional" }).ends_with("tional"));
+
+    stemming::english_stem englishStemmer;
+    std::wstring word{ L"RELATIONAL" };
+    englishStemmer(word);
+    CHECK(word == L"RELAT");
+    word = L"relatïonal";
+    englishStemmer(word);
+    CHECK(word == L"relatïon");
+    }
+
+TEST_CASE("French front end", "[stemming][french]")
+    {
+    stemming::french_stem frenchStemmer;
+    // elisions are removed without affecting the rest of the word
+    const std::vector<std::pair<std::wstring, std::wstring>> elisions{
+        { L"l'hommes", L"hommes" }, { L"qu'elles", L"elles" },
+        { L"'oiseaux", L"oiseaux" }, { L"d'ennuyeuses", L"ennuyeuses" } };
+    for (const auto& [elided, plain] : elisions)
+        {
+        std::wstring elidedWord{ elided };
+        std::wstring plainWord{ plain };
+        frenchStemmer(elidedWord);
+        frenchStemmer(plainWord);
+        CHECK(elidedWord == plainWord);
+        }
+    std::wstring word{ L"d'ennuyeuses" };
+    frenchStemmer(word);
+    CHECK(word == L"ennui");
+    word = L"croyaient";
+    frenchStemmer(word);
+    CHECK(word == L"croi");
+    // ë and ï are split into two characters while stemming
+    word = L"naïvement";
+    frenchStemmer(word);
+    CHECK(word == L"naïv");
+    word = L"NAÏVEMENT";
+    frenchStemmer(word);
+    CHECK(word == L"NAÏV");
+    }
+
+TEST_CASE("Attached pronouns", "[stemming][spanish][italian]")
+    {
+    constexpr stemming::suffix_trie<6> pronouns{ L"los", L"selos" };
+    static_assert(pronouns.match_suffix<false>(std::wstring_view{ L"DÁNDOSELOS" }, 10, 0).m_length == 5);
+    static_assert(pronouns.match_suffix<false>(std::wstring_view{ L"dándoselos" }, 10, 0).m_index == 1);
+    // the longest pronoun that starts in the region
+    static_assert(pronouns.match_suffix<false>(std::wstring_view{ L"dándoselos" }, 10, 6).m_length == 3);
+    static_assert(pronouns.match_suffix<false>(std::wstring_view{ L"dándoselos" }, 10, 8).m_length == 0);
+    // only the start of the word is reviewed
+    static_assert(pronouns.match_suffix<false>(std::wstring_view{ L"loslas" }, 3, 0).m_length == 3);
+    // lowercased text is compared as-is
+    static_assert(pronouns.match_suffix<true>(std::wstring_view{ L"DÁNDOSELOS" }, 10, 0).m_length == 0);
+
+    stemming::spanish_stem spanishStemmer;
+    std::wstring word{ L"comiéndolo" };
+    spanishStemmer(word);
+    CHECK(word == L"com");
+    word = L"HACIÉNDOLO";
+    spanishStemmer(word);
+    CHECK(word == L"HAC");
+    word = L"construyendolas";
+    spanishStemmer(word);
+    CHECK(word == L"constru");
+    // yendo (without a u in front of it) doesn't have its pronoun removed
+    word = L"oyendolo";
+    spanishStemmer(word);
+    CHECK(word == L"oyendol");
+
+    stemming::italian_stem italianStemmer;
+    word = L"PORTANDOLO";
+    italianStemmer(word);
+    CHECK(word == L"PORT");
+    word = L"mangiarlo";
+    italianStemmer(word);
+    CHECK(word == L"mang");
+    word = L"vederti";
+    italianStemmer(word);
+    CHECK(word == L"ved");
+    }
+
+TEST_CASE("Portuguese nasal vowels", "[stemming][portuguese]")
+    {
+    stemming::portuguese_stem portugueseStemmer;
+    std::wstring word{ L"informação" };
+    portugueseStemmer(word);
+    CHECK(word == L"inform");
+    word = L"evolução";
+    portugueseStemmer(word);
+    CHECK(word == L"evolu");
+    word = L"FALARÃO";
+    portugueseStemmer(word);
+    CHECK(word == L"FAL");
+    word = L"cantaríamos";
+    portugueseStemmer(word);
+    CHECK(word == L"cant");
+    // ã and õ are a vowel and a consonant when finding the regions, but stay as they are
+    word = L"irmão";
+    portugueseStemmer(word);
+    CHECK(word == L"irmã");
+    word = L"canções";
+    portugueseStemmer(word);
+    CHECK(word == L"cançõ");
+    }
+
+TEST_CASE("Russian suffix groups", "[stemming][russian]")
+    {
+    stemming::russian_stem russianStemmer;
+    // perfective gerund (group 1 keeps the а or я)
+    std::wstring word{ L"прочитав" };
+    russianStemmer(word);
+    CHECK(word == L"прочита");
+    word = L"находившиеся";
+    russianStemmer(word);
+    CHECK(word == L"наход");
+    // adjective, followed by a participle
+    word = L"возвращающихся";
+    russianStemmer(word);
+    CHECK(word == L"возвраща");
+    word = L"красивыми";
+    russianStemmer(word);
+    CHECK(word == L"красив");
+    // verb
+    word = L"ЧИТАЕТЕ";
+    russianStemmer(word);
+    CHECK(word == L"ЧИТА");
+    word = L"становятся";
+    russianStemmer(word);
+    CHECK(word == L"станов");
+    // ё is read as е
+    word = L"ёлками";
+    russianStemmer(word);
+    CHECK(word == L"елк");
+    word = L"ЗЕЛЁНЫЕ";
+    russianStemmer(word);
+    CHECK(word == L"ЗЕЛЕН");
+    }
+
+TEST_CASE("Finnish case endings and tidying", "[stemming][finnish]")
+    {
+    stemming::finnish_stem finnishStemmer;
+    // step 3 case endings
+    std::wstring word{ L"koulusta" };
+    finnishStemmer(word);
+    CHECK(word == L"koulu");
+    word = L"KAUPUNGISSA";
+    finnishStemmer(word);
+    CHECK(word == L"KAUPUNG");
+    word = L"huoneeseen";
+    finnishStemmer(word);
+    CHECK(word == L"huone");
+    word = L"taloon";
+    finnishStemmer(word);
+    CHECK(word == L"talo");
+    // step 6 removes several letters, including a doubled consonant before them
+    word = L"linnoja";
+    finnishStemmer(word);
+    CHECK(word == L"lino");
+    word = L"katto";
+    finnishStemmer(word);
+    CHECK(word == L"kato");
+    }
+
+TEST_CASE("German front end", "[stemming][german]")
+    {
+    stemming::german_stem germanStemmer;
+    // ß is expanded to ss
+    std::wstring word{ L"grüße" };
+    germanStemmer(word);
+    CHECK(word == L"gruss");
+    word = L"Straße";
+    germanStemmer(word);
+    CHECK(word == L"Strass");
+    // ae, oe, and ue are read as umlauts
+    word = L"maessig";
+    germanStemmer(word);
+    CHECK(word == L"massig");
+    word = L"schoener";
+    germanStemmer(word);
+    CHECK(word == L"schon");
+    word = L"fuer";
+    germanStemmer(word);
+    CHECK(word == L"fur");
+    // ...but not ue at the start of the word, or after a que
+    word = L"ueber";
+    germanStemmer(word);
+    CHECK(word == L"ueb");
+    word = L"quelltuer";
+    germanStemmer(word);
+    CHECK(word == L"quelltu");
+    // u and y between vowels are kept as consonants
+    word = L"bayerische";
+    germanStemmer(word);
+    CHECK(word == L"bayer");
+    word = L"Donaudampfschifffahrtsgesellschaften";
+    germanStemmer(word);
+    CHECK(word == L"Donaudampfschifffahrtsgesellschaft");
+    }
+
+TEST_CASE("Dutch front end", "[stemming][dutch]")
+    {
+    stemming::dutch_porter_stem dutchStemmer;
+    // umlauts and acutes are removed
+    std::wstring word{ L"coöperatie" };
+    dutchStemmer(word);
+    CHECK(word == L"cooperatie");
+    word = L"ideeën";
+    dutchStemmer(word);
+    CHECK(word == L"ideeen");
+    word = L"CAFÉS";
+    dutchStemmer(word);
+    CHECK(word == L"CAFES");
+    // full-width letters are narrowed
+    word = L"Ｍａａｎｄｅｎ";
+    dutchStemmer(word);
+    CHECK(word == L"Maand");
+    // i between vowels and initial y are kept as consonants
+    word = L"kooien";
+    dutchStemmer(word);
+    CHECK(word == L"kooi");
+    word = L"yoghurt";
+    dutchStemmer(word);
+    CHECK(word == L"yoghurt");
+    // a word that is too short to stem once its possessive is removed
+    word = L"ay's";
+    dutchStemmer(word);
+    CHECK(word == L"ay");
+
+    stemming::dutch_porter_stem<std::wstring, stemming::lowercase_stem_policy> lowercaseStemmer;
+    word = L"ÏDEEËN";
+    lowercaseStemmer(word);
+    CHECK(word == L"ideeen");
+    word = L"Ｍａａｎｄｅｎ";
+    lowercaseStemmer(word);
+    CHECK(word == L"maand");
+    }
+
+TEST_CASE("Scandinavian step 1 suffixes", "[stemming][danish][norwegian][swedish]")
+    {
+    SECTION("Danish")
+        {
+        stemming::danish_stem danishStemmer;
+        std::wstring word{ L"bilernes" };
+        danishStemmer(word);
+        CHECK(word == L"bil");
+        word = L"FORÆLDRENES";
+        danishStemmer(word);
+        CHECK(word == L"FORÆLDR");
+        // "hedens" starts before R1, so the longest suffix in R1 is "ens"
+        word = L"frihedens";
+        danishStemmer(word);
+        CHECK(word == L"frihed");
+        word = L"huses";
+        danishStemmer(word);
+        CHECK(word == L"hus");
+        }
+    SECTION("Norwegian")
+        {
+        stemming::norwegian_stem norwegianStemmer;
+        std::wstring word{ L"frihetenes" };
+        norwegianStemmer(word);
+        CHECK(word == L"frihet");
+        // erte and ert are replaced with er
+        word = L"studerte";
+        norwegianStemmer(word);
+        CHECK(word == L"studer");
+        word = L"STUDERT";
+        norwegianStemmer(word);
+        CHECK(word == L"STUDER");
+        word = L"vitenskapers";
+        norwegianStemmer(word);
+        CHECK(word == L"vitenskap");
+        word = L"bakers";
+        norwegianStemmer(word);
+        CHECK(word == L"bak");
+        // not a valid s-ending
+        word = L"eiers";
+        norwegianStemmer(word);
+        CHECK(word == L"eiers");
+        }
+    SECTION("Swedish")
+        {
+        stemming::swedish_stem swedishStemmer;
+        std::wstring word{ L"flickorna" };
+        swedishStemmer(word);
+        CHECK(word == L"flick");
+        word = L"ALLMÄNHETEN";
+        swedishStemmer(word);
+        CHECK(word == L"ALLMÄN");
+        word = L"paketet";
+        swedishStemmer(word);
+        CHECK(word == L"paket");
+        // not a valid et-ending
+        word = L"raket";
+        swedishStemmer(word);
+        CHECK(word == L"raket");
+        // ...but the s of an ets that is kept can still be removed
+        word = L"pakets";
+        swedishStemmer(word);
+        CHECK(word == L"paket");
+        }
+    }
+
+TEST_CASE("Step statistics", "[stemming][policy][statistics]")
+    {
+    auto& statistics = stemming::thread_statistics();
+
+    SECTION("Not collected by default")
+        {
+        statistics.clear();
+        stemming::english_stem<> englishStemmer;
+        std::wstring word(L"hopping");
+        englishStemmer(word);
+        CHECK(word == L"hop");
+        CHECK(statistics.get_steps().empty());
+        CHECK(statistics.get_events().empty());
+        }
+    SECTION("Steps and events")
+        {
+        statistics.clear();
+        stemming::english_stem<std::wstring, stemming::statistics_stem_policy> englishStemmer;
+        std::wstring word(L"hopping");
+        englishStemmer(word);
+        CHECK(word == L"hop");
+        word = L"ponies";
+        englishStemmer(word);
+        CHECK(word == L"poni");
+
+        const auto& steps = statistics.get_steps();
+        REQUIRE(steps.find("english::step_1a") != steps.cend());
+        REQUIRE(steps.find("english::step_1b") != steps.cend());
+        const auto& step1a = steps.find("english::step_1a")->second;
+        const auto& step1b = steps.find("english::step_1b")->second;
+        CHECK(step1a.m_entries == 2);
+        // "ies" -> "i"
+        CHECK(step1a.m_matches == 1);
+        CHECK(step1a.m_removed_lengths[2] == 1);
+        CHECK(step1b.m_entries == 2);
+        // "hopping" -> "hopp" -> "hop"
+        CHECK(step1b.m_matches == 1);
+        CHECK(step1b.m_removed_lengths[4] == 1);
+        REQUIRE(statistics.get_events().find("english::step_1b regress_trim") !=
+                statistics.get_events().cend());
+        CHECK(statistics.get_events().find("english::step_1b regress_trim")->second == 1);
+
+        // "ponies" is compared against "sses" and "ied" before matching "ies"
+        const auto& suffixes = statistics.get_suffixes();
+        REQUIRE(suffixes.find("english::step_1a") != suffixes.cend());
+        const auto& step1aSuffixes = suffixes.find("english::step_1a")->second;
+        REQUIRE(step1aSuffixes.find(L"ies") != step1aSuffixes.cend());
+        CHECK(step1aSuffixes.find(L"sses")->second.m_tests == 1);
+        CHECK(step1aSuffixes.find(L"sses")->second.m_matches == 0);
+        CHECK(step1aSuffixes.find(L"ies")->second.m_tests == 1);
+        CHECK(step1aSuffixes.find(L"ies")->second.m_matches == 1);
+        CHECK(step1aSuffixes.find(L"ies")->second.m_preceding_tests == 2);
+
+        stemming::stemming_statistics merged;
+        merged.merge(statistics);
+        merged.merge(statistics);
+        CHECK(merged.get_steps().find("english::step_1a")->second.m_entries == 4);
+        CHECK(merged.get_events().find("english::step_1b regress_trim")->second == 2);
+
+        std::ostringstream output;
+        merged.dump(output);
+        CHECK(output.str().find("step,entries,matches,cycles,removed_0,") == 0);
+        CHECK(output.str().find("\nenglish::step_1a,4,2,") != std::string::npos);
+        CHECK(output.str().find("\nenglish::step_1b regress_trim,2\n") != std::string::npos);
+        CHECK(output.str().find("\nenglish::step_1a,ies,2,2,4\n") != std::string::npos);
+        statistics.clear();
+        }
+    SECTION("Steps called by other steps")
+        {
+        statistics.clear();
+        // step 1 finds nothing to remove and calls step 2, which removes "ava"
+        stemming::portuguese_stem<std::wstring, stemming::statistics_stem_policy> portugueseStemmer;
+        std::wstring word(L"falava");
+        portugueseStemmer(word);
+        CHECK(word == L"fal");
+        const auto& steps = statistics.get_steps();
+        REQUIRE(steps.find("portuguese::step_1") != steps.cend());
+        REQUIRE(steps.find("portuguese::step_2") != steps.cend());
+        CHECK(steps.find("portuguese::step_1")->second.m_matches == 0);
+        CHECK(steps.find("portuguese::step_2")->second.m_matches == 1);
+        CHECK(steps.find("portuguese::step_2")->second.m_removed_lengths[3] == 1);
+        statistics.clear();
+        }
+    }
+
+TEST_CASE("light policy", "[stemming][policy][light]")
+    {
+    using stemming::light_stem_policy;
+
+    SECTION("Inflectional endings are removed")
+        {
+        stemming::english_stem<std::wstring, light_stem_policy> englishStemmer;
+        std::wstring word{ L"connections" };
+        englishStemmer(word);
+        CHECK(word == L"connection");
+        word = L"RUNNING";
+        englishStemmer(word);
+        CHECK(word == L"RUN");
+
+        stemming::french_stem<std::wstring, light_stem_policy> frenchStemmer;
+        word = L"maisons";
+        frenchStemmer(word);
+        CHECK(word == L"maison");
+
+        stemming::german_stem<std::wstring, light_stem_policy> germanStemmer;
+        word = L"häuser";
+        germanStemmer(word);
+        CHECK(word == L"haus");
+
+        stemming::spanish_stem<std::wstring, light_stem_policy> spanishStemmer;
+        word = L"casas";
+        spanishStemmer(word);
+        CHECK(word == L"cas");
+
+        stemming::russian_stem<std::wstring, light_stem_policy> russianStemmer;
+        word = L"книги";
+        russianStemmer(word);
+        CHECK(word == L"книг");
+        }
+
+    SECTION("Derivational suffixes and verb endings are left alone")
+        {
+        stemming::english_stem<std::wstring, light_stem_policy> englishStemmer;
+        std::wstring word{ L"documentation" };
+        englishStemmer(word);
+        CHECK(word == L"documentation");
+
+        stemming::french_stem<std::wstring, light_stem_policy> frenchStemmer;
+        word = L"mangeaient";
+        frenchStemmer(word);
+        CHECK(word == L"mangeaient");
+
+        stemming::german_stem<std::wstring, light_stem_policy> germanStemmer;
+        word = L"freundlichkeit";
+        germanStemmer(word);
+        CHECK(word == L"freundlichkeit");
+
+        stemming::russian_stem<std::wstring, light_stem_policy> russianStemmer;
+        word = L"радостью";
+        russianStemmer(word);
+        CHECK(word == L"радость");
+        }
+    }
+
+TEST_CASE("Last character filter", "[stemming][endings]")
+    {
+    SECTION("Character bitmap")
+        {
+        constexpr stemming::character_bitmap endings{ L"sdé" };
+        static_assert(endings.contains(L's') && endings.contains(L'S'));
+        static_assert(endings.contains(L'é') && endings.contains(L'É'));
+        static_assert(!endings.contains(L'e') && !endings.contains(L'1'));
+        constexpr stemming::character_bitmap cyrillic{ L"ь" };
+        static_assert(cyrillic.contains(L'Ь') && !(cyrillic | endings).contains(L'а'));
+        static_assert(!endings.contains(0xFF21)); // outside of the table
+        }
+
+    SECTION("Numbers and codes")
+        {
+        stemming::english_stem englishStemmer;
+        std::wstring word{ L"running42" };
+        englishStemmer(word);
+        CHECK(word == L"running42");
+
+        // accents are still removed
+        stemming::french_stem frenchStemmer;
+        word = L"après2";
+        frenchStemmer(word);
+        CHECK(word == L"apres2");
+
+        stemming::german_stem germanStemmer;
+        word = L"häuser7";
+        germanStemmer(word);
+        CHECK(word == L"hauser7");
+
+        // consonants (including digits) are still undoubled
+        stemming::danish_stem danishStemmer;
+        word = L"abekatt11";
+        danishStemmer(word);
+        CHECK(word == L"abekatt1");
+        }
+    }
+
+// Runs every step, even if the word doesn't end with any of the step's final letters
+struct ending_discovery_policy : public stemming::statistics_stem_policy
+    { static constexpr bool skip_ending_checks{ true }; };
+
+// Stems a word and returns how many times each step changed it.
+template<typename Tstemmer>
+std::map<std::string, uint64_t, std::less<>> StepMatches(Tstemmer& stemmer, std::wstring word)
+    {
+    auto& statistics = stemming::thread_statistics();
+    statistics.clear();
+    stemmer(word);
+    std::map<std::string, uint64_t, std::less<>> matches;
+    for (const auto& [step, counters] : statistics.get_steps())
+        {
+        if (counters.m_matches > 0)
+            { matches.emplace(step, counters.m_matches); }
+        }
+    statistics.clear();
+    return matches;
+    }
+
+// Checks that skipping the steps that a word's last letter rules out doesn't keep any step from
+// changing the word. This is checked for the words of the vocabulary and for the base followed by
+// each suffix that a step compares (found by stemming the base with every letter, and then with
+// every suffix that a step compared, until no new ones turn up).
+template<template<typename, typename> class Tstemmer>
+void CheckStepEndings(const std::wstring& base, const std::string_view dictionaryPath)
+    {
+    Tstemmer<std::wstring, ending_discovery_policy> uncheckedStemmer;
+    Tstemmer<std::wstring, stemming::statistics_stem_policy> stemmer;
+    auto& statistics = stemming::thread_statistics();
+
+    const auto checkWord = [&](const std::wstring& word)
+        {
+        const auto matches = StepMatches(stemmer, word);
+        const auto uncheckedMatches = StepMatches(uncheckedStemmer, word);
+        if (matches != uncheckedMatches)
+            {
+            INFO(lazy_wstring_to_string(word));
+            CHECK(matches == uncheckedMatches);
+            }
+        };
+
+    std::set<std::wstring> suffixes;
+    std::set<std::wstring> newSuffixes;
+    for (wchar_t ch = L'a'; ch <= L'z'; ++ch)
+        { newSuffixes.emplace(1, ch); }
+    for (wchar_t ch = 0xDF; ch <= 0xFF; ++ch)
+        { newSuffixes.emplace(1, ch); }
+    for (wchar_t ch = 0x430; ch <= 0x44F; ++ch)
+        { newSuffixes.emplace(1, ch); }
+    while (!newSuffixes.empty())
+        {
+        statistics.clear();
+        for (const auto& suffix : newSuffixes)
+            {
+            suffixes.insert(suffix);
+            std::wstring word{ base + suffix };
+            uncheckedStemmer(word);
+            }
+        newSuffixes.clear();
+        for (const auto& [step, stepSuffixes] : statistics.get_suffixes())
+            {
+            for (const auto& [suffix, counters] : stepSuffixes)
+                {
+                if (!suffixes.contains(suffix))
+                    { newSuffixes.insert(suffix); }
+                }
+            }
+        }
+    statistics.clear();
+    for (const auto& suffix : suffixes)
+        { checkWord(base + suffix); }
+
+    std::ifstream dictFile(dictionaryPath.data());
+    if (!dictFile.is_open())
+        { FAIL("Dictionary file failed to load."); }
+    std::string line;
+    while (std::getline(dictFile, line))
+        {
+        if (utf8::find_invalid(line.begin(), line.end()) != line.end())
+            { FAIL("Corrected UTF-8 in dictionary file."); }
+        const auto utf16line = utf8::utf8to16(line);
+        std::wstring word;
+        std::for_each(utf16line.cbegin(), utf16line.cend(),
+            [&word](const auto ch)
+            { word.append(1, static_cast<wchar_t>(ch)); });
+        checkWord(word);
+        }
+    }
+
+TEST_CASE("Step endings", "[stemming][endings]")
+    {
+    CheckStepEndings<stemming::danish_stem>(L"marbatorpin", "danish/voc.txt");
+    CheckStepEndings<stemming::dutch_porter_stem>(L"marbatorpin", "dutch_porter/voc.txt");
+    CheckStepEndings<stemming::english_stem>(L"marbatorpin", "english/voc.txt");
+    CheckStepEndings<stemming::finnish_stem>(L"marbatorpin", "finnish/voc.txt");
+    CheckStepEndings<stemming::french_stem>(L"marbatorpin", "french/voc.txt");
+    CheckStepEndings<stemming::german_stem>(L"marbatorpin", "german/voc.txt");
+    CheckStepEndings<stemming::italian_stem>(L"marbatorpin", "italian/voc.txt");
+    CheckStepEndings<stemming::norwegian_stem>(L"marbatorpin", "norwegian/voc.txt");
+    CheckStepEndings<stemming::portuguese_stem>(L"marbatorpin", "portuguese/voc.txt");
+    CheckStepEndings<stemming::russian_stem>(L"парбаторпин", "russian/voc.txt");
+    CheckStepEndings<stemming::spanish_stem>(L"marbatorpin", "spanish/voc.txt");
+    CheckStepEndings<stemming::swedish_stem>(L"marbatorpin", "swedish/voc.txt");
+    }
+
+// Stems words with code units that aren't characters (e.g., negative ones where wchar_t is signed,
+// which must never be used to index a lookup table) in place of each letter, before each letter,
+// and at the end, and checks that they are left in the stem.
+template<template<typename, typename> class Tstemmer, typename Tpolicy>
+void CheckInvalidCharacters(const std::vector<std::wstring>& words)
+    {
+    Tstemmer<std::wstring, Tpolicy> stemmer;
+    const wchar_t invalidCharacters[] = { static_cast<wchar_t>(-1), static_cast<wchar_t>(-0x100),
+        static_cast<wchar_t>(-0x3F0), static_cast<wchar_t>(0xD800),
+        std::numeric_limits<wchar_t>::min(), std::numeric_limits<wchar_t>::max() };
+    for (const auto invalidCharacter : invalidCharacters)
+        {
+        for (const auto& word : words)
+            {
+            std::vector<std::wstring> variants{ std::wstring(1, invalidCharacter),
+                std::wstring(3, invalidCharacter) + word, word + invalidCharacter };
+            for (size_t i = 0; i < word.length(); ++i)
+                {
+                std::wstring replaced{ word };
+                replaced[i] = invalidCharacter;
+                variants.push_back(std::move(replaced));
+                std::wstring inserted{ word };
+                inserted.insert(i, 1, invalidCharacter);
+                variants.push_back(std::move(inserted));
+                }
+            for (auto& variant : variants)
+                {
+                stemmer(variant);
+                CHECK(variant.find(invalidCharacter) != std::wstring::npos);
+                }
+            }
+        }
+    }
+
+template<template<typename, typename> class Tstemmer>
+void CheckInvalidCharacters(const std::vector<std::wstring>& words)
+    {
+    CheckInvalidCharacters<Tstemmer, stemming::default_stem_policy>(words);
+    CheckInvalidCharacters<Tstemmer, stemming::lowercase_stem_policy>(words);
+    CheckInvalidCharacters<Tstemmer, stemming::light_stem_policy>(words);
+    }
+
+TEST_CASE("Invalid characters", "[stemming][invalid]")
+    {
+    CheckInvalidCharacters<stemming::danish_stem>({ L"indvendingerne", L"løbende" });
+    CheckInvalidCharacters<stemming::dutch_porter_stem>({ L"lichamelijkheden", L"ëigenaardig" });
+    CheckInvalidCharacters<stemming::english_stem>({ L"skies", L"generously", L"news", L"Hopping" });
+    CheckInvalidCharacters<stemming::finnish_stem>({ L"taloissammekin", L"kädessään" });
+    CheckInvalidCharacters<stemming::french_stem>({ L"l'continuellement", L"Élégamment" });
+    CheckInvalidCharacters<stemming::german_stem>({ L"Häuserfreundlichkeit", L"aufeinanderfolgenden" });
+    CheckInvalidCharacters<stemming::italian_stem>({ L"mangiandoglielo", L"abbandonerà" });
+    CheckInvalidCharacters<stemming::norwegian_stem>({ L"hetenes", L"løpende" });
+    CheckInvalidCharacters<stemming::portuguese_stem>({ L"maçãs", L"falaríamos" });
+    CheckInvalidCharacters<stemming::russian_stem>({ L"прочитавшись", L"Книгами" });
+    CheckInvalidCharacters<stemming::spanish_stem>({ L"comiéndoselo", L"yendo" });
+    CheckInvalidCharacters<stemming::swedish_stem>({ L"heterna", L"öppnandet" });
+    }
+
+[[nodiscard]]
+std::vector<std::wstring> LoadVocabulary(const std::string_view dictionaryPath)
+    {
+    std::vector<std::wstring> words;
+    std::ifstream dictFile(dictionaryPath.data());
+    std::string line;
+    while (std::getline(dictFile, line))
+        {
+        if (utf8::find_invalid(line.begin(), line.end()) != line.end())
+            { continue; }
+        const auto utf16line = utf8::utf8to16(line);
+        std::wstring word;
+        word.reserve(utf16line.length());
+        std::for_each(utf16line.cbegin(), utf16line.cend(),
+            [&word](const auto ch)
+            { word.append(1, static_cast<wchar_t>(ch)); });
+        words.push_back(std::move(word));
+        }
+    return words;
+    }
+
+// Of the pairs of words that the full algorithm conflates (i.e., that share a stem
+// in the Snowball output file), returns the fraction that light stemming also conflates.
+template<template<typename, typename> class Tstemmer>
+double LightStemmingRecall(const std::string_view dictionaryPath,
+                           const std::string_view expectedPath)
+    {
+    const auto words = LoadVocabulary(dictionaryPath);
+    const auto expectedStems = LoadVocabulary(expectedPath);
+    REQUIRE_FALSE(words.empty());
+    REQUIRE(words.size() == expectedStems.size());
+
+    Tstemmer<std::wstring, stemming::light_stem_policy> lightStemmer;
+    // the number of words with each light stem, grouped by their full stem
+    std::map<std::wstring, std::map<std::wstring, size_t>> conflations;
+    for (size_t i = 0; i < words.size(); ++i)
+        {
+        std::wstring lightStem{ words[i] };
+        lightStemmer(lightStem);
+        ++conflations[expectedStems[i]][lightStem];
+        }
+
+    size_t fullPairs{ 0 }, lightPairs{ 0 };
+    for (const auto& [fullStem, lightStems] : conflations)
+        {
+        size_t wordCount{ 0 };
+        for (const auto& [lightStem, count] : lightStems)
+            {
+            lightPairs += (count * (count - 1)) / 2;
+            wordCount += count;
+            }
+        fullPairs += (wordCount * (wordCount - 1)) / 2;
+        }
+    return (fullPairs == 0) ? 1.0 :
+        static_cast<double>(lightPairs) / static_cast<double>(fullPairs);
+    }
+
+// hidden by default, run with "[recall]" to see how much of the full algorithm's
+// conflation is kept by light stemming
+TEST_CASE("light stemming recall", "[.][light][recall]")
+    {
+    const auto reportRecall = [](const std::string_view language, const double recall)
+        {
+        WARN(language << " light stemming recall: " << recall * 100 << "%");
+        CHECK(recall > 0);
+        };
+    reportRecall("Danish", LightStemmingRecall<stemming::danish_stem>(
+        "danish/voc.txt", "danish/output.txt"));
+    reportRecall("Dutch", LightStemmingRecall<stemming::dutch_porter_stem>(
+        "dutch_porter/voc.txt", "dutch_porter/output.txt"));
+    reportRecall("English", LightStemmingRecall<stemming::english_stem>(
+        "english/voc.txt", "english/output.txt"));
+    reportRecall("Finnish", LightStemmingRecall<stemming::finnish_stem>(
+        "finnish/voc.txt", "finnish/output.txt"));
+    reportRecall("French", LightStemmingRecall<stemming::french_stem>(
+        "french/voc.txt", "french/output.txt"));
+    reportRecall("German", LightStemmingRecall<stemming::german_stem>(
+        "german/voc.txt", "german/output.txt"));
+    reportRecall("Italian", LightStemmingRecall<stemming::italian_stem>(
+        "italian/voc.txt", "italian/output.txt"));
+    reportRecall("Norwegian", LightStemmingRecall<stemming::norwegian_stem>(
+        "norwegian/voc.txt", "norwegian/output.txt"));
+    reportRecall("Portuguese", LightStemmingRecall<stemming::portuguese_stem>(
+        "portuguese/voc.txt", "portuguese/output.txt"));
+    reportRecall("Russian", LightStemmingRecall<stemming::russian_stem>(
+        "russian/voc.txt", "russian/output.txt"));
+    reportRecall("Spanish", LightStemmingRecall<stemming::spanish_stem>(
+        "spanish/voc.txt", "spanish/output.txt"));
+    reportRecall("Swedish", LightStemmingRecall<stemming::swedish_stem>(
+        "swedish/voc.txt", "swedish/output.txt"));
+    }